@@ -19,7 +19,7 @@ if echo $REPLY | grep -E '^[Yy]$' > /dev/null; then
         if brew update >/dev/null; then
             # check, for each programme individually with brew, whether it is already installed
             # due to brew issues on MacOS after system upgrade
-            for formula in boost cmake pkg-config parallel gcovr; do
+            for formula in boost cmake google-benchmark pkg-config parallel gcovr; do
                 # if brew formula is installed
                 if brew ls --versions $formula > /dev/null; then
                     continue
@@ -48,7 +48,7 @@ if echo $REPLY | grep -E '^[Yy]$' > /dev/null; then
             echo "Installing dependencies (this may take a while)..."
             if sudo apt-get update >/dev/null; then
                 boostall=$(apt-cache search --names-only '^libboost1.[0-9]+-all-dev$' | sort | tail -n 1 | cut -f1 -d' ')
-                sudo apt-get install --no-install-recommends -y build-essential gcc-11 clang-15 clang-format-15 clang-tidy-15 llvm-15 cmake parallel python3-pip gcovr $boostall &
+                sudo apt-get install --no-install-recommends -y build-essential gcc-11 clang-15 clang-format-15 clang-tidy-15 llvm-15 cmake libbenchmark-dev parallel python3-pip gcovr $boostall &
 
                 if ! git submodule update --jobs 5 --init --recursive; then
                     echo "Error during installation."
@@ -0,0 +1,44 @@
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+#include "operators/access_path_selection.hpp"
+#include "utils/performance_counters.hpp"
+
+// Runs all benchmarks, or those matching --benchmark_filter. Unless --benchmark_out is given, the results are also
+// written as JSON to benchmark_results.json, so that two runs can be compared, e.g., with Google Benchmark's
+// tools/compare.py. Where hardware performance counters are available, the results include them as well. The index
+// selectivity threshold is calibrated before the first benchmark (see calibrate_index_selectivity_threshold).
+int main(int argc, char** argv) {
+  auto arguments = std::vector<char*>(argv, argv + argc);
+  auto has_output_file = false;
+  for (const auto* argument : arguments) {
+    has_output_file |= std::string{argument}.starts_with("--benchmark_out=");
+  }
+
+  auto output_file_argument = std::string{"--benchmark_out=benchmark_results.json"};
+  auto output_format_argument = std::string{"--benchmark_out_format=json"};
+  if (!has_output_file) {
+    arguments.push_back(output_file_argument.data());
+    arguments.push_back(output_format_argument.data());
+  }
+
+  auto argument_count = static_cast<int>(arguments.size());
+  benchmark::Initialize(&argument_count, arguments.data());
+  if (benchmark::ReportUnrecognizedArguments(argument_count, arguments.data())) {
+    return 1;
+  }
+
+  // Access paths are chosen with the threshold of this machine, which is calibrated once before any benchmark runs.
+  opossum::set_index_selectivity_threshold(opossum::calibrate_index_selectivity_threshold());
+
+  if (!opossum::PerformanceCounters::available()) {
+    std::cerr << "Hardware performance counters are not available, the results will not include them." << std::endl;
+  }
+
+  benchmark::RunSpecifiedBenchmarks();
+  benchmark::Shutdown();
+  return 0;
+}
@@ -0,0 +1,49 @@
+#include "benchmark_utils.hpp"
+
+#include "storage/index/sorted_index.hpp"
+
+namespace opossum {
+
+std::shared_ptr<Table> create_int_table(const size_t row_count, const BenchmarkEncoding encoding) {
+  const auto table = std::make_shared<Table>(BENCHMARK_CHUNK_SIZE);
+  table->add_column("a", "int", false);
+  for (const auto value : generate_values<int32_t>(row_count, 1000)) {
+    table->append({value});
+  }
+
+  if (encoding == BenchmarkEncoding::Unencoded) {
+    return table;
+  }
+
+  const auto chunk_count = table->chunk_count();
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    table->compress_chunk(chunk_id);
+    if (encoding == BenchmarkEncoding::DictionaryWithIndex) {
+      table->get_chunk(chunk_id)->create_index<SortedIndex>({ColumnID{0}});
+    }
+  }
+  return table;
+}
+
+BenchmarkPerformanceCounters::BenchmarkPerformanceCounters() : _start_values(PerformanceCounters::read()) {}
+
+void BenchmarkPerformanceCounters::report(benchmark::State& state) const {
+  const auto end_values = PerformanceCounters::read();
+  if (!_start_values || !end_values) {
+    return;
+  }
+
+  const auto values = *end_values - *_start_values;
+  const auto per_iteration = [](const uint64_t count) {
+    return benchmark::Counter{static_cast<double>(count), benchmark::Counter::kAvgIterations};
+  };
+  state.counters["cycles"] = per_iteration(values.cycles);
+  state.counters["instructions"] = per_iteration(values.instructions);
+  state.counters["cache_misses"] = per_iteration(values.cache_misses);
+  state.counters["branch_misses"] = per_iteration(values.branch_misses);
+  state.counters["IPC"] = values.instructions_per_cycle();
+  state.counters["cache_MPKI"] = values.cache_misses_per_kilo_instruction();
+  state.counters["branch_MPKI"] = values.branch_misses_per_kilo_instruction();
+}
+
+}  // namespace opossum
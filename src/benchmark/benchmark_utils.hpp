@@ -0,0 +1,69 @@
+#pragma once
+
+#include <algorithm>
+#include <memory>
+#include <optional>
+#include <random>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+#include "all_type_variant.hpp"
+#include "storage/table.hpp"
+#include "utils/performance_counters.hpp"
+
+namespace opossum {
+
+// The chunk size of the tables that the benchmarks create, i.e., the largest one that FixedWidthIntegerVectors with
+// 16-bit ValueIDs can still address.
+constexpr auto BENCHMARK_CHUNK_SIZE = ChunkOffset{65'535};
+
+// Returns the value with the given number. Strings are zero-padded, so that they sort like their numbers and have a
+// realistic length of 16 characters, which exceeds the small string buffer.
+template <typename T>
+T benchmark_value(const int64_t number) {
+  if constexpr (std::is_same_v<T, std::string>) {
+    const auto digits = std::to_string(number);
+    return "value_" + std::string(10 - std::min(digits.size(), size_t{10}), '0') + digits;
+  } else {
+    return static_cast<T>(number);
+  }
+}
+
+// Returns `count` values that are drawn uniformly from `distinct_count` distinct values. The seed is fixed, so that
+// all runs measure the same data.
+template <typename T>
+std::vector<T> generate_values(const size_t count, const int64_t distinct_count) {
+  auto generator = std::mt19937_64{42};
+  auto distribution = std::uniform_int_distribution<int64_t>{0, distinct_count - 1};
+  auto values = std::vector<T>{};
+  values.reserve(count);
+  for (auto index = size_t{0}; index < count; ++index) {
+    values.push_back(benchmark_value<T>(distribution(generator)));
+  }
+  return values;
+}
+
+// How the chunks of a generated table are stored, which determines the path that a TableScan takes.
+enum class BenchmarkEncoding { Unencoded, Dictionary, DictionaryWithIndex };
+
+// Creates a table with a single int column "a" whose values are uniformly distributed in [0, 1000).
+std::shared_ptr<Table> create_int_table(const size_t row_count, const BenchmarkEncoding encoding);
+
+// Counts the hardware events of a benchmark loop with PerformanceCounters: it is created right before the loop, and
+// report is called right after it. report adds cycles, instructions, cache misses, and branch misses per iteration as
+// well as IPC and misses per thousand instructions (MPKI) to the counters of the benchmark, which are part of the
+// console and JSON output. If counting is not available, nothing is added.
+class BenchmarkPerformanceCounters {
+ public:
+  BenchmarkPerformanceCounters();
+
+  void report(benchmark::State& state) const;
+
+ protected:
+  const std::optional<PerformanceCounterValues> _start_values;
+};
+
+}  // namespace opossum
@@ -0,0 +1,70 @@
+#include "benchmark/benchmark.h"
+
+#include "benchmark_utils.hpp"
+#include "operators/access_path_selection.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT(build/namespaces)
+
+// Scans the table for a < threshold, where threshold is chosen so that state.range(1) percent of the rows of the
+// generated table qualify.
+void run_table_scan(benchmark::State& state, const std::shared_ptr<const Table>& table) {
+  const auto search_value = static_cast<int32_t>(state.range(1) * 10);
+  const auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  const auto performance_counters = BenchmarkPerformanceCounters{};
+  for (auto _ : state) {
+    const auto table_scan = std::make_shared<TableScan>(table_wrapper, ColumnID{0}, ScanType::OpLessThan, search_value);
+    table_scan->execute();
+    benchmark::DoNotOptimize(table_scan->get_output());
+  }
+  performance_counters.report(state);
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * table->row_count()));
+}
+
+}  // namespace
+
+namespace opossum {
+
+// Each benchmark scans state.range(0) rows, of which state.range(1) percent qualify.
+
+void BM_TableScanValueSegment(benchmark::State& state) {
+  run_table_scan(state, create_int_table(state.range(0), BenchmarkEncoding::Unencoded));
+}
+
+void BM_TableScanDictionarySegment(benchmark::State& state) {
+  run_table_scan(state, create_int_table(state.range(0), BenchmarkEncoding::Dictionary));
+}
+
+// Scans the ReferenceSegments that a previous scan produced, which selected the rows with a < 600.
+void BM_TableScanReferenceSegment(benchmark::State& state) {
+  const auto table_wrapper =
+      std::make_shared<TableWrapper>(create_int_table(state.range(0), BenchmarkEncoding::Dictionary));
+  table_wrapper->execute();
+  const auto table_scan = std::make_shared<TableScan>(table_wrapper, ColumnID{0}, ScanType::OpLessThan, 600);
+  table_scan->execute();
+  run_table_scan(state, table_scan->get_output());
+}
+
+// Retrieves the qualifying rows from a SortedIndex on each chunk. The calibrated choice between index lookup and scan
+// is overridden, so that the index is used for every selectivity.
+void BM_TableScanIndex(benchmark::State& state) {
+  const auto previous_threshold = index_selectivity_threshold();
+  set_index_selectivity_threshold(1.0f);
+  run_table_scan(state, create_int_table(state.range(0), BenchmarkEncoding::DictionaryWithIndex));
+  set_index_selectivity_threshold(previous_threshold);
+}
+
+#define BENCHMARK_TABLE_SCAN(name) \
+  BENCHMARK(name)->ArgsProduct({{BENCHMARK_CHUNK_SIZE, 8 * BENCHMARK_CHUNK_SIZE}, {1, 10, 50}})
+
+BENCHMARK_TABLE_SCAN(BM_TableScanValueSegment);
+BENCHMARK_TABLE_SCAN(BM_TableScanDictionarySegment);
+BENCHMARK_TABLE_SCAN(BM_TableScanReferenceSegment);
+BENCHMARK_TABLE_SCAN(BM_TableScanIndex);
+
+}  // namespace opossum
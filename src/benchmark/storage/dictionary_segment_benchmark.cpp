@@ -0,0 +1,38 @@
+#include "benchmark/benchmark.h"
+
+#include "benchmark_utils.hpp"
+#include "storage/dictionary_segment.hpp"
+#include "storage/value_segment.hpp"
+
+namespace opossum {
+
+// Encodes a ValueSegment of state.range(0) values with state.range(1) distinct values. The cardinality determines the
+// dictionary size and the width of the attribute vector.
+template <typename T>
+void BM_DictionarySegmentConstruction(benchmark::State& state) {
+  const auto row_count = static_cast<size_t>(state.range(0));
+  const auto value_segment = std::make_shared<ValueSegment<T>>();
+  for (const auto& value : generate_values<T>(row_count, state.range(1))) {
+    value_segment->append(value);
+  }
+
+  const auto performance_counters = BenchmarkPerformanceCounters{};
+  for (auto _ : state) {
+    const auto dictionary_segment = DictionarySegment<T>{value_segment};
+    benchmark::DoNotOptimize(&dictionary_segment);
+  }
+  performance_counters.report(state);
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * row_count));
+}
+
+#define BENCHMARK_DICTIONARY_SEGMENT_CONSTRUCTION(type)  \
+  BENCHMARK_TEMPLATE(BM_DictionarySegmentConstruction, type) \
+      ->ArgsProduct({{1'024, BENCHMARK_CHUNK_SIZE}, {16, 1'024, BENCHMARK_CHUNK_SIZE}})
+
+BENCHMARK_DICTIONARY_SEGMENT_CONSTRUCTION(int32_t);
+BENCHMARK_DICTIONARY_SEGMENT_CONSTRUCTION(int64_t);
+BENCHMARK_DICTIONARY_SEGMENT_CONSTRUCTION(float);
+BENCHMARK_DICTIONARY_SEGMENT_CONSTRUCTION(double);
+BENCHMARK_DICTIONARY_SEGMENT_CONSTRUCTION(std::string);
+
+}  // namespace opossum
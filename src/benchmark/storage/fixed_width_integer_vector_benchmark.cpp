@@ -0,0 +1,68 @@
+#include "benchmark/benchmark.h"
+
+#include "benchmark_utils.hpp"
+#include "storage/fixed_width_integer_vector.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT(build/namespaces)
+
+// Returns state.range(0) positions in random order, so that accesses cannot be prefetched.
+std::vector<size_t> random_positions(const benchmark::State& state) {
+  const auto size = static_cast<int64_t>(state.range(0));
+  auto positions = std::vector<size_t>{};
+  positions.reserve(size);
+  for (const auto position : generate_values<int64_t>(size, size)) {
+    positions.push_back(static_cast<size_t>(position));
+  }
+  return positions;
+}
+
+}  // namespace
+
+namespace opossum {
+
+template <typename uintX_t>
+void BM_FixedWidthIntegerVectorGet(benchmark::State& state) {
+  const auto positions = random_positions(state);
+  auto vector = FixedWidthIntegerVector<uintX_t>{positions.size()};
+  for (auto position = size_t{0}; position < positions.size(); ++position) {
+    vector.set(position, ValueID{static_cast<uintX_t>(position)});
+  }
+
+  const auto performance_counters = BenchmarkPerformanceCounters{};
+  for (auto _ : state) {
+    auto sum = uint64_t{0};
+    for (const auto position : positions) {
+      sum += vector.get(position);
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  performance_counters.report(state);
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * positions.size()));
+}
+
+template <typename uintX_t>
+void BM_FixedWidthIntegerVectorSet(benchmark::State& state) {
+  const auto positions = random_positions(state);
+  auto vector = FixedWidthIntegerVector<uintX_t>{positions.size()};
+
+  const auto performance_counters = BenchmarkPerformanceCounters{};
+  for (auto _ : state) {
+    for (const auto position : positions) {
+      vector.set(position, ValueID{static_cast<uintX_t>(position)});
+    }
+    benchmark::ClobberMemory();
+  }
+  performance_counters.report(state);
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * positions.size()));
+}
+
+BENCHMARK_TEMPLATE(BM_FixedWidthIntegerVectorGet, uint8_t)->Arg(1'024)->Arg(BENCHMARK_CHUNK_SIZE);
+BENCHMARK_TEMPLATE(BM_FixedWidthIntegerVectorGet, uint16_t)->Arg(1'024)->Arg(BENCHMARK_CHUNK_SIZE);
+BENCHMARK_TEMPLATE(BM_FixedWidthIntegerVectorGet, uint32_t)->Arg(1'024)->Arg(BENCHMARK_CHUNK_SIZE);
+BENCHMARK_TEMPLATE(BM_FixedWidthIntegerVectorSet, uint8_t)->Arg(1'024)->Arg(BENCHMARK_CHUNK_SIZE);
+BENCHMARK_TEMPLATE(BM_FixedWidthIntegerVectorSet, uint16_t)->Arg(1'024)->Arg(BENCHMARK_CHUNK_SIZE);
+BENCHMARK_TEMPLATE(BM_FixedWidthIntegerVectorSet, uint32_t)->Arg(1'024)->Arg(BENCHMARK_CHUNK_SIZE);
+
+}  // namespace opossum
@@ -0,0 +1,31 @@
+#include "benchmark/benchmark.h"
+
+#include "benchmark_utils.hpp"
+#include "storage/table.hpp"
+
+namespace opossum {
+
+// Appends state.range(0) rows of an int and a string column to an empty table, which creates a new chunk every
+// BENCHMARK_CHUNK_SIZE rows.
+void BM_TableAppend(benchmark::State& state) {
+  const auto row_count = static_cast<size_t>(state.range(0));
+  const auto int_values = generate_values<int32_t>(row_count, 1000);
+  const auto string_values = generate_values<std::string>(row_count, 1000);
+
+  const auto performance_counters = BenchmarkPerformanceCounters{};
+  for (auto _ : state) {
+    auto table = Table{BENCHMARK_CHUNK_SIZE};
+    table.add_column("a", "int", false);
+    table.add_column("b", "string", false);
+    for (auto row = size_t{0}; row < row_count; ++row) {
+      table.append({int_values[row], string_values[row]});
+    }
+    benchmark::DoNotOptimize(&table);
+  }
+  performance_counters.report(state);
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * row_count));
+}
+
+BENCHMARK(BM_TableAppend)->Arg(1'024)->Arg(BENCHMARK_CHUNK_SIZE)->Arg(4 * BENCHMARK_CHUNK_SIZE);
+
+}  // namespace opossum
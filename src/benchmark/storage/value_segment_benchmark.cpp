@@ -0,0 +1,37 @@
+#include "benchmark/benchmark.h"
+
+#include "benchmark_utils.hpp"
+#include "storage/value_segment.hpp"
+
+namespace opossum {
+
+// Appends state.range(0) values to an empty segment. state.range(1) selects a nullable segment, in which every tenth
+// value is NULL.
+template <typename T>
+void BM_ValueSegmentAppend(benchmark::State& state) {
+  const auto row_count = static_cast<size_t>(state.range(0));
+  const auto nullable = state.range(1) != 0;
+
+  auto values = std::vector<AllTypeVariant>{};
+  values.reserve(row_count);
+  for (const auto& value : generate_values<T>(row_count, 1000)) {
+    values.emplace_back(nullable && values.size() % 10 == 0 ? AllTypeVariant{NULL_VALUE} : AllTypeVariant{value});
+  }
+
+  const auto performance_counters = BenchmarkPerformanceCounters{};
+  for (auto _ : state) {
+    auto segment = ValueSegment<T>{nullable};
+    for (const auto& value : values) {
+      segment.append(value);
+    }
+    benchmark::DoNotOptimize(segment);
+  }
+  performance_counters.report(state);
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * row_count));
+}
+
+BENCHMARK_TEMPLATE(BM_ValueSegmentAppend, int32_t)->ArgsProduct({{1'024, BENCHMARK_CHUNK_SIZE}, {0, 1}});
+BENCHMARK_TEMPLATE(BM_ValueSegmentAppend, double)->ArgsProduct({{1'024, BENCHMARK_CHUNK_SIZE}, {0, 1}});
+BENCHMARK_TEMPLATE(BM_ValueSegmentAppend, std::string)->ArgsProduct({{1'024, BENCHMARK_CHUNK_SIZE}, {0, 1}});
+
+}  // namespace opossum
@@ -0,0 +1,40 @@
+#include <unistd.h>
+
+#include <filesystem>
+#include <fstream>
+
+#include "benchmark/benchmark.h"
+
+#include "benchmark_utils.hpp"
+#include "utils/load_table.hpp"
+
+namespace opossum {
+
+// Loads a .tbl file with state.range(0) rows of an int, a float, and a string column.
+void BM_LoadTable(benchmark::State& state) {
+  const auto row_count = static_cast<size_t>(state.range(0));
+  const auto path =
+      std::filesystem::temp_directory_path() / ("opossum_load_table_benchmark_" + std::to_string(getpid()) + ".tbl");
+  {
+    const auto int_values = generate_values<int32_t>(row_count, 1000);
+    const auto float_values = generate_values<float>(row_count, 1000);
+    const auto string_values = generate_values<std::string>(row_count, 1000);
+    auto file = std::ofstream{path};
+    file << "a|b|c\nint|float|string\n";
+    for (auto row = size_t{0}; row < row_count; ++row) {
+      file << int_values[row] << '|' << float_values[row] << '|' << string_values[row] << '\n';
+    }
+  }
+
+  const auto performance_counters = BenchmarkPerformanceCounters{};
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(load_table(path, BENCHMARK_CHUNK_SIZE));
+  }
+  performance_counters.report(state);
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * row_count));
+  std::filesystem::remove(path);
+}
+
+BENCHMARK(BM_LoadTable)->Arg(1'024)->Arg(BENCHMARK_CHUNK_SIZE);
+
+}  // namespace opossum
@@ -0,0 +1,356 @@
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <numeric>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "expression/expression_functional.hpp"
+#include "operators/access_path_selection.hpp"
+#include "operators/column_comparison_scan.hpp"
+#include "operators/conjunctive_scan.hpp"
+#include "operators/explain_analyze.hpp"
+#include "operators/pipeline.hpp"
+#include "operators/projection.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "operators/top_n.hpp"
+#include "storage/query_memory_context.hpp"
+#include "storage/table.hpp"
+#include "utils/assert.hpp"
+#include "utils/performance_counters.hpp"
+#include "utils/tpch_table_generator.hpp"
+#include "utils/tracer.hpp"
+
+using namespace opossum;  // NOLINT(build/namespaces)
+
+namespace {
+
+using Tables = std::map<std::string, std::shared_ptr<Table>>;
+
+// The operators of a plan in execution order. The last one produces the result.
+using Plan = std::vector<std::shared_ptr<AbstractOperator>>;
+
+// Queries are reduced to the single-table parts of the TPC-H queries, since the engine has neither joins nor
+// aggregates: the selections, computed columns, and orderings that feed them.
+struct TpchQuery {
+  std::string name;
+  std::function<Plan(const Tables&)> build_plan;
+};
+
+// Column ids of the generated tables.
+constexpr auto L_QUANTITY = ColumnID{4};
+constexpr auto L_EXTENDEDPRICE = ColumnID{5};
+constexpr auto L_DISCOUNT = ColumnID{6};
+constexpr auto L_TAX = ColumnID{7};
+constexpr auto L_RETURNFLAG = ColumnID{8};
+constexpr auto L_LINESTATUS = ColumnID{9};
+constexpr auto L_SHIPDATE = ColumnID{10};
+constexpr auto L_COMMITDATE = ColumnID{11};
+constexpr auto L_RECEIPTDATE = ColumnID{12};
+constexpr auto L_SHIPMODE = ColumnID{14};
+constexpr auto O_TOTALPRICE = ColumnID{3};
+constexpr auto O_ORDERDATE = ColumnID{4};
+constexpr auto P_TYPE = ColumnID{4};
+constexpr auto P_SIZE = ColumnID{5};
+
+std::shared_ptr<TableWrapper> wrap(const Tables& tables, const std::string& name) {
+  return std::make_shared<TableWrapper>(tables.at(name));
+}
+
+const auto QUERIES = std::vector<TpchQuery>{
+    // Q1: the line items shipped up to 90 days before 1998-12-01 with the charge and discounted price per item.
+    {"Q1",
+     [](const Tables& tables) {
+       const auto& lineitem = tables.at("lineitem");
+       const auto table_wrapper = wrap(tables, "lineitem");
+       const auto table_scan =
+           std::make_shared<TableScan>(table_wrapper, L_SHIPDATE, ScanType::OpLessThanEquals, "1998-09-02");
+       const auto discounted_price =
+           mul_(column_(lineitem, L_EXTENDEDPRICE), sub_(value_(1.0f), column_(lineitem, L_DISCOUNT)));
+       const auto projection = std::make_shared<Projection>(
+           table_scan, std::vector<std::shared_ptr<AbstractExpression>>{
+                           column_(lineitem, L_RETURNFLAG), column_(lineitem, L_LINESTATUS),
+                           column_(lineitem, L_QUANTITY), column_(lineitem, L_EXTENDEDPRICE), discounted_price,
+                           mul_(discounted_price, add_(value_(1.0f), column_(lineitem, L_TAX)))});
+       return Plan{table_wrapper, table_scan, projection};
+     }},
+    // Q2: the parts of size 15 and type '%BRASS'.
+    {"Q2",
+     [](const Tables& tables) {
+       const auto table_wrapper = wrap(tables, "part");
+       const auto conjunctive_scan = std::make_shared<ConjunctiveScan>(
+           table_wrapper, std::vector<ScanPredicate>{{P_SIZE, ScanType::OpEquals, 15},
+                                                     {P_TYPE, ScanType::OpLike, "%BRASS"}});
+       return Plan{table_wrapper, conjunctive_scan};
+     }},
+    // Q3: the ten most expensive orders placed before 1995-03-15.
+    {"Q3",
+     [](const Tables& tables) {
+       const auto table_wrapper = wrap(tables, "orders");
+       const auto table_scan =
+           std::make_shared<TableScan>(table_wrapper, O_ORDERDATE, ScanType::OpLessThan, "1995-03-15");
+       const auto top_n = std::make_shared<TopN>(table_scan, O_TOTALPRICE, OrderByMode::Descending, 10);
+       return Plan{table_wrapper, table_scan, top_n};
+     }},
+    // Q6: the revenue of the line items shipped in 1994 with a discount of 6% +- 1% and a quantity below 24.
+    {"Q6",
+     [](const Tables& tables) {
+       const auto& lineitem = tables.at("lineitem");
+       const auto table_wrapper = wrap(tables, "lineitem");
+       const auto conjunctive_scan = std::make_shared<ConjunctiveScan>(
+           table_wrapper, std::vector<ScanPredicate>{{L_SHIPDATE, ScanType::OpBetween, "1994-01-01", "1994-12-31"},
+                                                     {L_DISCOUNT, ScanType::OpBetween, 0.05f, 0.07f},
+                                                     {L_QUANTITY, ScanType::OpLessThan, 24.0f}});
+       const auto projection = std::make_shared<Projection>(
+           conjunctive_scan, std::vector<std::shared_ptr<AbstractExpression>>{
+                                 mul_(column_(lineitem, L_EXTENDEDPRICE), column_(lineitem, L_DISCOUNT))});
+       return Plan{table_wrapper, conjunctive_scan, projection};
+     }},
+    // Q12: the line items received in 1994 by mail or ship that were committed before receipt and shipped before
+    // their commit date.
+    {"Q12",
+     [](const Tables& tables) {
+       const auto table_wrapper = wrap(tables, "lineitem");
+       const auto conjunctive_scan = std::make_shared<ConjunctiveScan>(
+           table_wrapper,
+           std::vector<ScanPredicate>{{L_SHIPMODE, ScanType::OpIn, {}, {}, {"MAIL", "SHIP"}},
+                                      {L_RECEIPTDATE, ScanType::OpBetween, "1994-01-01", "1994-12-31"}});
+       const auto commit_scan =
+           std::make_shared<ColumnComparisonScan>(conjunctive_scan, L_COMMITDATE, ScanType::OpLessThan, L_RECEIPTDATE);
+       const auto ship_scan =
+           std::make_shared<ColumnComparisonScan>(commit_scan, L_SHIPDATE, ScanType::OpLessThan, L_COMMITDATE);
+       return Plan{table_wrapper, conjunctive_scan, commit_scan, ship_scan};
+     }},
+    // Q14: the discounted prices of the line items shipped in September 1995.
+    {"Q14", [](const Tables& tables) {
+       const auto& lineitem = tables.at("lineitem");
+       const auto table_wrapper = wrap(tables, "lineitem");
+       const auto conjunctive_scan = std::make_shared<ConjunctiveScan>(
+           table_wrapper,
+           std::vector<ScanPredicate>{{L_SHIPDATE, ScanType::OpBetween, "1995-09-01", "1995-09-30"}});
+       const auto projection = std::make_shared<Projection>(
+           conjunctive_scan,
+           std::vector<std::shared_ptr<AbstractExpression>>{
+               mul_(column_(lineitem, L_EXTENDEDPRICE), sub_(value_(1.0f), column_(lineitem, L_DISCOUNT)))});
+       return Plan{table_wrapper, conjunctive_scan, projection};
+     }}};
+
+struct Options {
+  float scale_factor = 0.1f;
+  ChunkOffset chunk_size = 65'535;
+  bool compress = false;
+  size_t runs = 10;
+  bool explain = false;
+  bool pipelined = false;
+  std::string output{};
+  std::string trace{};
+};
+
+Options parse_options(const int argc, char** argv) {
+  auto options = Options{};
+  for (auto index = 1; index < argc; ++index) {
+    const auto argument = std::string{argv[index]};
+    const auto separator = argument.find('=');
+    const auto name = argument.substr(0, separator);
+    const auto value = separator == std::string::npos ? std::string{} : argument.substr(separator + 1);
+
+    if (name == "--scale_factor") {
+      options.scale_factor = std::stof(value);
+    } else if (name == "--chunk_size") {
+      options.chunk_size = static_cast<ChunkOffset>(std::stoul(value));
+    } else if (name == "--compress") {
+      options.compress = true;
+    } else if (name == "--runs") {
+      options.runs = std::stoul(value);
+    } else if (name == "--explain") {
+      options.explain = true;
+    } else if (name == "--pipelined") {
+      options.pipelined = true;
+    } else if (name == "--output") {
+      options.output = value;
+    } else if (name == "--trace") {
+      options.trace = value;
+    } else {
+      Fail("Unknown argument " + argument +
+           ". Usage: opossumTpchBenchmark [--scale_factor=0.1] [--chunk_size=65535] [--compress] [--runs=10] "
+           "[--explain] [--pipelined] [--output=results.json] [--trace=trace.json]");
+    }
+  }
+  Assert(options.runs > 0, "At least one run is required.");
+  return options;
+}
+
+struct QueryResult {
+  std::string name;
+  size_t row_count;
+  // Sorted durations of all runs in milliseconds.
+  std::vector<double> durations;
+  // The hardware events of all runs, if they are available.
+  std::optional<PerformanceCounterValues> performance_counters;
+  // The most memory that the intermediate results of a run held at the same time (see
+  // QueryMemoryContext::peak_allocated_bytes), i.e., the maximum over all runs.
+  size_t peak_allocated_bytes;
+};
+
+// Returns the duration below which the given fraction of the runs finished (nearest-rank method).
+double percentile(const std::vector<double>& sorted_durations, const double fraction) {
+  const auto rank = static_cast<size_t>(std::ceil(fraction * static_cast<double>(sorted_durations.size())));
+  return sorted_durations[std::max(rank, size_t{1}) - 1];
+}
+
+double mean(const std::vector<double>& durations) {
+  return std::accumulate(durations.begin(), durations.end(), 0.0) / static_cast<double>(durations.size());
+}
+
+// Runs the query options.runs times. With --pipelined, the plan is executed pipeline by pipeline (see Pipeline). With
+// --explain, the plan of the last run is printed. With --trace, the last run is recorded by the Tracer.
+QueryResult run_query(const TpchQuery& query, const Tables& tables, const Options& options) {
+  const auto runs = options.runs;
+  auto result = QueryResult{query.name, 0, {}, std::nullopt, 0};
+  if (PerformanceCounters::available()) {
+    result.performance_counters = PerformanceCounterValues{};
+  }
+  for (auto run = size_t{0}; run < runs; ++run) {
+    const auto plan = query.build_plan(tables);
+    // Like any query, each run allocates its intermediate results from its own memory context.
+    const auto memory_context = std::make_shared<QueryMemoryContext>();
+    plan.front()->set_memory_context(memory_context);
+    const auto is_last_run = run + 1 == runs;
+    if (!options.trace.empty() && is_last_run) {
+      Tracer::enable();
+    }
+    const auto performance_counters_before = PerformanceCounters::read();
+    const auto start = std::chrono::steady_clock::now();
+    if (options.pipelined) {
+      execute_pipelined(plan);
+    } else {
+      for (const auto& op : plan) {
+        op->execute();
+      }
+    }
+    const auto end = std::chrono::steady_clock::now();
+    const auto performance_counters_after = PerformanceCounters::read();
+    Tracer::disable();
+
+    if (result.performance_counters && performance_counters_before && performance_counters_after) {
+      *result.performance_counters += *performance_counters_after - *performance_counters_before;
+    }
+    result.durations.push_back(std::chrono::duration<double, std::milli>(end - start).count());
+    result.peak_allocated_bytes = std::max(result.peak_allocated_bytes, memory_context->peak_allocated_bytes());
+    result.row_count = plan.back()->get_output()->row_count();
+    if (options.explain && is_last_run) {
+      std::cout << query.name << std::endl;
+      ExplainAnalyze::explain(plan.back());
+    }
+  }
+  std::sort(result.durations.begin(), result.durations.end());
+  return result;
+}
+
+void print_results(const std::vector<QueryResult>& results) {
+  std::cout << std::left << std::setw(6) << "Query" << std::right << std::setw(10) << "Rows";
+  for (const auto& column : {"min", "p50", "p90", "p99", "max", "mean"}) {
+    std::cout << std::setw(10) << std::string{column} + " ms";
+  }
+  std::cout << std::setw(14) << "queries/s" << std::setw(14) << "peak KiB" << std::endl;
+
+  std::cout << std::fixed << std::setprecision(2);
+  for (const auto& result : results) {
+    const auto& durations = result.durations;
+    std::cout << std::left << std::setw(6) << result.name << std::right << std::setw(10) << result.row_count;
+    for (const auto duration : {durations.front(), percentile(durations, 0.5), percentile(durations, 0.9),
+                                percentile(durations, 0.99), durations.back(), mean(durations)}) {
+      std::cout << std::setw(10) << duration;
+    }
+    std::cout << std::setw(14) << 1'000.0 / mean(durations) << std::setw(14)
+              << static_cast<double>(result.peak_allocated_bytes) / 1024 << std::endl;
+  }
+}
+
+void write_json(const std::string& path, const Options& options, const double generation_duration,
+                const std::vector<QueryResult>& results) {
+  auto file = std::ofstream{path};
+  Assert(file.is_open(), "Cannot open " + path + ".");
+
+  file << "{\n  \"scale_factor\": " << options.scale_factor << ",\n  \"chunk_size\": " << options.chunk_size
+       << ",\n  \"compress\": " << (options.compress ? "true" : "false") << ",\n  \"runs\": " << options.runs
+       << ",\n  \"generation_duration_ms\": " << generation_duration << ",\n  \"queries\": [";
+  for (auto index = size_t{0}; index < results.size(); ++index) {
+    const auto& result = results[index];
+    const auto& durations = result.durations;
+    file << (index == 0 ? "" : ",") << "\n    {\"name\": \"" << result.name << "\", \"rows\": " << result.row_count
+         << ", \"min_ms\": " << durations.front() << ", \"p50_ms\": " << percentile(durations, 0.5)
+         << ", \"p90_ms\": " << percentile(durations, 0.9) << ", \"p99_ms\": " << percentile(durations, 0.99)
+         << ", \"max_ms\": " << durations.back() << ", \"mean_ms\": " << mean(durations)
+         << ", \"queries_per_second\": " << 1'000.0 / mean(durations)
+         << ", \"peak_allocated_bytes\": " << result.peak_allocated_bytes;
+    if (const auto& counters = result.performance_counters) {
+      // Counts are averaged over the runs.
+      const auto per_run = [&](const uint64_t count) {
+        return static_cast<double>(count) / static_cast<double>(durations.size());
+      };
+      file << ", \"cycles\": " << per_run(counters->cycles)
+           << ", \"instructions\": " << per_run(counters->instructions)
+           << ", \"cache_misses\": " << per_run(counters->cache_misses)
+           << ", \"branch_misses\": " << per_run(counters->branch_misses)
+           << ", \"ipc\": " << counters->instructions_per_cycle()
+           << ", \"cache_mpki\": " << counters->cache_misses_per_kilo_instruction()
+           << ", \"branch_mpki\": " << counters->branch_misses_per_kilo_instruction();
+    }
+    file << ", \"durations_ms\": [";
+    for (auto run = size_t{0}; run < durations.size(); ++run) {
+      file << (run == 0 ? "" : ", ") << durations[run];
+    }
+    file << "]}";
+  }
+  file << "\n  ]\n}\n";
+}
+
+}  // namespace
+
+// Generates the TPC-H tables and runs each query the given number of times, reporting latency percentiles and
+// throughput per query.
+int main(int argc, char** argv) {
+  const auto options = parse_options(argc, argv);
+  // The plans printed with --explain include the hardware events of each operator.
+  AbstractOperator::set_performance_counters_enabled(options.explain);
+  if (!PerformanceCounters::available()) {
+    std::cout << "Hardware performance counters are not available, the results will not include them." << std::endl;
+  }
+
+  // Calibrated once here, so that no query pays for it and all runs choose the same access paths.
+  set_index_selectivity_threshold(calibrate_index_selectivity_threshold());
+  std::cout << "Index selectivity threshold: " << index_selectivity_threshold() << std::endl;
+
+  std::cout << "Generating TPC-H tables with scale factor " << options.scale_factor << "..." << std::endl;
+  const auto generation_start = std::chrono::steady_clock::now();
+  const auto tables = TpchTableGenerator{options.scale_factor, options.chunk_size, options.compress}.generate();
+  const auto generation_duration =
+      std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - generation_start).count();
+  std::cout << "Generated " << tables.at("lineitem")->row_count() << " line items in " << generation_duration << " ms."
+            << std::endl;
+
+  auto results = std::vector<QueryResult>{};
+  for (const auto& query : QUERIES) {
+    results.push_back(run_query(query, tables, options));
+  }
+  print_results(results);
+
+  if (!options.output.empty()) {
+    write_json(options.output, options, generation_duration, results);
+    std::cout << "Results written to " << options.output << "." << std::endl;
+  }
+  if (!options.trace.empty()) {
+    Tracer::write_chrome_trace(options.trace);
+    std::cout << "Trace written to " << options.trace << "." << std::endl;
+  }
+  return 0;
+}
@@ -0,0 +1,9 @@
+#include "abstract_expression.hpp"
+
+namespace opossum {
+
+AbstractExpression::AbstractExpression(const ExpressionType init_type,
+                                       const std::vector<std::shared_ptr<AbstractExpression>>& init_arguments)
+    : type(init_type), arguments(init_arguments) {}
+
+}  // namespace opossum
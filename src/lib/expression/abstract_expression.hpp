@@ -0,0 +1,38 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "types.hpp"
+
+namespace opossum {
+
+enum class ExpressionType { Column, Value, Arithmetic, Comparison, Case, Cast };
+
+// AbstractExpression is the abstract super class for all expressions, i.e., the nodes of an expression tree that an
+// operator such as the Projection evaluates for each row of its input. Expressions are immutable once created. Their
+// data type is known at construction time, so operators can set up typed output segments before evaluating anything.
+class AbstractExpression : private Noncopyable {
+ public:
+  AbstractExpression(const ExpressionType init_type,
+                     const std::vector<std::shared_ptr<AbstractExpression>>& init_arguments);
+
+  virtual ~AbstractExpression() = default;
+
+  // Returns a human-readable representation of the expression. Operators use it as the name of output columns.
+  virtual std::string description() const = 0;
+
+  // Returns the type string (e.g., "int") of the values the expression evaluates to.
+  virtual std::string data_type() const = 0;
+
+  // Returns whether the expression can evaluate to NULL.
+  virtual bool is_nullable() const = 0;
+
+  const ExpressionType type;
+
+  // The child expressions, e.g., the operands of an arithmetic expression.
+  const std::vector<std::shared_ptr<AbstractExpression>> arguments;
+};
+
+}  // namespace opossum
@@ -0,0 +1,55 @@
+#include "arithmetic_expression.hpp"
+
+#include "expression_utils.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+ArithmeticExpression::ArithmeticExpression(const ArithmeticOperator init_arithmetic_operator,
+                                           const std::shared_ptr<AbstractExpression>& left_operand,
+                                           const std::shared_ptr<AbstractExpression>& right_operand)
+    : AbstractExpression(ExpressionType::Arithmetic, {left_operand, right_operand}),
+      arithmetic_operator(init_arithmetic_operator) {
+  Assert(data_type() != "string", "Arithmetic expressions require numeric operands.");
+}
+
+std::string ArithmeticExpression::description() const {
+  auto operator_string = std::string{};
+  switch (arithmetic_operator) {
+    case ArithmeticOperator::Addition:
+      operator_string = " + ";
+      break;
+    case ArithmeticOperator::Subtraction:
+      operator_string = " - ";
+      break;
+    case ArithmeticOperator::Multiplication:
+      operator_string = " * ";
+      break;
+    case ArithmeticOperator::Division:
+      operator_string = " / ";
+      break;
+    case ArithmeticOperator::Modulo:
+      operator_string = " % ";
+      break;
+  }
+  return "(" + left_operand()->description() + operator_string + right_operand()->description() + ")";
+}
+
+std::string ArithmeticExpression::data_type() const {
+  return expression_common_type(left_operand()->data_type(), right_operand()->data_type());
+}
+
+bool ArithmeticExpression::is_nullable() const {
+  return left_operand()->is_nullable() || right_operand()->is_nullable() ||
+         arithmetic_operator == ArithmeticOperator::Division || arithmetic_operator == ArithmeticOperator::Modulo;
+}
+
+const std::shared_ptr<AbstractExpression>& ArithmeticExpression::left_operand() const {
+  return arguments[0];
+}
+
+const std::shared_ptr<AbstractExpression>& ArithmeticExpression::right_operand() const {
+  return arguments[1];
+}
+
+}  // namespace opossum
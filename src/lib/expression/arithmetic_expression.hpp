@@ -0,0 +1,27 @@
+#pragma once
+
+#include "abstract_expression.hpp"
+
+namespace opossum {
+
+enum class ArithmeticOperator { Addition, Subtraction, Multiplication, Division, Modulo };
+
+// Combines two numeric operands. Both are converted to their common type first (see expression_common_type). Division
+// and modulo by zero evaluate to NULL, as does the integer division that overflows (the smallest value divided by -1).
+class ArithmeticExpression : public AbstractExpression {
+ public:
+  ArithmeticExpression(const ArithmeticOperator init_arithmetic_operator,
+                       const std::shared_ptr<AbstractExpression>& left_operand,
+                       const std::shared_ptr<AbstractExpression>& right_operand);
+
+  std::string description() const override;
+  std::string data_type() const override;
+  bool is_nullable() const override;
+
+  const std::shared_ptr<AbstractExpression>& left_operand() const;
+  const std::shared_ptr<AbstractExpression>& right_operand() const;
+
+  const ArithmeticOperator arithmetic_operator;
+};
+
+}  // namespace opossum
@@ -0,0 +1,42 @@
+#include "case_expression.hpp"
+
+#include "expression_utils.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+CaseExpression::CaseExpression(const std::shared_ptr<AbstractExpression>& when,
+                               const std::shared_ptr<AbstractExpression>& then,
+                               const std::shared_ptr<AbstractExpression>& otherwise)
+    : AbstractExpression(ExpressionType::Case, {when, then, otherwise}) {
+  Assert(when->data_type() != "string", "The WHEN clause of a CASE expression has to be numeric.");
+  // Fails early for incompatible branches.
+  data_type();
+}
+
+std::string CaseExpression::description() const {
+  return "CASE WHEN " + when()->description() + " THEN " + then()->description() + " ELSE " +
+         otherwise()->description() + " END";
+}
+
+std::string CaseExpression::data_type() const {
+  return expression_common_type(then()->data_type(), otherwise()->data_type());
+}
+
+bool CaseExpression::is_nullable() const {
+  return then()->is_nullable() || otherwise()->is_nullable();
+}
+
+const std::shared_ptr<AbstractExpression>& CaseExpression::when() const {
+  return arguments[0];
+}
+
+const std::shared_ptr<AbstractExpression>& CaseExpression::then() const {
+  return arguments[1];
+}
+
+const std::shared_ptr<AbstractExpression>& CaseExpression::otherwise() const {
+  return arguments[2];
+}
+
+}  // namespace opossum
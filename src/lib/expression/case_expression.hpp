@@ -0,0 +1,23 @@
+#pragma once
+
+#include "abstract_expression.hpp"
+
+namespace opossum {
+
+// CASE WHEN <when> THEN <then> ELSE <otherwise> END. Rows for which `when` is NULL or 0 take the `otherwise` branch.
+// Multiple WHEN clauses are expressed by nesting CaseExpressions in the `otherwise` branch.
+class CaseExpression : public AbstractExpression {
+ public:
+  CaseExpression(const std::shared_ptr<AbstractExpression>& when, const std::shared_ptr<AbstractExpression>& then,
+                 const std::shared_ptr<AbstractExpression>& otherwise);
+
+  std::string description() const override;
+  std::string data_type() const override;
+  bool is_nullable() const override;
+
+  const std::shared_ptr<AbstractExpression>& when() const;
+  const std::shared_ptr<AbstractExpression>& then() const;
+  const std::shared_ptr<AbstractExpression>& otherwise() const;
+};
+
+}  // namespace opossum
@@ -0,0 +1,25 @@
+#include "cast_expression.hpp"
+
+namespace opossum {
+
+CastExpression::CastExpression(const std::shared_ptr<AbstractExpression>& argument,
+                               const std::string& init_target_data_type)
+    : AbstractExpression(ExpressionType::Cast, {argument}), _target_data_type(init_target_data_type) {}
+
+std::string CastExpression::description() const {
+  return "CAST(" + argument()->description() + " AS " + _target_data_type + ")";
+}
+
+std::string CastExpression::data_type() const {
+  return _target_data_type;
+}
+
+bool CastExpression::is_nullable() const {
+  return argument()->is_nullable();
+}
+
+const std::shared_ptr<AbstractExpression>& CastExpression::argument() const {
+  return arguments[0];
+}
+
+}  // namespace opossum
@@ -0,0 +1,22 @@
+#pragma once
+
+#include "abstract_expression.hpp"
+
+namespace opossum {
+
+// CAST(<argument> AS <target data type>). Casting a string that does not represent a number to a numeric type fails.
+class CastExpression : public AbstractExpression {
+ public:
+  CastExpression(const std::shared_ptr<AbstractExpression>& argument, const std::string& init_target_data_type);
+
+  std::string description() const override;
+  std::string data_type() const override;
+  bool is_nullable() const override;
+
+  const std::shared_ptr<AbstractExpression>& argument() const;
+
+ protected:
+  const std::string _target_data_type;
+};
+
+}  // namespace opossum
@@ -0,0 +1,25 @@
+#include "column_expression.hpp"
+
+namespace opossum {
+
+ColumnExpression::ColumnExpression(const ColumnID init_column_id, const std::string& init_data_type,
+                                   const bool init_nullable, const std::string& init_column_name)
+    : AbstractExpression(ExpressionType::Column, {}),
+      column_id(init_column_id),
+      _data_type(init_data_type),
+      _nullable(init_nullable),
+      _column_name(init_column_name) {}
+
+std::string ColumnExpression::description() const {
+  return _column_name;
+}
+
+std::string ColumnExpression::data_type() const {
+  return _data_type;
+}
+
+bool ColumnExpression::is_nullable() const {
+  return _nullable;
+}
+
+}  // namespace opossum
@@ -0,0 +1,25 @@
+#pragma once
+
+#include "abstract_expression.hpp"
+
+namespace opossum {
+
+// References a column of the input table of the evaluating operator.
+class ColumnExpression : public AbstractExpression {
+ public:
+  ColumnExpression(const ColumnID init_column_id, const std::string& init_data_type, const bool init_nullable,
+                   const std::string& init_column_name);
+
+  std::string description() const override;
+  std::string data_type() const override;
+  bool is_nullable() const override;
+
+  const ColumnID column_id;
+
+ protected:
+  const std::string _data_type;
+  const bool _nullable;
+  const std::string _column_name;
+};
+
+}  // namespace opossum
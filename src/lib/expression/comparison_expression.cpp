@@ -0,0 +1,44 @@
+#include "comparison_expression.hpp"
+
+#include "expression_utils.hpp"
+#include "utils/assert.hpp"
+#include "utils/scan_type_utils.hpp"
+
+namespace opossum {
+
+ComparisonExpression::ComparisonExpression(const ScanType init_scan_type,
+                                           const std::shared_ptr<AbstractExpression>& left_operand,
+                                           const std::shared_ptr<AbstractExpression>& right_operand)
+    : AbstractExpression(ExpressionType::Comparison, {left_operand, right_operand}), scan_type(init_scan_type) {
+  Assert(scan_type != ScanType::OpBetween && scan_type != ScanType::OpIn && scan_type != ScanType::OpLike,
+         "ComparisonExpression only supports binary comparisons.");
+  // Fails early for incomparable operands.
+  operand_data_type();
+}
+
+std::string ComparisonExpression::description() const {
+  return "(" + left_operand()->description() + " " + scan_type_to_string(scan_type) + " " +
+         right_operand()->description() + ")";
+}
+
+std::string ComparisonExpression::data_type() const {
+  return "int";
+}
+
+bool ComparisonExpression::is_nullable() const {
+  return left_operand()->is_nullable() || right_operand()->is_nullable();
+}
+
+const std::shared_ptr<AbstractExpression>& ComparisonExpression::left_operand() const {
+  return arguments[0];
+}
+
+const std::shared_ptr<AbstractExpression>& ComparisonExpression::right_operand() const {
+  return arguments[1];
+}
+
+std::string ComparisonExpression::operand_data_type() const {
+  return expression_common_type(left_operand()->data_type(), right_operand()->data_type());
+}
+
+}  // namespace opossum
@@ -0,0 +1,27 @@
+#pragma once
+
+#include "abstract_expression.hpp"
+
+namespace opossum {
+
+// Compares two operands of a common type (see expression_common_type). The result is an "int" that is 1 if the
+// comparison holds, 0 if it does not, and NULL if either operand is NULL.
+class ComparisonExpression : public AbstractExpression {
+ public:
+  ComparisonExpression(const ScanType init_scan_type, const std::shared_ptr<AbstractExpression>& left_operand,
+                       const std::shared_ptr<AbstractExpression>& right_operand);
+
+  std::string description() const override;
+  std::string data_type() const override;
+  bool is_nullable() const override;
+
+  const std::shared_ptr<AbstractExpression>& left_operand() const;
+  const std::shared_ptr<AbstractExpression>& right_operand() const;
+
+  // The common type both operands are converted to before they are compared.
+  std::string operand_data_type() const;
+
+  const ScanType scan_type;
+};
+
+}  // namespace opossum
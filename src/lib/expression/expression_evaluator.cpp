@@ -0,0 +1,353 @@
+#include "expression_evaluator.hpp"
+
+#include <cmath>
+#include <functional>
+#include <limits>
+#include <type_traits>
+
+#include <boost/lexical_cast.hpp>
+
+#include "arithmetic_expression.hpp"
+#include "case_expression.hpp"
+#include "cast_expression.hpp"
+#include "column_expression.hpp"
+#include "comparison_expression.hpp"
+#include "resolve_type.hpp"
+#include "storage/chunk.hpp"
+#include "storage/materialize.hpp"
+#include "storage/query_memory_context.hpp"
+#include "storage/value_segment.hpp"
+#include "utils/assert.hpp"
+#include "utils/scan_type_utils.hpp"
+#include "value_expression.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT(build/namespaces)
+
+// Applies `functor` to each pair of operand values. Literal operands are broadcast. The four loops are spelled out so
+// that none of them has to check for literals per row and the compiler can vectorize them.
+template <typename Result, typename Left, typename Right, typename Functor>
+std::pmr::vector<Result> apply_binary(const ExpressionResult<Left>& left, const ExpressionResult<Right>& right,
+                                      const size_t row_count, std::pmr::memory_resource* memory_resource,
+                                      const Functor& functor) {
+  const auto& left_values = left.values;
+  const auto& right_values = right.values;
+
+  if (left.is_literal() && right.is_literal()) {
+    return std::pmr::vector<Result>(1, static_cast<Result>(functor(left_values[0], right_values[0])), memory_resource);
+  }
+
+  auto values = std::pmr::vector<Result>(row_count, memory_resource);
+  if (left.is_literal()) {
+    const auto& left_value = left_values[0];
+    for (auto row = size_t{0}; row < row_count; ++row) {
+      values[row] = functor(left_value, right_values[row]);
+    }
+  } else if (right.is_literal()) {
+    const auto& right_value = right_values[0];
+    for (auto row = size_t{0}; row < row_count; ++row) {
+      values[row] = functor(left_values[row], right_value);
+    }
+  } else {
+    for (auto row = size_t{0}; row < row_count; ++row) {
+      values[row] = functor(left_values[row], right_values[row]);
+    }
+  }
+  return values;
+}
+
+// Returns the NULL flags of a row-wise combination of the given results, i.e., a row is NULL if it is NULL in any of
+// them. Returns an empty vector if none of the results contains NULLs.
+template <typename... Results>
+std::vector<bool> combine_nulls(const size_t row_count, const Results&... results) {
+  if (!(results.is_nullable() || ...)) {
+    return {};
+  }
+
+  auto nulls = std::vector<bool>(row_count);
+  for (auto row = size_t{0}; row < row_count; ++row) {
+    nulls[row] = (results.is_null(row) || ...);
+  }
+  return nulls;
+}
+
+// Converts the values of a result, e.g., when an int operand is added to a double or for CAST.
+template <typename From, typename To>
+std::shared_ptr<ExpressionResult<To>> convert_result(const ExpressionResult<From>& from,
+                                                     std::pmr::memory_resource* memory_resource) {
+  const auto row_count = from.values.size();
+  auto values = std::pmr::vector<To>(row_count, memory_resource);
+
+  if constexpr (std::is_same_v<From, To>) {
+    values = from.values;
+  } else if constexpr (std::is_arithmetic_v<From> && std::is_arithmetic_v<To>) {
+    for (auto row = size_t{0}; row < row_count; ++row) {
+      values[row] = static_cast<To>(from.values[row]);
+    }
+  } else {
+    // Conversions from and to strings. NULL rows are skipped, since their placeholder value might not be convertible.
+    for (auto row = size_t{0}; row < row_count; ++row) {
+      if (from.is_null(row)) {
+        continue;
+      }
+
+      try {
+        values[row] = boost::lexical_cast<To>(from.values[row]);
+      } catch (const boost::bad_lexical_cast&) {
+        Fail("Cannot convert '" + boost::lexical_cast<std::string>(from.values[row]) + "' to " + data_type_name<To>() +
+             ".");
+      }
+    }
+  }
+
+  auto nulls = from.nulls;
+  return std::make_shared<ExpressionResult<To>>(std::move(values), std::move(nulls));
+}
+
+// Returns whether lhs / rhs overflows, which is only the case for the smallest signed integer divided by -1. lhs % rhs
+// is undefined for the same operands, although its result would be 0.
+template <typename T>
+bool division_overflows(const T& lhs, const T& rhs) {
+  if constexpr (std::is_integral_v<T> && std::is_signed_v<T>) {
+    return lhs == std::numeric_limits<T>::min() && rhs == T{-1};
+  } else {
+    return false;
+  }
+}
+
+template <typename T>
+std::shared_ptr<ExpressionResult<T>> evaluate_arithmetic(const ArithmeticOperator arithmetic_operator,
+                                                         const ExpressionResult<T>& left,
+                                                         const ExpressionResult<T>& right, const size_t row_count,
+                                                         std::pmr::memory_resource* memory_resource) {
+  auto values = std::pmr::vector<T>{memory_resource};
+  switch (arithmetic_operator) {
+    case ArithmeticOperator::Addition:
+      values = apply_binary<T>(left, right, row_count, memory_resource, std::plus<T>{});
+      break;
+    case ArithmeticOperator::Subtraction:
+      values = apply_binary<T>(left, right, row_count, memory_resource, std::minus<T>{});
+      break;
+    case ArithmeticOperator::Multiplication:
+      values = apply_binary<T>(left, right, row_count, memory_resource, std::multiplies<T>{});
+      break;
+    case ArithmeticOperator::Division:
+      // The placeholders for division by zero and for overflowing divisions are replaced by NULL below.
+      values = apply_binary<T>(left, right, row_count, memory_resource, [](const T& lhs, const T& rhs) {
+        return rhs == T{0} || division_overflows(lhs, rhs) ? T{0} : static_cast<T>(lhs / rhs);
+      });
+      break;
+    case ArithmeticOperator::Modulo:
+      values = apply_binary<T>(left, right, row_count, memory_resource, [](const T& lhs, const T& rhs) {
+        if constexpr (std::is_integral_v<T>) {
+          return rhs == T{0} || division_overflows(lhs, rhs) ? T{0} : static_cast<T>(lhs % rhs);
+        } else {
+          return rhs == T{0} ? T{0} : static_cast<T>(std::fmod(lhs, rhs));
+        }
+      });
+      break;
+  }
+
+  const auto result_size = values.size();
+  auto nulls = combine_nulls(result_size, left, right);
+  if (arithmetic_operator == ArithmeticOperator::Division || arithmetic_operator == ArithmeticOperator::Modulo) {
+    for (auto row = size_t{0}; row < result_size; ++row) {
+      if (right.value(row) == T{0} || (arithmetic_operator == ArithmeticOperator::Division &&
+                                       division_overflows(left.value(row), right.value(row)))) {
+        if (nulls.empty()) {
+          nulls.resize(result_size);
+        }
+        nulls[row] = true;
+      }
+    }
+  }
+
+  return std::make_shared<ExpressionResult<T>>(std::move(values), std::move(nulls));
+}
+
+}  // namespace
+
+namespace opossum {
+
+ExpressionEvaluator::ExpressionEvaluator(const std::shared_ptr<const Chunk>& chunk,
+                                         const std::shared_ptr<QueryMemoryContext>& memory_context)
+    : _chunk(chunk),
+      _chunk_size(chunk->size()),
+      _memory_context(memory_context),
+      _memory_resource(get_memory_resource(memory_context)) {}
+
+template <typename T>
+std::shared_ptr<ExpressionResult<T>> ExpressionEvaluator::evaluate_expression_to_result(
+    const AbstractExpression& expression) {
+  const auto expression_data_type = expression.data_type();
+  if (expression_data_type != data_type_name<T>()) {
+    auto result = std::shared_ptr<ExpressionResult<T>>{};
+    resolve_data_type(expression_data_type, [&](auto type) {
+      using ExpressionDataType = typename decltype(type)::type;
+      result = convert_result<ExpressionDataType, T>(*evaluate_expression_to_result<ExpressionDataType>(expression),
+                                                     _memory_resource);
+    });
+    return result;
+  }
+
+  switch (expression.type) {
+    case ExpressionType::Column:
+      return _evaluate_column_expression<T>(static_cast<const ColumnExpression&>(expression));
+    case ExpressionType::Value:
+      return _evaluate_value_expression<T>(static_cast<const ValueExpression&>(expression));
+    case ExpressionType::Arithmetic:
+      return _evaluate_arithmetic_expression<T>(static_cast<const ArithmeticExpression&>(expression));
+    case ExpressionType::Comparison:
+      return _evaluate_comparison_expression<T>(static_cast<const ComparisonExpression&>(expression));
+    case ExpressionType::Case:
+      return _evaluate_case_expression<T>(static_cast<const CaseExpression&>(expression));
+    case ExpressionType::Cast:
+      return _evaluate_cast_expression<T>(static_cast<const CastExpression&>(expression));
+  }
+  Fail("Unsupported ExpressionType.");
+}
+
+std::shared_ptr<AbstractSegment> ExpressionEvaluator::evaluate_expression_to_segment(
+    const AbstractExpression& expression) {
+  auto segment = std::shared_ptr<AbstractSegment>{};
+  resolve_data_type(expression.data_type(), [&](auto type) {
+    using ExpressionDataType = typename decltype(type)::type;
+    const auto result = evaluate_expression_to_result<ExpressionDataType>(expression);
+
+    // Column results are cached and might be used by further expressions, so they are copied instead of moved.
+    auto values = std::pmr::vector<ExpressionDataType>{_memory_resource};
+    auto nulls = std::vector<bool>{};
+    if (expression.type == ExpressionType::Column) {
+      values = result->values;
+      nulls = result->nulls;
+    } else {
+      values = std::move(result->values);
+      nulls = std::move(result->nulls);
+    }
+
+    // Literal results are only expanded to the size of the chunk when they are written to a segment.
+    if (values.size() != _chunk_size) {
+      DebugAssert(values.size() == 1, "Results have either one entry per row or a single entry.");
+      values = std::pmr::vector<ExpressionDataType>(_chunk_size, values.front(), _memory_resource);
+      if (!nulls.empty()) {
+        nulls = std::vector<bool>(_chunk_size, nulls.front());
+      }
+    }
+
+    if (expression.is_nullable()) {
+      nulls.resize(_chunk_size, false);
+      segment = make_shared_in<ValueSegment<ExpressionDataType>>(_memory_context, std::move(values), std::move(nulls));
+    } else {
+      DebugAssert(nulls.empty(), "Non-nullable expression evaluated to NULL.");
+      segment = make_shared_in<ValueSegment<ExpressionDataType>>(_memory_context, std::move(values));
+    }
+  });
+  return segment;
+}
+
+template <typename T>
+std::shared_ptr<ExpressionResult<T>> ExpressionEvaluator::_evaluate_column_expression(
+    const ColumnExpression& expression) {
+  const auto cached_result = _column_results.find(expression.column_id);
+  if (cached_result != _column_results.end()) {
+    return std::static_pointer_cast<ExpressionResult<T>>(cached_result->second);
+  }
+
+  auto result = std::make_shared<ExpressionResult<T>>(std::pmr::vector<T>{_memory_resource}, std::vector<bool>{});
+  materialize_values_and_nulls(*_chunk->get_segment(expression.column_id), result->values, result->nulls);
+  if (!expression.is_nullable()) {
+    result->nulls.clear();
+  }
+
+  _column_results.emplace(expression.column_id, result);
+  return result;
+}
+
+template <typename T>
+std::shared_ptr<ExpressionResult<T>> ExpressionEvaluator::_evaluate_value_expression(
+    const ValueExpression& expression) {
+  if (variant_is_null(expression.value)) {
+    return std::make_shared<ExpressionResult<T>>(std::pmr::vector<T>(1, T{}, _memory_resource),
+                                                 std::vector<bool>{true});
+  }
+  return std::make_shared<ExpressionResult<T>>(std::pmr::vector<T>(1, type_cast<T>(expression.value), _memory_resource),
+                                               std::vector<bool>{});
+}
+
+template <typename T>
+std::shared_ptr<ExpressionResult<T>> ExpressionEvaluator::_evaluate_arithmetic_expression(
+    const ArithmeticExpression& expression) {
+  if constexpr (std::is_arithmetic_v<T>) {
+    const auto left = evaluate_expression_to_result<T>(*expression.left_operand());
+    const auto right = evaluate_expression_to_result<T>(*expression.right_operand());
+    return evaluate_arithmetic<T>(expression.arithmetic_operator, *left, *right, _chunk_size, _memory_resource);
+  } else {
+    Fail("Arithmetic expressions cannot evaluate to strings.");
+  }
+}
+
+template <typename T>
+std::shared_ptr<ExpressionResult<T>> ExpressionEvaluator::_evaluate_comparison_expression(
+    const ComparisonExpression& expression) {
+  if constexpr (std::is_same_v<T, int32_t>) {
+    auto result = std::shared_ptr<ExpressionResult<T>>{};
+    resolve_data_type(expression.operand_data_type(), [&](auto type) {
+      using OperandDataType = typename decltype(type)::type;
+      const auto left = evaluate_expression_to_result<OperandDataType>(*expression.left_operand());
+      const auto right = evaluate_expression_to_result<OperandDataType>(*expression.right_operand());
+
+      with_comparator(expression.scan_type, [&](auto comparator) {
+        auto values = apply_binary<int32_t>(*left, *right, _chunk_size, _memory_resource, comparator);
+        auto nulls = combine_nulls(values.size(), *left, *right);
+        result = std::make_shared<ExpressionResult<T>>(std::move(values), std::move(nulls));
+      });
+    });
+    return result;
+  } else {
+    Fail("Comparisons evaluate to int.");
+  }
+}
+
+template <typename T>
+std::shared_ptr<ExpressionResult<T>> ExpressionEvaluator::_evaluate_case_expression(const CaseExpression& expression) {
+  const auto when = evaluate_expression_to_result<int32_t>(*expression.when());
+  const auto then = evaluate_expression_to_result<T>(*expression.then());
+  const auto otherwise = evaluate_expression_to_result<T>(*expression.otherwise());
+
+  const auto all_literal = when->is_literal() && then->is_literal() && otherwise->is_literal();
+  const auto row_count = all_literal ? size_t{1} : size_t{_chunk_size};
+  const auto is_nullable = then->is_nullable() || otherwise->is_nullable();
+
+  // Both branches are evaluated for all rows, so the selection is a simple loop without any control flow per branch.
+  auto values = std::pmr::vector<T>(row_count, _memory_resource);
+  auto nulls = std::vector<bool>(is_nullable ? row_count : 0);
+  for (auto row = size_t{0}; row < row_count; ++row) {
+    const auto& branch = (when->value(row) && !when->is_null(row)) ? *then : *otherwise;
+    values[row] = branch.value(row);
+    if (is_nullable) {
+      nulls[row] = branch.is_null(row);
+    }
+  }
+
+  return std::make_shared<ExpressionResult<T>>(std::move(values), std::move(nulls));
+}
+
+template <typename T>
+std::shared_ptr<ExpressionResult<T>> ExpressionEvaluator::_evaluate_cast_expression(const CastExpression& expression) {
+  auto result = std::shared_ptr<ExpressionResult<T>>{};
+  resolve_data_type(expression.argument()->data_type(), [&](auto type) {
+    using ArgumentDataType = typename decltype(type)::type;
+    const auto argument = evaluate_expression_to_result<ArgumentDataType>(*expression.argument());
+    result = convert_result<ArgumentDataType, T>(*argument, _memory_resource);
+  });
+  return result;
+}
+
+#define INSTANTIATE_EVALUATE_EXPRESSION_TO_RESULT(r, data, type)                                          \
+  template std::shared_ptr<ExpressionResult<type>> ExpressionEvaluator::evaluate_expression_to_result<type>( \
+      const AbstractExpression& expression);
+
+BOOST_PP_SEQ_FOR_EACH(INSTANTIATE_EVALUATE_EXPRESSION_TO_RESULT, _, data_types_macro)
+
+}  // namespace opossum
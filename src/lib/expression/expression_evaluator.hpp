@@ -0,0 +1,67 @@
+#pragma once
+
+#include <memory>
+#include <memory_resource>
+#include <unordered_map>
+
+#include "expression_result.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class AbstractExpression;
+class AbstractSegment;
+class ArithmeticExpression;
+class CaseExpression;
+class CastExpression;
+class Chunk;
+class ColumnExpression;
+class ComparisonExpression;
+class QueryMemoryContext;
+class ValueExpression;
+
+// Evaluates expressions for all rows of a chunk at once. Each node of the expression tree is evaluated into a typed
+// ExpressionResult by a kernel that loops over plain vectors, so no AllTypeVariant is created per row. Operands are
+// converted to the type the parent node expects before they are combined. Results and segments are allocated from the
+// memory context, if one is given.
+class ExpressionEvaluator {
+ public:
+  explicit ExpressionEvaluator(const std::shared_ptr<const Chunk>& chunk,
+                               const std::shared_ptr<QueryMemoryContext>& memory_context = nullptr);
+
+  // Returns the result of the expression converted to T.
+  template <typename T>
+  std::shared_ptr<ExpressionResult<T>> evaluate_expression_to_result(const AbstractExpression& expression);
+
+  // Returns the result of the expression as a ValueSegment of the expression's data type with one value per row.
+  std::shared_ptr<AbstractSegment> evaluate_expression_to_segment(const AbstractExpression& expression);
+
+ protected:
+  template <typename T>
+  std::shared_ptr<ExpressionResult<T>> _evaluate_column_expression(const ColumnExpression& expression);
+
+  template <typename T>
+  std::shared_ptr<ExpressionResult<T>> _evaluate_value_expression(const ValueExpression& expression);
+
+  template <typename T>
+  std::shared_ptr<ExpressionResult<T>> _evaluate_arithmetic_expression(const ArithmeticExpression& expression);
+
+  template <typename T>
+  std::shared_ptr<ExpressionResult<T>> _evaluate_comparison_expression(const ComparisonExpression& expression);
+
+  template <typename T>
+  std::shared_ptr<ExpressionResult<T>> _evaluate_case_expression(const CaseExpression& expression);
+
+  template <typename T>
+  std::shared_ptr<ExpressionResult<T>> _evaluate_cast_expression(const CastExpression& expression);
+
+  const std::shared_ptr<const Chunk> _chunk;
+  const ChunkOffset _chunk_size;
+  const std::shared_ptr<QueryMemoryContext> _memory_context;
+  std::pmr::memory_resource* const _memory_resource;
+
+  // Columns that are referenced multiple times in an expression tree are only materialized once.
+  std::unordered_map<ColumnID, std::shared_ptr<BaseExpressionResult>> _column_results;
+};
+
+}  // namespace opossum
@@ -0,0 +1,58 @@
+#include "expression_functional.hpp"
+
+#include "storage/table.hpp"
+
+namespace opossum {
+
+std::shared_ptr<ColumnExpression> column_(const std::shared_ptr<const Table>& table, const ColumnID column_id) {
+  return std::make_shared<ColumnExpression>(column_id, table->column_type(column_id), table->column_nullable(column_id),
+                                            table->column_name(column_id));
+}
+
+std::shared_ptr<ValueExpression> value_(const AllTypeVariant& value) {
+  return std::make_shared<ValueExpression>(value);
+}
+
+std::shared_ptr<ArithmeticExpression> add_(const std::shared_ptr<AbstractExpression>& left,
+                                           const std::shared_ptr<AbstractExpression>& right) {
+  return std::make_shared<ArithmeticExpression>(ArithmeticOperator::Addition, left, right);
+}
+
+std::shared_ptr<ArithmeticExpression> sub_(const std::shared_ptr<AbstractExpression>& left,
+                                           const std::shared_ptr<AbstractExpression>& right) {
+  return std::make_shared<ArithmeticExpression>(ArithmeticOperator::Subtraction, left, right);
+}
+
+std::shared_ptr<ArithmeticExpression> mul_(const std::shared_ptr<AbstractExpression>& left,
+                                           const std::shared_ptr<AbstractExpression>& right) {
+  return std::make_shared<ArithmeticExpression>(ArithmeticOperator::Multiplication, left, right);
+}
+
+std::shared_ptr<ArithmeticExpression> div_(const std::shared_ptr<AbstractExpression>& left,
+                                           const std::shared_ptr<AbstractExpression>& right) {
+  return std::make_shared<ArithmeticExpression>(ArithmeticOperator::Division, left, right);
+}
+
+std::shared_ptr<ArithmeticExpression> mod_(const std::shared_ptr<AbstractExpression>& left,
+                                           const std::shared_ptr<AbstractExpression>& right) {
+  return std::make_shared<ArithmeticExpression>(ArithmeticOperator::Modulo, left, right);
+}
+
+std::shared_ptr<ComparisonExpression> compare_(const std::shared_ptr<AbstractExpression>& left,
+                                               const ScanType scan_type,
+                                               const std::shared_ptr<AbstractExpression>& right) {
+  return std::make_shared<ComparisonExpression>(scan_type, left, right);
+}
+
+std::shared_ptr<CaseExpression> case_(const std::shared_ptr<AbstractExpression>& when,
+                                      const std::shared_ptr<AbstractExpression>& then,
+                                      const std::shared_ptr<AbstractExpression>& otherwise) {
+  return std::make_shared<CaseExpression>(when, then, otherwise);
+}
+
+std::shared_ptr<CastExpression> cast_(const std::shared_ptr<AbstractExpression>& argument,
+                                      const std::string& data_type) {
+  return std::make_shared<CastExpression>(argument, data_type);
+}
+
+}  // namespace opossum
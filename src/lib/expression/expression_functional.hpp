@@ -0,0 +1,47 @@
+#pragma once
+
+#include <memory>
+
+#include "all_type_variant.hpp"
+#include "arithmetic_expression.hpp"
+#include "case_expression.hpp"
+#include "cast_expression.hpp"
+#include "column_expression.hpp"
+#include "comparison_expression.hpp"
+#include "value_expression.hpp"
+
+namespace opossum {
+
+class Table;
+
+/**
+ * Shorthands for building expression trees, e.g.,
+ *   mul_(column_(table, price_id), sub_(value_(1), column_(table, discount_id)))
+ * for `price * (1 - discount)`.
+ */
+std::shared_ptr<ColumnExpression> column_(const std::shared_ptr<const Table>& table, const ColumnID column_id);
+std::shared_ptr<ValueExpression> value_(const AllTypeVariant& value);
+
+std::shared_ptr<ArithmeticExpression> add_(const std::shared_ptr<AbstractExpression>& left,
+                                           const std::shared_ptr<AbstractExpression>& right);
+std::shared_ptr<ArithmeticExpression> sub_(const std::shared_ptr<AbstractExpression>& left,
+                                           const std::shared_ptr<AbstractExpression>& right);
+std::shared_ptr<ArithmeticExpression> mul_(const std::shared_ptr<AbstractExpression>& left,
+                                           const std::shared_ptr<AbstractExpression>& right);
+std::shared_ptr<ArithmeticExpression> div_(const std::shared_ptr<AbstractExpression>& left,
+                                           const std::shared_ptr<AbstractExpression>& right);
+std::shared_ptr<ArithmeticExpression> mod_(const std::shared_ptr<AbstractExpression>& left,
+                                           const std::shared_ptr<AbstractExpression>& right);
+
+std::shared_ptr<ComparisonExpression> compare_(const std::shared_ptr<AbstractExpression>& left,
+                                               const ScanType scan_type,
+                                               const std::shared_ptr<AbstractExpression>& right);
+
+std::shared_ptr<CaseExpression> case_(const std::shared_ptr<AbstractExpression>& when,
+                                      const std::shared_ptr<AbstractExpression>& then,
+                                      const std::shared_ptr<AbstractExpression>& otherwise);
+
+std::shared_ptr<CastExpression> cast_(const std::shared_ptr<AbstractExpression>& argument,
+                                      const std::string& data_type);
+
+}  // namespace opossum
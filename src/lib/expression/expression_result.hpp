@@ -0,0 +1,51 @@
+#pragma once
+
+#include <memory_resource>
+#include <vector>
+
+#include "types.hpp"
+
+namespace opossum {
+
+// Non-templated base class so that results of different types can be stored together.
+class BaseExpressionResult {
+ public:
+  virtual ~BaseExpressionResult() = default;
+};
+
+// The typed result of evaluating an expression for the rows of a chunk. A result either holds one entry per row or a
+// single entry that applies to all rows (e.g., the result of a literal), so literals are never expanded to the size
+// of the chunk.
+template <typename T>
+class ExpressionResult : public BaseExpressionResult {
+ public:
+  ExpressionResult() = default;
+  ExpressionResult(std::pmr::vector<T>&& init_values, std::vector<bool>&& init_nulls)
+      : values(std::move(init_values)), nulls(std::move(init_nulls)) {}
+
+  bool is_literal() const {
+    return values.size() == 1;
+  }
+
+  bool is_nullable() const {
+    return !nulls.empty();
+  }
+
+  // Returns the value at the given row, broadcasting literals. Kernels that need to be fast check is_literal() once
+  // and access `values` directly instead.
+  const T& value(const size_t row) const {
+    return values[is_literal() ? 0 : row];
+  }
+
+  bool is_null(const size_t row) const {
+    return is_nullable() && nulls[nulls.size() == 1 ? 0 : row];
+  }
+
+  // NULL rows hold a value-initialized T. A std::pmr::vector, so that it can be moved into a ValueSegment.
+  std::pmr::vector<T> values;
+
+  // Empty if the result contains no NULLs, otherwise one entry per entry in `values`.
+  std::vector<bool> nulls;
+};
+
+}  // namespace opossum
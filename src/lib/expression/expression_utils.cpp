@@ -0,0 +1,31 @@
+#include "expression_utils.hpp"
+
+#include <algorithm>
+#include <array>
+
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+std::string expression_common_type(const std::string& lhs_data_type, const std::string& rhs_data_type) {
+  if (lhs_data_type == rhs_data_type) {
+    return lhs_data_type;
+  }
+
+  Assert(lhs_data_type != "string" && rhs_data_type != "string",
+         "Cannot combine " + lhs_data_type + " with " + rhs_data_type + ".");
+
+  // Numeric types ordered by the range of values they can represent. A float cannot represent all longs, so that
+  // combination is widened to double.
+  static const auto numeric_types = std::array<std::string, 4>{"int", "long", "float", "double"};
+  if ((lhs_data_type == "long" && rhs_data_type == "float") || (lhs_data_type == "float" && rhs_data_type == "long")) {
+    return "double";
+  }
+
+  const auto lhs_rank = std::find(numeric_types.cbegin(), numeric_types.cend(), lhs_data_type);
+  const auto rhs_rank = std::find(numeric_types.cbegin(), numeric_types.cend(), rhs_data_type);
+  Assert(lhs_rank != numeric_types.cend() && rhs_rank != numeric_types.cend(), "Unknown data type.");
+  return *std::max(lhs_rank, rhs_rank);
+}
+
+}  // namespace opossum
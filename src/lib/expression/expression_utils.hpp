@@ -0,0 +1,11 @@
+#pragma once
+
+#include <string>
+
+namespace opossum {
+
+// Returns the data type that two operands are converted to before they are combined, e.g., "double" for "int" and
+// "double". Strings can only be combined with strings.
+std::string expression_common_type(const std::string& lhs_data_type, const std::string& rhs_data_type);
+
+}  // namespace opossum
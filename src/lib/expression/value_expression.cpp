@@ -0,0 +1,33 @@
+#include "value_expression.hpp"
+
+#include <sstream>
+
+#include "resolve_type.hpp"
+
+namespace opossum {
+
+ValueExpression::ValueExpression(const AllTypeVariant& init_value)
+    : AbstractExpression(ExpressionType::Value, {}), value(init_value) {}
+
+std::string ValueExpression::description() const {
+  auto stream = std::stringstream{};
+  if (value.type() == typeid(std::string)) {
+    stream << "'" << value << "'";
+  } else {
+    stream << value;
+  }
+  return stream.str();
+}
+
+std::string ValueExpression::data_type() const {
+  if (variant_is_null(value)) {
+    return "int";
+  }
+  return data_type_from_all_type_variant(value);
+}
+
+bool ValueExpression::is_nullable() const {
+  return variant_is_null(value);
+}
+
+}  // namespace opossum
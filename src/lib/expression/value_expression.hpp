@@ -0,0 +1,20 @@
+#pragma once
+
+#include "abstract_expression.hpp"
+#include "all_type_variant.hpp"
+
+namespace opossum {
+
+// A literal, e.g., the 1 in `1 - discount`. A NULL literal has the data type "int".
+class ValueExpression : public AbstractExpression {
+ public:
+  explicit ValueExpression(const AllTypeVariant& init_value);
+
+  std::string description() const override;
+  std::string data_type() const override;
+  bool is_nullable() const override;
+
+  const AllTypeVariant value;
+};
+
+}  // namespace opossum
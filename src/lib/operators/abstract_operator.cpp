@@ -1,5 +1,15 @@
 #include "abstract_operator.hpp"
 
+#include <typeinfo>
+
+#include <boost/core/demangle.hpp>
+
+#include "storage/chunk.hpp"
+#include "storage/query_memory_context.hpp"
+#include "storage/table.hpp"
+#include "utils/assert.hpp"
+#include "utils/tracer.hpp"
+
 namespace opossum {
 
 AbstractOperator::AbstractOperator(const std::shared_ptr<const AbstractOperator> left,
@@ -7,7 +17,61 @@ AbstractOperator::AbstractOperator(const std::shared_ptr<const AbstractOperator>
     : _left_input(left), _right_input(right) {}
 
 void AbstractOperator::execute() {
+  _adopt_memory_context();
+
+  auto performance_data = OperatorPerformanceData{};
+  for (const auto& input : {_left_input, _right_input}) {
+    if (input && input->get_output()) {
+      performance_data.input_row_count += input->get_output()->row_count();
+      performance_data.input_chunk_count += input->get_output()->chunk_count();
+    }
+  }
+
+  // The name is only determined if the operator is traced.
+  auto trace_scope = TraceScope{Tracer::is_enabled() ? name() : std::string{}, "operator", "output_rows"};
+  const auto allocated_bytes_before = _memory_context ? _memory_context->cumulative_allocated_bytes() : size_t{0};
+  const auto performance_counters_before =
+      _performance_counters_enabled.load() ? PerformanceCounters::read() : std::nullopt;
+  const auto cpu_time_before = process_cpu_time();
+  const auto walltime_before = std::chrono::steady_clock::now();
+
   _output = _on_execute();
+
+  performance_data.walltime = std::chrono::steady_clock::now() - walltime_before;
+  performance_data.cpu_time = process_cpu_time() - cpu_time_before;
+  if (performance_counters_before) {
+    const auto performance_counters_after = PerformanceCounters::read();
+    if (performance_counters_after) {
+      performance_data.performance_counters = *performance_counters_after - *performance_counters_before;
+    }
+  }
+  if (_memory_context) {
+    performance_data.allocated_bytes = _memory_context->cumulative_allocated_bytes() - allocated_bytes_before;
+  }
+  if (_output) {
+    performance_data.output_row_count = _output->row_count();
+    performance_data.output_chunk_count = _output->chunk_count();
+    trace_scope.set_argument(static_cast<int64_t>(performance_data.output_row_count));
+  }
+  performance_data.executed = true;
+  _performance_data = performance_data;
+}
+
+void AbstractOperator::set_performance_counters_enabled(const bool enabled) {
+  _performance_counters_enabled.store(enabled);
+}
+
+bool AbstractOperator::performance_counters_enabled() {
+  return _performance_counters_enabled.load();
+}
+
+std::string AbstractOperator::name() const {
+  const auto class_name = boost::core::demangle(typeid(*this).name());
+  return class_name.substr(class_name.rfind(':') + 1);
+}
+
+bool AbstractOperator::is_pipelineable() const {
+  return false;
 }
 
 std::shared_ptr<const Table> AbstractOperator::get_output() const {
@@ -16,6 +80,26 @@ std::shared_ptr<const Table> AbstractOperator::get_output() const {
   return _output;
 }
 
+std::shared_ptr<const AbstractOperator> AbstractOperator::left_input() const {
+  return _left_input;
+}
+
+std::shared_ptr<const AbstractOperator> AbstractOperator::right_input() const {
+  return _right_input;
+}
+
+void AbstractOperator::set_memory_context(const std::shared_ptr<QueryMemoryContext>& memory_context) {
+  _memory_context = memory_context;
+}
+
+const std::shared_ptr<QueryMemoryContext>& AbstractOperator::memory_context() const {
+  return _memory_context;
+}
+
+const OperatorPerformanceData& AbstractOperator::performance_data() const {
+  return _performance_data;
+}
+
 std::shared_ptr<const Table> AbstractOperator::_left_input_table() const {
   return _left_input->get_output();
 }
@@ -24,4 +108,38 @@ std::shared_ptr<const Table> AbstractOperator::_right_input_table() const {
   return _right_input->get_output();
 }
 
+std::shared_ptr<Table> AbstractOperator::_create_output_table(
+    const std::shared_ptr<const Table>& /*input_table*/) const {
+  Fail(name() + " is not pipelineable.");
+}
+
+std::shared_ptr<Chunk> AbstractOperator::_on_execute_chunk(const std::shared_ptr<const Table>& /*input_table*/,
+                                                           const ChunkID /*chunk_id*/) const {
+  Fail(name() + " is not pipelineable.");
+}
+
+std::shared_ptr<const Table> AbstractOperator::_execute_chunk_by_chunk() const {
+  const auto input_table = _left_input_table();
+  auto output_table = _create_output_table(input_table);
+  const auto chunk_count = input_table->chunk_count();
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    if (const auto output_chunk = _on_execute_chunk(input_table, chunk_id)) {
+      output_table->emplace_chunk(output_chunk);
+    }
+  }
+  return output_table;
+}
+
+void AbstractOperator::_adopt_memory_context() {
+  for (const auto& input : {_left_input, _right_input}) {
+    if (!_memory_context && input) {
+      _memory_context = input->memory_context();
+    }
+  }
+}
+
+std::pmr::memory_resource* AbstractOperator::_memory_resource() const {
+  return get_memory_resource(_memory_context);
+}
+
 }  // namespace opossum
@@ -1,11 +1,19 @@
 #pragma once
 
+#include <atomic>
+#include <chrono>
 #include <memory>
+#include <memory_resource>
+#include <optional>
+#include <string>
 
 #include "types.hpp"
+#include "utils/performance_counters.hpp"
 
 namespace opossum {
 
+class Chunk;
+class QueryMemoryContext;
 class Table;
 
 // AbstractOperator is the abstract super class for all operators. All operators have up to two input tables and one
@@ -18,6 +26,35 @@ class Table;
 // succeed if execute was called before. Otherwise, a nullptr or an empty table could be returned.
 //
 // Operators shall not be executed twice.
+//
+// Operators allocate their intermediate results from the QueryMemoryContext of their query, if they have one. An
+// operator without a memory context takes the one of its inputs when it is executed, so it suffices to set it on the
+// leaves of a query plan.
+//
+// execute records the OperatorPerformanceData of the operator, which ExplainAnalyze prints for a whole plan.
+//
+// Operators that process each chunk of their input on its own, e.g., scans and projections, can be pipelineable. A
+// Pipeline then pushes each chunk of a plan's source through several of them without materializing the complete
+// intermediate results in between (see Pipeline).
+
+// What an operator did during execute. Row and chunk counts of the inputs are summed over both inputs.
+struct OperatorPerformanceData {
+  bool executed = false;
+  std::chrono::nanoseconds walltime{0};
+  // The CPU time of the whole process, so that the work of the threads an operator spawns is included. Concurrently
+  // running queries are included as well.
+  std::chrono::nanoseconds cpu_time{0};
+  size_t input_row_count = 0;
+  size_t input_chunk_count = 0;
+  size_t output_row_count = 0;
+  size_t output_chunk_count = 0;
+  // The bytes that the operator's memory context took from the heap during execute (see
+  // QueryMemoryContext::cumulative_allocated_bytes), or 0 if the operator has no memory context.
+  size_t allocated_bytes = 0;
+  // The hardware events of the executing thread, if sampling them is enabled and available (see
+  // AbstractOperator::set_performance_counters_enabled).
+  std::optional<PerformanceCounterValues> performance_counters;
+};
 
 class AbstractOperator : private Noncopyable {
  public:
@@ -32,6 +69,19 @@ class AbstractOperator : private Noncopyable {
 
   void execute();
 
+  // Sets whether execute also samples the hardware performance counters (see PerformanceCounters). This is off by
+  // default, since it costs two system calls per operator.
+  static void set_performance_counters_enabled(const bool enabled);
+
+  static bool performance_counters_enabled();
+
+  // Returns the name of the operator, i.e., the name of its class.
+  virtual std::string name() const;
+
+  // Returns whether the operator implements _create_output_table and _on_execute_chunk, so that a Pipeline can execute
+  // it one chunk at a time.
+  virtual bool is_pipelineable() const;
+
   // Returns the result of the operator.
   std::shared_ptr<const Table> get_output() const;
 
@@ -39,21 +89,55 @@ class AbstractOperator : private Noncopyable {
   std::shared_ptr<const AbstractOperator> left_input() const;
   std::shared_ptr<const AbstractOperator> right_input() const;
 
+  void set_memory_context(const std::shared_ptr<QueryMemoryContext>& memory_context);
+
+  // Returns the memory context of the operator's query, or nullptr if there is none.
+  const std::shared_ptr<QueryMemoryContext>& memory_context() const;
+
+  // Returns the measurements of the last execute call. executed is false if the operator was not executed yet.
+  const OperatorPerformanceData& performance_data() const;
+
  protected:
   // Abstract method to actually execute the operator execute and get_output are split into two methods to allow for
   // easier asynchronous execution.
   virtual std::shared_ptr<const Table> _on_execute() = 0;
 
+  friend class Pipeline;
+
+  // Returns the empty output table of a pipelineable operator for the given input table.
+  virtual std::shared_ptr<Table> _create_output_table(const std::shared_ptr<const Table>& input_table) const;
+
+  // Returns the output chunk of a pipelineable operator for the given input chunk, or nullptr if it has no rows. Must
+  // not depend on the other chunks of the input.
+  virtual std::shared_ptr<Chunk> _on_execute_chunk(const std::shared_ptr<const Table>& input_table,
+                                                   const ChunkID chunk_id) const;
+
+  // Executes a pipelineable operator on its complete left input, i.e., _on_execute_chunk for each chunk.
+  std::shared_ptr<const Table> _execute_chunk_by_chunk() const;
+
+  // Takes the memory context of the inputs if the operator has none.
+  void _adopt_memory_context();
+
   std::shared_ptr<const Table> _left_input_table() const;
   std::shared_ptr<const Table> _right_input_table() const;
 
+  // Returns the memory resource to allocate intermediate results from, i.e., the one of the memory context or the
+  // default resource.
+  std::pmr::memory_resource* _memory_resource() const;
+
   // Shared pointers to input operators. Can be nullptr, for example, if an operator is the leaf operator in the query
   // plan or if the operator has only one input operator.
   std::shared_ptr<const AbstractOperator> _left_input;
   std::shared_ptr<const AbstractOperator> _right_input;
 
+  std::shared_ptr<QueryMemoryContext> _memory_context;
+
   // Is nullptr until the operator is executed.
   std::shared_ptr<const Table> _output;
+
+  OperatorPerformanceData _performance_data;
+
+  inline static std::atomic<bool> _performance_counters_enabled{false};
 };
 
 }  // namespace opossum
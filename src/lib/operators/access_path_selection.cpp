@@ -0,0 +1,93 @@
+#include "access_path_selection.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <limits>
+#include <memory>
+#include <numeric>
+#include <random>
+#include <vector>
+
+#include "scan_utils.hpp"
+#include "storage/chunk.hpp"
+#include "storage/index/sorted_index.hpp"
+#include "storage/table.hpp"
+#include "storage/value_segment.hpp"
+#include "utils/assert.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT(build/namespaces)
+
+constexpr auto CALIBRATION_ROW_COUNT = ChunkOffset{1} << 16;
+constexpr auto CALIBRATION_RUNS = 3;
+
+std::atomic<float> index_selectivity_threshold_value{DEFAULT_INDEX_SELECTIVITY_THRESHOLD};
+
+// Returns the shortest of CALIBRATION_RUNS runs of `function` in nanoseconds.
+template <typename Function>
+int64_t fastest_run(const Function& function) {
+  auto fastest = std::numeric_limits<int64_t>::max();
+  for (auto run = 0; run < CALIBRATION_RUNS; ++run) {
+    const auto begin = std::chrono::steady_clock::now();
+    const auto selection = function();
+    const auto end = std::chrono::steady_clock::now();
+    // The selection is used so that the work cannot be optimized away.
+    Assert(selection.size() <= CALIBRATION_ROW_COUNT, "Unexpected selection size.");
+    fastest = std::min(fastest, std::chrono::duration_cast<std::chrono::nanoseconds>(end - begin).count());
+  }
+  return fastest;
+}
+
+}  // namespace
+
+namespace opossum {
+
+bool prefer_index_lookup(const size_t match_count, const ChunkOffset chunk_size) {
+  const auto threshold = index_selectivity_threshold();
+  return threshold > 0.0f && static_cast<float>(match_count) <= threshold * static_cast<float>(chunk_size);
+}
+
+float index_selectivity_threshold() {
+  return index_selectivity_threshold_value.load();
+}
+
+void set_index_selectivity_threshold(const float threshold) {
+  Assert(threshold >= 0.0f && threshold <= 1.0f, "Threshold has to be a fraction of rows.");
+  index_selectivity_threshold_value.store(threshold);
+}
+
+float calibrate_index_selectivity_threshold() {
+  // A permutation of 0, ..., CALIBRATION_ROW_COUNT - 1, so that `value < n` selects n randomly distributed rows.
+  auto values = std::vector<int32_t>(CALIBRATION_ROW_COUNT);
+  std::iota(values.begin(), values.end(), 0);
+  std::shuffle(values.begin(), values.end(), std::mt19937{42});
+
+  const auto segment = std::make_shared<ValueSegment<int32_t>>(false);
+  for (const auto value : values) {
+    segment->append(value);
+  }
+  const auto chunk = std::make_shared<Chunk>();
+  chunk->add_segment(segment);
+  auto table = Table{CALIBRATION_ROW_COUNT};
+  table.add_column("a", "int", false);
+  table.emplace_chunk(chunk);
+
+  // The chunk of the table has no index, so scan_chunk scans it.
+  const auto index = SortedIndex{{segment}};
+
+  auto threshold = 0.0f;
+  for (auto match_count = CALIBRATION_ROW_COUNT / 4096; match_count <= CALIBRATION_ROW_COUNT / 2; match_count *= 2) {
+    const auto predicate = ScanPredicate{ColumnID{0}, ScanType::OpLessThan, static_cast<int32_t>(match_count)};
+    const auto scan_time = fastest_run([&] { return scan_chunk(table, ChunkID{0}, {predicate}); });
+    const auto index_time = fastest_run([&] { return scan_chunk_with_index(index, predicate); });
+    if (index_time >= scan_time) {
+      break;
+    }
+    threshold = static_cast<float>(match_count) / static_cast<float>(CALIBRATION_ROW_COUNT);
+  }
+  return threshold;
+}
+
+}  // namespace opossum
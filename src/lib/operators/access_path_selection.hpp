@@ -0,0 +1,35 @@
+#pragma once
+
+#include <cstddef>
+
+#include "types.hpp"
+
+namespace opossum {
+
+// Whether the rows of a chunk that satisfy a predicate are retrieved through an index or by scanning the chunk is
+// decided per chunk. Two lookups in the index (lower_bound and upper_bound) yield the exact number of qualifying rows.
+// Retrieving them through the index costs a random access and a sort per row, while a scan costs a sequential
+// comparison per row of the chunk. The index is therefore only used if the fraction of qualifying rows is below a
+// threshold, which depends on the hardware and can be calibrated by timing both access paths. Calibrating takes a few
+// milliseconds, so it is done explicitly at startup, e.g., by the benchmark runners, and not during a query.
+
+// The fraction of rows below which index lookups are typically faster than scans.
+constexpr auto DEFAULT_INDEX_SELECTIVITY_THRESHOLD = 0.01f;
+
+// Returns whether `match_count` qualifying rows of a chunk with `chunk_size` rows should be retrieved through the
+// index, i.e., whether match_count / chunk_size is at most index_selectivity_threshold(). Always false for a threshold
+// of 0.
+bool prefer_index_lookup(const size_t match_count, const ChunkOffset chunk_size);
+
+// Returns the fraction of a chunk's rows up to which an index lookup is faster than a scan. Unless it was set
+// explicitly, this is DEFAULT_INDEX_SELECTIVITY_THRESHOLD.
+float index_selectivity_threshold();
+
+// Sets the threshold, e.g., to the calibrated one. 0 disables index lookups, 1 always uses them.
+void set_index_selectivity_threshold(const float threshold);
+
+// Times a scan and a SortedIndex lookup on a synthetic chunk of 64K integers for selectivities from 1/4096 to 1/2 and
+// returns the largest selectivity for which the index lookup was faster. Does not set the threshold.
+float calibrate_index_selectivity_threshold();
+
+}  // namespace opossum
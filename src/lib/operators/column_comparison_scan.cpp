@@ -0,0 +1,54 @@
+#include "column_comparison_scan.hpp"
+
+#include "scan_utils.hpp"
+#include "storage/table.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+ColumnComparisonScan::ColumnComparisonScan(const std::shared_ptr<const AbstractOperator>& in,
+                                           const ColumnID left_column_id, const ScanType scan_type,
+                                           const ColumnID right_column_id)
+    : AbstractOperator(in),
+      _left_column_id(left_column_id),
+      _scan_type(scan_type),
+      _right_column_id(right_column_id) {
+  Assert(scan_type != ScanType::OpBetween && scan_type != ScanType::OpIn && scan_type != ScanType::OpLike,
+         "ColumnComparisonScan only supports binary comparisons.");
+}
+
+ColumnID ColumnComparisonScan::left_column_id() const {
+  return _left_column_id;
+}
+
+ScanType ColumnComparisonScan::scan_type() const {
+  return _scan_type;
+}
+
+ColumnID ColumnComparisonScan::right_column_id() const {
+  return _right_column_id;
+}
+
+bool ColumnComparisonScan::is_pipelineable() const {
+  return true;
+}
+
+std::shared_ptr<const Table> ColumnComparisonScan::_on_execute() {
+  return _execute_chunk_by_chunk();
+}
+
+std::shared_ptr<Table> ColumnComparisonScan::_create_output_table(
+    const std::shared_ptr<const Table>& input_table) const {
+  Assert(_left_column_id < input_table->column_count() && _right_column_id < input_table->column_count(),
+         "Column ID out of range.");
+  return create_reference_table(*input_table, _memory_context);
+}
+
+std::shared_ptr<Chunk> ColumnComparisonScan::_on_execute_chunk(const std::shared_ptr<const Table>& input_table,
+                                                               const ChunkID chunk_id) const {
+  const auto selection =
+      scan_chunk_column_comparison(*input_table, chunk_id, _left_column_id, _scan_type, _right_column_id);
+  return reference_selected_rows_of_chunk(input_table, chunk_id, selection, _memory_context);
+}
+
+}  // namespace opossum
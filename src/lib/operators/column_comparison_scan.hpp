@@ -0,0 +1,41 @@
+#pragma once
+
+#include "abstract_operator.hpp"
+
+namespace opossum {
+
+/**
+ * Operator that selects all rows for which `left_column <scan_type> right_column` holds, e.g., shipdate < commitdate.
+ * A kernel is instantiated for each combination of the two column types and the ScanType, so both segments of a chunk
+ * are compared in lockstep on their typed values. Numeric columns of different types can be compared with each other,
+ * strings only with strings. Rows where either column is NULL never qualify.
+ *
+ * The output consists of ReferenceSegments, just like the output of TableScan.
+ */
+class ColumnComparisonScan : public AbstractOperator {
+ public:
+  ColumnComparisonScan(const std::shared_ptr<const AbstractOperator>& in, const ColumnID left_column_id,
+                       const ScanType scan_type, const ColumnID right_column_id);
+
+  ColumnID left_column_id() const;
+
+  ScanType scan_type() const;
+
+  ColumnID right_column_id() const;
+
+  bool is_pipelineable() const override;
+
+ protected:
+  std::shared_ptr<const Table> _on_execute() override;
+
+  std::shared_ptr<Table> _create_output_table(const std::shared_ptr<const Table>& input_table) const override;
+
+  std::shared_ptr<Chunk> _on_execute_chunk(const std::shared_ptr<const Table>& input_table,
+                                           const ChunkID chunk_id) const override;
+
+  const ColumnID _left_column_id;
+  const ScanType _scan_type;
+  const ColumnID _right_column_id;
+};
+
+}  // namespace opossum
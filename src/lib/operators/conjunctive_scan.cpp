@@ -0,0 +1,37 @@
+#include "conjunctive_scan.hpp"
+
+#include "storage/table.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+ConjunctiveScan::ConjunctiveScan(const std::shared_ptr<const AbstractOperator>& in,
+                                 const std::vector<ScanPredicate>& predicates)
+    : AbstractOperator(in), _predicates(predicates) {}
+
+const std::vector<ScanPredicate>& ConjunctiveScan::predicates() const {
+  return _predicates;
+}
+
+bool ConjunctiveScan::is_pipelineable() const {
+  return true;
+}
+
+std::shared_ptr<const Table> ConjunctiveScan::_on_execute() {
+  return _execute_chunk_by_chunk();
+}
+
+std::shared_ptr<Table> ConjunctiveScan::_create_output_table(const std::shared_ptr<const Table>& input_table) const {
+  for (const auto& predicate : _predicates) {
+    Assert(predicate.column_id < input_table->column_count(), "Column ID out of range.");
+  }
+  return create_reference_table(*input_table, _memory_context);
+}
+
+std::shared_ptr<Chunk> ConjunctiveScan::_on_execute_chunk(const std::shared_ptr<const Table>& input_table,
+                                                          const ChunkID chunk_id) const {
+  const auto selection = scan_chunk(*input_table, chunk_id, _predicates);
+  return reference_selected_rows_of_chunk(input_table, chunk_id, selection, _memory_context);
+}
+
+}  // namespace opossum
@@ -0,0 +1,39 @@
+#pragma once
+
+#include <vector>
+
+#include "abstract_operator.hpp"
+#include "scan_utils.hpp"
+
+namespace opossum {
+
+/**
+ * Operator that selects all rows satisfying a conjunction of predicates, e.g., a > 5 AND b BETWEEN 1 AND 3 AND c = 'x'.
+ * Compared to chaining one TableScan per predicate, all predicates are evaluated in a single pass over each chunk: a
+ * selection vector holds the offsets that passed the predicates so far, and only the final one is turned into a
+ * PosList. Per chunk, the predicates are ordered by their estimated selectivity (see estimate_selectivity) so that the
+ * most selective one shrinks the selection vector first. Predicates that an index of the chunk can answer, e.g., a
+ * CompositeIndex on (tenant_id, entity_id) for tenant_id = 3 AND entity_id = 42, are looked up in the index instead.
+ *
+ * The output consists of ReferenceSegments, just like the output of TableScan.
+ */
+class ConjunctiveScan : public AbstractOperator {
+ public:
+  ConjunctiveScan(const std::shared_ptr<const AbstractOperator>& in, const std::vector<ScanPredicate>& predicates);
+
+  const std::vector<ScanPredicate>& predicates() const;
+
+  bool is_pipelineable() const override;
+
+ protected:
+  std::shared_ptr<const Table> _on_execute() override;
+
+  std::shared_ptr<Table> _create_output_table(const std::shared_ptr<const Table>& input_table) const override;
+
+  std::shared_ptr<Chunk> _on_execute_chunk(const std::shared_ptr<const Table>& input_table,
+                                           const ChunkID chunk_id) const override;
+
+  const std::vector<ScanPredicate> _predicates;
+};
+
+}  // namespace opossum
@@ -0,0 +1,115 @@
+#include "explain_analyze.hpp"
+
+#include <iomanip>
+#include <unordered_map>
+
+#include "storage/query_memory_context.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT(build/namespaces)
+
+// Prints the durations, the allocated memory, and the hardware events, if they were counted.
+void print_measurements(std::ostream& out, const OperatorPerformanceData& performance_data) {
+  const auto milliseconds = [](const std::chrono::nanoseconds duration) {
+    return std::chrono::duration<double, std::milli>(duration).count();
+  };
+  out << std::fixed << std::setprecision(3) << " | walltime: " << milliseconds(performance_data.walltime)
+      << " ms | cpu: " << milliseconds(performance_data.cpu_time) << " ms" << std::defaultfloat
+      << " | allocated: " << performance_data.allocated_bytes << " bytes";
+
+  if (const auto& counters = performance_data.performance_counters) {
+    out << " | cycles: " << counters->cycles << " | instructions: " << counters->instructions << std::fixed
+        << std::setprecision(2) << " | IPC: " << counters->instructions_per_cycle() << std::defaultfloat
+        << " | cache misses: " << counters->cache_misses << " | branch misses: " << counters->branch_misses;
+  }
+}
+
+// Counts how many operators of the plan consume each operator.
+void count_consumers(const AbstractOperator& op, std::unordered_map<const AbstractOperator*, size_t>& consumer_counts) {
+  for (const auto& input : {op.left_input(), op.right_input()}) {
+    if (input && ++consumer_counts[input.get()] == 1) {
+      count_consumers(*input, consumer_counts);
+    }
+  }
+}
+
+// The operators of a plan that have several consumers and, once they are printed, their numbers.
+struct SharedOperators {
+  std::unordered_map<const AbstractOperator*, size_t> consumer_counts{};
+  std::unordered_map<const AbstractOperator*, size_t> numbers{};
+};
+
+// Prints the operator and, indented below it, its inputs. Adds the numbers of all operators to total. An operator with
+// several consumers is printed once with a number, e.g., "TableScan #1", and then only referenced, e.g.,
+// "-> TableScan #1", so that it is not counted twice.
+void print_operator(std::ostream& out, const AbstractOperator& op, const size_t depth, OperatorPerformanceData& total,
+                    SharedOperators& shared_operators) {
+  out << std::string(2 * depth, ' ');
+  if (shared_operators.consumer_counts[&op] > 1) {
+    const auto [shared_operator_iter, is_first_consumer] =
+        shared_operators.numbers.try_emplace(&op, shared_operators.numbers.size() + 1);
+    if (!is_first_consumer) {
+      out << "-> " << op.name() << " #" << shared_operator_iter->second << std::endl;
+      return;
+    }
+    out << op.name() << " #" << shared_operator_iter->second;
+  } else {
+    out << op.name();
+  }
+
+  const auto& performance_data = op.performance_data();
+  if (performance_data.executed) {
+    out << " | rows: " << performance_data.input_row_count << " -> " << performance_data.output_row_count
+        << " | chunks: " << performance_data.input_chunk_count << " -> " << performance_data.output_chunk_count;
+    print_measurements(out, performance_data);
+
+    total.walltime += performance_data.walltime;
+    total.cpu_time += performance_data.cpu_time;
+    total.allocated_bytes += performance_data.allocated_bytes;
+    if (performance_data.performance_counters) {
+      if (!total.performance_counters) {
+        total.performance_counters = PerformanceCounterValues{};
+      }
+      *total.performance_counters += *performance_data.performance_counters;
+    }
+  } else {
+    out << " | not executed";
+  }
+  out << std::endl;
+
+  for (const auto& input : {op.left_input(), op.right_input()}) {
+    if (input) {
+      print_operator(out, *input, depth + 1, total, shared_operators);
+    }
+  }
+}
+
+}  // namespace
+
+namespace opossum {
+
+ExplainAnalyze::ExplainAnalyze(const std::shared_ptr<const AbstractOperator> in, std::ostream& out)
+    : AbstractOperator(in), _out(out) {}
+
+void ExplainAnalyze::explain(const std::shared_ptr<const AbstractOperator>& root, std::ostream& out) {
+  auto total = OperatorPerformanceData{};
+  out << "=== Plan" << std::endl;
+  auto shared_operators = SharedOperators{};
+  count_consumers(*root, shared_operators.consumer_counts);
+  print_operator(out, *root, 0, total, shared_operators);
+  out << "=== Total";
+  print_measurements(out, total);
+  // The operators of a query share its memory context.
+  if (const auto& memory_context = root->memory_context()) {
+    out << " | peak allocated: " << memory_context->peak_allocated_bytes() << " bytes";
+  }
+  out << std::endl;
+}
+
+std::shared_ptr<const Table> ExplainAnalyze::_on_execute() {
+  explain(_left_input, _out);
+  return _left_input_table();
+}
+
+}  // namespace opossum
@@ -0,0 +1,40 @@
+#pragma once
+
+#include <iostream>
+#include <memory>
+#include <string>
+
+#include "abstract_operator.hpp"
+
+namespace opossum {
+
+/**
+ * Operator to print the plan of its input with the OperatorPerformanceData of each operator, e.g.,
+ *
+ *   === Plan
+ *   TableScan | rows: 1000 -> 42 | chunks: 1 -> 1 | walltime: 0.120 ms | cpu: 0.118 ms | allocated: 1024 bytes
+ *     TableWrapper | rows: 0 -> 1000 | chunks: 0 -> 1 | walltime: 0.001 ms | cpu: 0.001 ms | allocated: 0 bytes
+ *   === Total | walltime: 0.121 ms | cpu: 0.119 ms | allocated: 1024 bytes | peak allocated: 1024 bytes
+ *
+ * If the operators sampled the hardware performance counters, their cycles, instructions, instructions per cycle, cache
+ * misses, and branch misses follow. Inputs are indented below the operator that consumes them. An input with several
+ * consumers is printed below the first one with a number, e.g., "TableScan #1", and only referenced below the others,
+ * e.g., "-> TableScan #1". As the operators of a plan are executed one after another, the numbers of an operator do not
+ * include those of its inputs, and the total is their sum. If the query has a memory context, the total includes the most
+ * memory that its intermediate results held at the same time (see QueryMemoryContext::peak_allocated_bytes).
+ */
+class ExplainAnalyze : public AbstractOperator {
+ public:
+  explicit ExplainAnalyze(const std::shared_ptr<const AbstractOperator> in, std::ostream& out = std::cout);
+
+  // Prints the plan rooted at the given operator, which should already be executed.
+  static void explain(const std::shared_ptr<const AbstractOperator>& root, std::ostream& out = std::cout);
+
+ protected:
+  std::shared_ptr<const Table> _on_execute() override;
+
+  // stream to print the plan
+  std::ostream& _out;
+};
+
+}  // namespace opossum
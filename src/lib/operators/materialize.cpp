@@ -0,0 +1,236 @@
+#include "materialize.hpp"
+
+#include <algorithm>
+#include <iterator>
+#include <memory>
+#include <memory_resource>
+#include <optional>
+#include <vector>
+
+#include "resolve_type.hpp"
+#include "storage/dictionary_segment.hpp"
+#include "storage/materialize.hpp"
+#include "storage/reference_segment.hpp"
+#include "storage/table.hpp"
+#include "storage/value_segment.hpp"
+#include "utils/assert.hpp"
+#include "utils/run_in_parallel.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT(build/namespaces)
+
+// Maps the rows of the input chunks to output chunks. Input rows are numbered consecutively across all input chunks,
+// and output chunk i holds the rows [i * target_chunk_size, (i + 1) * target_chunk_size).
+struct ChunkLayout {
+  ChunkLayout(const Table& input_table, const ChunkOffset init_target_chunk_size)
+      : target_chunk_size(init_target_chunk_size) {
+    const auto input_chunk_count = input_table.chunk_count();
+    input_chunk_begins.resize(input_chunk_count + 1);
+    for (auto chunk_id = ChunkID{0}; chunk_id < input_chunk_count; ++chunk_id) {
+      input_chunk_begins[chunk_id + 1] = input_chunk_begins[chunk_id] + input_table.get_chunk(chunk_id)->size();
+    }
+
+    const auto row_count = input_chunk_begins.back();
+    output_chunk_count = static_cast<ChunkID::base_type>((row_count + target_chunk_size - 1) / target_chunk_size);
+    matching_input_chunks.resize(output_chunk_count);
+    for (auto chunk_id = ChunkID{0}; chunk_id < input_chunk_count; ++chunk_id) {
+      const auto begin = input_chunk_begins[chunk_id];
+      const auto end = input_chunk_begins[chunk_id + 1];
+      if (end > begin && begin % target_chunk_size == 0 && end == output_chunk_end(begin / target_chunk_size)) {
+        matching_input_chunks[begin / target_chunk_size] = chunk_id;
+      }
+    }
+  }
+
+  uint64_t output_chunk_begin(const size_t output_chunk_id) const {
+    return output_chunk_id * target_chunk_size;
+  }
+
+  uint64_t output_chunk_end(const size_t output_chunk_id) const {
+    return std::min(output_chunk_begin(output_chunk_id) + target_chunk_size, input_chunk_begins.back());
+  }
+
+  const ChunkOffset target_chunk_size;
+  std::vector<uint64_t> input_chunk_begins;
+  ChunkID::base_type output_chunk_count{};
+  // The input chunk that holds exactly the rows of an output chunk, if any.
+  std::vector<std::optional<ChunkID>> matching_input_chunks;
+};
+
+class BaseColumnMaterializer {
+ public:
+  virtual ~BaseColumnMaterializer() = default;
+
+  // Decodes the values of an input segment unless it can be passed through.
+  virtual void gather(const ChunkID input_chunk_id) = 0;
+
+  // Creates the segment of an output chunk from the gathered values. Requires all input segments to be gathered.
+  virtual std::shared_ptr<AbstractSegment> assemble(const ChunkID output_chunk_id) = 0;
+};
+
+template <typename T>
+class ColumnMaterializer : public BaseColumnMaterializer {
+ public:
+  ColumnMaterializer(const Table& input_table, const ColumnID column_id, const ChunkLayout& layout,
+                     const bool use_dictionary_encoding, const std::shared_ptr<QueryMemoryContext>& memory_context)
+      : _input_table(input_table),
+        _column_id(column_id),
+        _layout(layout),
+        _use_dictionary_encoding(use_dictionary_encoding),
+        _memory_context(memory_context),
+        _nulls(input_table.chunk_count()) {
+    const auto input_chunk_count = input_table.chunk_count();
+    // Copies of a std::pmr::vector use the default resource, so each one is constructed with the memory resource.
+    _values.reserve(input_chunk_count);
+    for (auto input_chunk_id = ChunkID{0}; input_chunk_id < input_chunk_count; ++input_chunk_id) {
+      _values.emplace_back(get_memory_resource(memory_context));
+    }
+    _is_passed_through.resize(input_chunk_count);
+    for (const auto& input_chunk_id : layout.matching_input_chunks) {
+      if (!input_chunk_id) {
+        continue;
+      }
+      const auto segment = _input_segment(*input_chunk_id);
+      _is_passed_through[*input_chunk_id] = std::dynamic_pointer_cast<const DictionarySegment<T>>(segment) ||
+                                            std::dynamic_pointer_cast<const ValueSegment<T>>(segment);
+    }
+  }
+
+  void gather(const ChunkID input_chunk_id) final {
+    if (!_is_passed_through[input_chunk_id]) {
+      materialize_values_and_nulls(*_input_segment(input_chunk_id), _values[input_chunk_id], _nulls[input_chunk_id]);
+    }
+  }
+
+  std::shared_ptr<AbstractSegment> assemble(const ChunkID output_chunk_id) final {
+    const auto& matching_input_chunk = _layout.matching_input_chunks[output_chunk_id];
+    if (matching_input_chunk && _is_passed_through[*matching_input_chunk]) {
+      const auto segment = _input_segment(*matching_input_chunk);
+      if (_use_dictionary_encoding && std::dynamic_pointer_cast<const ValueSegment<T>>(segment)) {
+        return make_shared_in<DictionarySegment<T>>(_memory_context, segment, get_memory_resource(_memory_context));
+      }
+      return segment;
+    }
+
+    const auto begin = _layout.output_chunk_begin(output_chunk_id);
+    const auto end = _layout.output_chunk_end(output_chunk_id);
+    auto values = std::pmr::vector<T>{get_memory_resource(_memory_context)};
+    auto nulls = std::vector<bool>{};
+    values.reserve(end - begin);
+    nulls.reserve(end - begin);
+
+    // Copies the overlapping parts of all input chunks that were gathered.
+    const auto& input_chunk_begins = _layout.input_chunk_begins;
+    const auto first_input_chunk =
+        std::prev(std::upper_bound(input_chunk_begins.cbegin(), input_chunk_begins.cend(), begin));
+    for (auto input_chunk_id = static_cast<ChunkID::base_type>(first_input_chunk - input_chunk_begins.cbegin());
+         input_chunk_id + 1 < input_chunk_begins.size() && input_chunk_begins[input_chunk_id] < end;
+         ++input_chunk_id) {
+      const auto input_begin = input_chunk_begins[input_chunk_id];
+      const auto slice_begin = static_cast<std::ptrdiff_t>(std::max(begin, input_begin) - input_begin);
+      const auto slice_end = static_cast<std::ptrdiff_t>(std::min(end, input_chunk_begins[input_chunk_id + 1]) -
+                                                         input_begin);
+      const auto& input_values = _values[input_chunk_id];
+      const auto& input_nulls = _nulls[input_chunk_id];
+      values.insert(values.end(), input_values.cbegin() + slice_begin, input_values.cbegin() + slice_end);
+      nulls.insert(nulls.end(), input_nulls.cbegin() + slice_begin, input_nulls.cbegin() + slice_end);
+    }
+
+    auto segment = std::shared_ptr<AbstractSegment>{};
+    if (_input_table.column_nullable(_column_id)) {
+      segment = make_shared_in<ValueSegment<T>>(_memory_context, std::move(values), std::move(nulls));
+    } else {
+      segment = make_shared_in<ValueSegment<T>>(_memory_context, std::move(values));
+    }
+
+    if (_use_dictionary_encoding) {
+      return make_shared_in<DictionarySegment<T>>(_memory_context, segment);
+    }
+    return segment;
+  }
+
+ protected:
+  std::shared_ptr<AbstractSegment> _input_segment(const ChunkID input_chunk_id) const {
+    return _input_table.get_chunk(input_chunk_id)->get_segment(_column_id);
+  }
+
+  const Table& _input_table;
+  const ColumnID _column_id;
+  const ChunkLayout& _layout;
+  const bool _use_dictionary_encoding;
+  const std::shared_ptr<QueryMemoryContext> _memory_context;
+  std::vector<std::pmr::vector<T>> _values;
+  std::vector<std::vector<bool>> _nulls;
+  std::vector<bool> _is_passed_through;
+};
+
+}  // namespace
+
+namespace opossum {
+
+Materialize::Materialize(const std::shared_ptr<const AbstractOperator>& in, const bool use_dictionary_encoding)
+    : AbstractOperator(in), _use_dictionary_encoding(use_dictionary_encoding) {}
+
+bool Materialize::use_dictionary_encoding() const {
+  return _use_dictionary_encoding;
+}
+
+std::shared_ptr<const Table> Materialize::_on_execute() {
+  const auto input_table = _left_input_table();
+  const auto column_count = input_table->column_count();
+  const auto target_chunk_size = input_table->target_chunk_size();
+
+  auto output_table = std::make_shared<Table>(target_chunk_size, _memory_context);
+  for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+    output_table->add_column(input_table->column_name(column_id), input_table->column_type(column_id),
+                             input_table->column_nullable(column_id));
+  }
+
+  const auto layout = ChunkLayout{*input_table, target_chunk_size};
+  if (layout.output_chunk_count == 0) {
+    return output_table;
+  }
+
+  auto materializers = std::vector<std::unique_ptr<BaseColumnMaterializer>>{};
+  for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+    resolve_data_type(input_table->column_type(column_id), [&](auto type) {
+      using ColumnDataType = typename decltype(type)::type;
+      materializers.emplace_back(std::make_unique<ColumnMaterializer<ColumnDataType>>(
+          *input_table, column_id, layout, _use_dictionary_encoding, _memory_context));
+    });
+  }
+
+  // First, all input segments are gathered in parallel. Then, the output segments are assembled in parallel, since an
+  // output chunk can span multiple input chunks.
+  const auto input_chunk_count = input_table->chunk_count();
+  run_in_parallel(
+      column_count * input_chunk_count,
+      [&](const size_t task_id) {
+        const auto input_chunk_id = ChunkID{static_cast<ChunkID::base_type>(task_id % input_chunk_count)};
+        materializers[task_id / input_chunk_count]->gather(input_chunk_id);
+      },
+      "Gather");
+
+  const auto output_chunk_count = layout.output_chunk_count;
+  auto output_segments = std::vector<std::shared_ptr<AbstractSegment>>(column_count * output_chunk_count);
+  run_in_parallel(
+      output_segments.size(),
+      [&](const size_t task_id) {
+        const auto output_chunk_id = ChunkID{static_cast<ChunkID::base_type>(task_id % output_chunk_count)};
+        output_segments[task_id] = materializers[task_id / output_chunk_count]->assemble(output_chunk_id);
+      },
+      "Assemble");
+
+  for (auto chunk_id = ChunkID{0}; chunk_id < output_chunk_count; ++chunk_id) {
+    const auto output_chunk = make_shared_in<Chunk>(_memory_context);
+    for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+      output_chunk->add_segment(output_segments[column_id * output_chunk_count + chunk_id]);
+    }
+    output_table->emplace_chunk(output_chunk);
+  }
+
+  return output_table;
+}
+
+}  // namespace opossum
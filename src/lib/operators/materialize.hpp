@@ -0,0 +1,30 @@
+#pragma once
+
+#include "abstract_operator.hpp"
+
+namespace opossum {
+
+/**
+ * Operator that turns its input, typically a table of ReferenceSegments, into a table whose segments hold the data
+ * themselves. Downstream operators then read the values directly instead of following position lists, and the
+ * reference chain to the original tables ends here.
+ *
+ * The rows of all input chunks are concatenated and cut into output chunks of target_chunk_size rows, so that sparse
+ * scan results are compacted as well. Each segment is gathered with its concrete type (see
+ * materialize_values_and_nulls), and all segments of all chunks are materialized in parallel. Output segments are
+ * ValueSegments or, with use_dictionary_encoding, DictionarySegments. Input segments that already hold data and cover
+ * exactly one output chunk are passed through without copying.
+ */
+class Materialize : public AbstractOperator {
+ public:
+  explicit Materialize(const std::shared_ptr<const AbstractOperator>& in, const bool use_dictionary_encoding = false);
+
+  bool use_dictionary_encoding() const;
+
+ protected:
+  std::shared_ptr<const Table> _on_execute() override;
+
+  const bool _use_dictionary_encoding;
+};
+
+}  // namespace opossum
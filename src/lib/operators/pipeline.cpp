@@ -0,0 +1,197 @@
+#include "pipeline.hpp"
+
+#include <string>
+#include <unordered_map>
+
+#include "storage/chunk.hpp"
+#include "storage/query_memory_context.hpp"
+#include "storage/table.hpp"
+#include "utils/assert.hpp"
+#include "utils/tracer.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT(build/namespaces)
+
+size_t cumulative_allocated_bytes(const std::shared_ptr<QueryMemoryContext>& memory_context) {
+  return memory_context ? memory_context->cumulative_allocated_bytes() : size_t{0};
+}
+
+}  // namespace
+
+namespace opossum {
+
+Pipeline::Pipeline(const std::vector<std::shared_ptr<AbstractOperator>>& operators) : _operators(operators) {
+  Assert(!_operators.empty(), "A pipeline needs at least one operator.");
+  const auto operator_count = _operators.size();
+  for (auto index = size_t{0}; index < operator_count && operator_count > 1; ++index) {
+    const auto& op = _operators[index];
+    Assert(op->is_pipelineable() && !op->right_input(), op->name() + " cannot be fused into a pipeline.");
+    Assert(index == 0 || op->left_input() == _operators[index - 1],
+           "Each operator of a pipeline must consume the previous one.");
+  }
+}
+
+const std::vector<std::shared_ptr<AbstractOperator>>& Pipeline::operators() const {
+  return _operators;
+}
+
+void Pipeline::execute() {
+  if (_operators.size() == 1) {
+    _operators.front()->execute();
+  } else {
+    _execute_fused();
+  }
+}
+
+void Pipeline::_execute_fused() {
+  for (const auto& op : _operators) {
+    op->_adopt_memory_context();
+  }
+
+  // The name is only determined if the pipeline is traced.
+  auto trace_name = std::string{};
+  if (Tracer::is_enabled()) {
+    for (const auto& op : _operators) {
+      trace_name += (trace_name.empty() ? "" : " -> ") + op->name();
+    }
+  }
+  auto trace_scope = TraceScope{trace_name, "operator", "output_rows"};
+
+  const auto operator_count = _operators.size();
+  auto performance_data = std::vector<OperatorPerformanceData>(operator_count);
+  const auto performance_counters_before =
+      AbstractOperator::performance_counters_enabled() ? PerformanceCounters::read() : std::nullopt;
+  const auto cpu_time_before = process_cpu_time();
+
+  // Calls the given function on behalf of the operator with the given index and adds its walltime and allocations to
+  // those of the operator.
+  const auto measure = [&](const size_t index, const auto& function) {
+    const auto& memory_context = _operators[index]->_memory_context;
+    const auto allocated_bytes_before = cumulative_allocated_bytes(memory_context);
+    const auto walltime_before = std::chrono::steady_clock::now();
+    auto result = function();
+    performance_data[index].walltime += std::chrono::steady_clock::now() - walltime_before;
+    performance_data[index].allocated_bytes += cumulative_allocated_bytes(memory_context) - allocated_bytes_before;
+    return result;
+  };
+
+  // Creating the output tables of all operators upfront checks the column IDs before any chunk is processed. The
+  // tables of the operators but the last one pass their output chunks on to the next operator.
+  const auto source_table = _operators.front()->_left_input_table();
+  auto chunk_tables = std::vector<std::shared_ptr<Table>>(operator_count);
+  auto input_table = source_table;
+  for (auto index = size_t{0}; index < operator_count; ++index) {
+    chunk_tables[index] = measure(index, [&]() { return _operators[index]->_create_output_table(input_table); });
+    input_table = chunk_tables[index];
+  }
+  const auto output_table = std::move(chunk_tables.back());
+
+  const auto chunk_count = source_table->chunk_count();
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    auto chunk_trace_scope = TraceScope{"Chunk", "task", "chunk_id", static_cast<int64_t>(chunk_id)};
+    input_table = source_table;
+    auto input_chunk_id = chunk_id;
+    for (auto index = size_t{0}; index < operator_count; ++index) {
+      const auto& op = _operators[index];
+      const auto output_chunk = measure(index, [&]() { return op->_on_execute_chunk(input_table, input_chunk_id); });
+      if (!output_chunk) {
+        break;
+      }
+
+      ++performance_data[index].output_chunk_count;
+      performance_data[index].output_row_count += output_chunk->size();
+      if (index + 1 == operator_count) {
+        output_table->emplace_chunk(output_chunk);
+        break;
+      }
+
+      // The next operator takes the chunk as the only one of the operator's table. The ReferenceSegments of later
+      // outputs may point to that table, e.g., to the ValueSegments of a Projection. Then, the chunk must stay in it
+      // and the operator continues with a new table. Otherwise, the chunk is replaced by the next one.
+      auto& chunk_table = chunk_tables[index];
+      if (chunk_table.use_count() > 1) {
+        chunk_table = measure(index, [&]() { return op->_create_output_table(input_table); });
+      }
+      chunk_table->replace_chunk(ChunkID{0}, output_chunk);
+      input_table = chunk_table;
+      input_chunk_id = ChunkID{0};
+    }
+  }
+
+  auto& last_performance_data = performance_data.back();
+  last_performance_data.cpu_time = process_cpu_time() - cpu_time_before;
+  if (performance_counters_before) {
+    const auto performance_counters_after = PerformanceCounters::read();
+    if (performance_counters_after) {
+      last_performance_data.performance_counters = *performance_counters_after - *performance_counters_before;
+    }
+  }
+  // Like for regular execution, the output table has an empty chunk if no row qualified.
+  last_performance_data.output_chunk_count = output_table->chunk_count();
+
+  for (auto index = size_t{0}; index < operator_count; ++index) {
+    auto& operator_performance_data = performance_data[index];
+    if (index == 0) {
+      operator_performance_data.input_row_count = source_table->row_count();
+      operator_performance_data.input_chunk_count = chunk_count;
+    } else {
+      operator_performance_data.input_row_count = performance_data[index - 1].output_row_count;
+      operator_performance_data.input_chunk_count = performance_data[index - 1].output_chunk_count;
+    }
+    operator_performance_data.executed = true;
+    _operators[index]->_performance_data = operator_performance_data;
+  }
+
+  _operators.back()->_output = output_table;
+  trace_scope.set_argument(static_cast<int64_t>(output_table->row_count()));
+}
+
+std::vector<Pipeline> create_pipelines(const std::vector<std::shared_ptr<AbstractOperator>>& plan) {
+  auto consumer_counts = std::unordered_map<const AbstractOperator*, size_t>{};
+  for (const auto& op : plan) {
+    for (const auto& input : {op->left_input(), op->right_input()}) {
+      if (input) {
+        ++consumer_counts[input.get()];
+      }
+    }
+  }
+
+  // The operators of each pipeline and, for the operator that currently ends a pipeline, the index of that pipeline.
+  auto pipeline_operators = std::vector<std::vector<std::shared_ptr<AbstractOperator>>>{};
+  auto pipeline_ends = std::unordered_map<const AbstractOperator*, size_t>{};
+  for (const auto& op : plan) {
+    const auto& input = op->left_input();
+    auto pipeline_index = pipeline_operators.size();
+    if (op->is_pipelineable() && !op->right_input() && input && input->is_pipelineable() &&
+        consumer_counts[input.get()] == 1) {
+      const auto pipeline_end_iter = pipeline_ends.find(input.get());
+      if (pipeline_end_iter != pipeline_ends.end()) {
+        pipeline_index = pipeline_end_iter->second;
+        pipeline_ends.erase(pipeline_end_iter);
+      }
+    }
+
+    if (pipeline_index == pipeline_operators.size()) {
+      pipeline_operators.emplace_back();
+    }
+    pipeline_operators[pipeline_index].push_back(op);
+    pipeline_ends[op.get()] = pipeline_index;
+  }
+
+  // A pipeline only depends on the operators before its first one, so the pipelines can be executed in that order.
+  auto pipelines = std::vector<Pipeline>{};
+  pipelines.reserve(pipeline_operators.size());
+  for (const auto& operators : pipeline_operators) {
+    pipelines.emplace_back(operators);
+  }
+  return pipelines;
+}
+
+void execute_pipelined(const std::vector<std::shared_ptr<AbstractOperator>>& plan) {
+  for (auto& pipeline : create_pipelines(plan)) {
+    pipeline.execute();
+  }
+}
+
+}  // namespace opossum
@@ -0,0 +1,48 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "abstract_operator.hpp"
+
+namespace opossum {
+
+/**
+ * A chain of operators of which each consumes the output of the previous one, e.g., TableScan -> TableScan ->
+ * Projection. Executing the operators one after another materializes the complete output of each of them before the
+ * next one starts, so that the intermediate results of large inputs no longer fit into the caches. If the chain
+ * consists of pipelineable operators (see AbstractOperator::is_pipelineable), execute instead pushes one chunk of the
+ * chain's input at a time through all of them, so that the intermediate chunk is still in the caches when the next
+ * operator processes it. Only the last operator materializes its output. Operators that are not pipelineable, e.g.,
+ * TopN or Materialize, need their complete input and break pipelines.
+ *
+ * Each operator of a fused chain records its own row and chunk counts, walltime, and allocated bytes. The CPU time and
+ * the hardware events (see AbstractOperator::set_performance_counters_enabled) are only measured for the whole chain,
+ * since reading them per chunk costs a system call, and are recorded for the last operator. Operators but the last
+ * one have no output, as their output chunks are only passed on.
+ */
+class Pipeline {
+ public:
+  explicit Pipeline(const std::vector<std::shared_ptr<AbstractOperator>>& operators);
+
+  const std::vector<std::shared_ptr<AbstractOperator>>& operators() const;
+
+  // Executes the operators. The input of the first operator must already be executed.
+  void execute();
+
+ protected:
+  void _execute_fused();
+
+  const std::vector<std::shared_ptr<AbstractOperator>> _operators;
+};
+
+// Splits a plan, i.e., its operators in execution order, into pipelines. A pipelineable operator joins the pipeline of
+// its left input if the input is pipelineable as well and no other operator of the plan consumes it. Otherwise, it
+// starts a new pipeline.
+std::vector<Pipeline> create_pipelines(const std::vector<std::shared_ptr<AbstractOperator>>& plan);
+
+// Executes the plan pipeline by pipeline (see create_pipelines). Operators that are fused into a pipeline do not have
+// an output, so only the outputs of the last operator of each pipeline are available afterwards.
+void execute_pipelined(const std::vector<std::shared_ptr<AbstractOperator>>& plan);
+
+}  // namespace opossum
@@ -0,0 +1,64 @@
+#include "projection.hpp"
+
+#include "expression/abstract_expression.hpp"
+#include "expression/column_expression.hpp"
+#include "expression/expression_evaluator.hpp"
+#include "storage/chunk.hpp"
+#include "storage/table.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+Projection::Projection(const std::shared_ptr<const AbstractOperator>& in,
+                       const std::vector<std::shared_ptr<AbstractExpression>>& expressions)
+    : AbstractOperator(in), _expressions(expressions) {}
+
+const std::vector<std::shared_ptr<AbstractExpression>>& Projection::expressions() const {
+  return _expressions;
+}
+
+bool Projection::is_pipelineable() const {
+  return true;
+}
+
+std::shared_ptr<const Table> Projection::_on_execute() {
+  return _execute_chunk_by_chunk();
+}
+
+std::shared_ptr<Table> Projection::_create_output_table(const std::shared_ptr<const Table>& input_table) const {
+  auto output_table = std::make_shared<Table>(input_table->target_chunk_size(), _memory_context);
+  for (const auto& expression : _expressions) {
+    if (expression->type == ExpressionType::Column) {
+      const auto column_id = static_cast<const ColumnExpression&>(*expression).column_id;
+      Assert(column_id < input_table->column_count(), "Column ID out of range.");
+      output_table->add_column(input_table->column_name(column_id), input_table->column_type(column_id),
+                               input_table->column_nullable(column_id));
+    } else {
+      output_table->add_column(expression->description(), expression->data_type(), expression->is_nullable());
+    }
+  }
+  return output_table;
+}
+
+std::shared_ptr<Chunk> Projection::_on_execute_chunk(const std::shared_ptr<const Table>& input_table,
+                                                     const ChunkID chunk_id) const {
+  const auto input_chunk = input_table->get_chunk(chunk_id);
+  if (input_chunk->size() == 0) {
+    return nullptr;
+  }
+
+  // The evaluator caches materialized columns, so it is shared by all expressions of a chunk.
+  auto evaluator = ExpressionEvaluator{input_chunk, _memory_context};
+  const auto output_chunk = make_shared_in<Chunk>(_memory_context);
+  for (const auto& expression : _expressions) {
+    if (expression->type == ExpressionType::Column) {
+      const auto column_id = static_cast<const ColumnExpression&>(*expression).column_id;
+      output_chunk->add_segment(input_chunk->get_segment(column_id));
+    } else {
+      output_chunk->add_segment(evaluator.evaluate_expression_to_segment(*expression));
+    }
+  }
+  return output_chunk;
+}
+
+}  // namespace opossum
@@ -0,0 +1,36 @@
+#pragma once
+
+#include <vector>
+
+#include "abstract_operator.hpp"
+
+namespace opossum {
+
+class AbstractExpression;
+
+/**
+ * Operator that computes one output column per expression, e.g., for SELECT a, b * (1 - c) FROM ... Expressions are
+ * evaluated chunk by chunk with the ExpressionEvaluator. Columns that are only passed through (i.e., plain column
+ * references) forward the input segment instead of copying it.
+ */
+class Projection : public AbstractOperator {
+ public:
+  Projection(const std::shared_ptr<const AbstractOperator>& in,
+             const std::vector<std::shared_ptr<AbstractExpression>>& expressions);
+
+  const std::vector<std::shared_ptr<AbstractExpression>>& expressions() const;
+
+  bool is_pipelineable() const override;
+
+ protected:
+  std::shared_ptr<const Table> _on_execute() override;
+
+  std::shared_ptr<Table> _create_output_table(const std::shared_ptr<const Table>& input_table) const override;
+
+  std::shared_ptr<Chunk> _on_execute_chunk(const std::shared_ptr<const Table>& input_table,
+                                           const ChunkID chunk_id) const override;
+
+  const std::vector<std::shared_ptr<AbstractExpression>> _expressions;
+};
+
+}  // namespace opossum
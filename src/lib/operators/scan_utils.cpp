@@ -0,0 +1,894 @@
+#include "scan_utils.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <functional>
+#include <iterator>
+#include <numeric>
+#include <optional>
+#include <string_view>
+#include <type_traits>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+
+#include "access_path_selection.hpp"
+#include "resolve_type.hpp"
+#include "storage/dictionary_segment.hpp"
+#include "storage/fixed_width_integer_vector.hpp"
+#include "storage/index/base_index.hpp"
+#include "storage/materialize.hpp"
+#include "storage/pos_list_utils.hpp"
+#include "storage/reference_segment.hpp"
+#include "storage/table.hpp"
+#include "storage/value_segment.hpp"
+#include "utils/assert.hpp"
+#include "utils/like_matcher.hpp"
+#include "utils/scan_type_utils.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT(build/namespaces)
+
+// Selectivities assumed for segments without a dictionary.
+constexpr auto DEFAULT_EQUALS_SELECTIVITY = 0.1f;
+constexpr auto DEFAULT_BETWEEN_SELECTIVITY = 0.25f;
+constexpr auto DEFAULT_RANGE_SELECTIVITY = 0.33f;
+constexpr auto DEFAULT_LIKE_SELECTIVITY = 0.1f;
+
+// IN lists with at least this many values are looked up in a hash set instead of being compared one by one.
+constexpr auto IN_LIST_HASH_SET_THRESHOLD = size_t{8};
+
+// Comparisons with NULL are never true.
+bool never_matches(const ScanPredicate& predicate) {
+  if (predicate.scan_type == ScanType::OpIn) {
+    return std::all_of(predicate.in_values.cbegin(), predicate.in_values.cend(),
+                       [](const auto& in_value) { return variant_is_null(in_value); });
+  }
+  return variant_is_null(predicate.value) ||
+         (predicate.scan_type == ScanType::OpBetween && variant_is_null(predicate.upper_value));
+}
+
+// IN lists and LIKE patterns other than prefixes do not translate into a single ValueID range. For DictionarySegments,
+// they are evaluated once per dictionary entry instead (see value_id_matches).
+bool uses_value_id_matches(const ScanPredicate& predicate) {
+  return predicate.scan_type == ScanType::OpIn ||
+         (predicate.scan_type == ScanType::OpLike && !LikeMatcher{type_cast<std::string>(predicate.value)}.prefix());
+}
+
+// Restricts the selection to the rows for which `matches(chunk_offset)` holds. std::nullopt stands for all rows of the
+// chunk. Every candidate is written, but the output position only advances on a match, so the loops do not branch on
+// the result of the predicate.
+template <typename Matches>
+void filter_selection(std::optional<SelectionVector>& selection, const ChunkOffset chunk_size, const Matches& matches) {
+  auto match_count = size_t{0};
+  if (!selection) {
+    selection.emplace(chunk_size);
+    auto& offsets = *selection;
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk_size; ++chunk_offset) {
+      offsets[match_count] = chunk_offset;
+      match_count += matches(chunk_offset);
+    }
+  } else {
+    auto& offsets = *selection;
+    const auto candidate_count = offsets.size();
+    for (auto index = size_t{0}; index < candidate_count; ++index) {
+      const auto chunk_offset = offsets[index];
+      offsets[match_count] = chunk_offset;
+      match_count += matches(chunk_offset);
+    }
+  }
+  selection->resize(match_count);
+}
+
+// Selects the rows of a whole chunk for which `matches(chunk_offset)` holds and that are valid. The predicate is
+// evaluated for 64 rows at a time into a bit mask, without branches, so that the compiler can vectorize it. The mask is
+// combined with the validity word of the same rows, and the offsets of the set bits are written to the selection.
+template <typename Matches>
+void select_valid_matches(SelectionVector& selection, const ChunkOffset chunk_size, const ValidityBitmap* validity,
+                          const Matches& matches) {
+  selection.resize(chunk_size);
+  auto match_count = size_t{0};
+  for (auto word_begin = ChunkOffset{0}; word_begin < chunk_size; word_begin += ValidityBitmap::ROWS_PER_WORD) {
+    const auto word_size = std::min(ValidityBitmap::ROWS_PER_WORD, chunk_size - word_begin);
+    auto mask = uint64_t{0};
+    for (auto bit = ChunkOffset{0}; bit < word_size; ++bit) {
+      mask |= uint64_t{matches(word_begin + bit)} << bit;
+    }
+    if (validity) {
+      mask &= validity->words()[word_begin / ValidityBitmap::ROWS_PER_WORD];
+    }
+
+    while (mask) {
+      selection[match_count++] = word_begin + static_cast<ChunkOffset>(std::countr_zero(mask));
+      mask &= mask - 1;
+    }
+  }
+  selection.resize(match_count);
+}
+
+// Hashes strings and std::string_views alike, so that sets of strings can be probed with the values of a
+// CompactStringVector without creating strings.
+struct TransparentHash {
+  using is_transparent = void;
+
+  template <typename Value>
+  size_t operator()(const Value& value) const {
+    if constexpr (std::is_convertible_v<const Value&, std::string_view>) {
+      return std::hash<std::string_view>{}(value);
+    } else {
+      return std::hash<Value>{}(value);
+    }
+  }
+};
+
+// Scans the values of a ValueSegment (a std::vector<T> or, for strings, a CompactStringVector) or of a materialized
+// segment. `validity` is nullptr if no value is NULL.
+template <typename T, typename Values>
+void scan_values(const Values& values, const ValidityBitmap* validity, const ScanPredicate& predicate,
+                 std::optional<SelectionVector>& selection) {
+  const auto chunk_size = static_cast<ChunkOffset>(values.size());
+  const auto scan_offsets = [&](const auto& matches) {
+    if (!selection) {
+      selection.emplace();
+      select_valid_matches(*selection, chunk_size, validity, matches);
+    } else if (validity) {
+      filter_selection(selection, chunk_size, [&](const ChunkOffset chunk_offset) {
+        return !validity->is_null(chunk_offset) && matches(chunk_offset);
+      });
+    } else {
+      filter_selection(selection, chunk_size, matches);
+    }
+  };
+  const auto scan = [&](const auto& value_matches) {
+    scan_offsets([&](const ChunkOffset chunk_offset) { return value_matches(values[chunk_offset]); });
+  };
+
+  if (predicate.scan_type == ScanType::OpIn) {
+    auto in_values = std::vector<T>{};
+    for (const auto& in_value : predicate.in_values) {
+      if (!variant_is_null(in_value)) {
+        in_values.push_back(type_cast<T>(in_value));
+      }
+    }
+
+    if (in_values.size() >= IN_LIST_HASH_SET_THRESHOLD) {
+      const auto in_value_set =
+          std::unordered_set<T, TransparentHash, std::equal_to<>>(in_values.cbegin(), in_values.cend());
+      scan([&](const auto& value) { return in_value_set.contains(value); });
+    } else {
+      scan([&](const auto& value) {
+        return std::find(in_values.cbegin(), in_values.cend(), value) != in_values.cend();
+      });
+    }
+    return;
+  }
+
+  if (predicate.scan_type == ScanType::OpLike) {
+    if constexpr (std::is_same_v<T, std::string>) {
+      const auto like_matcher = LikeMatcher{type_cast<std::string>(predicate.value)};
+      scan([&](const auto& value) { return like_matcher.matches(value); });
+      return;
+    } else {
+      Fail("LIKE can only be applied to string columns.");
+    }
+  }
+
+  const auto search_value = type_cast<T>(predicate.value);
+  if constexpr (std::is_same_v<Values, CompactStringVector>) {
+    // Most comparisons are decided by the lengths and four-character prefixes stored in the string headers.
+    const auto comparison_value = CompactStringVector::ComparisonValue{search_value};
+    if (predicate.scan_type == ScanType::OpEquals || predicate.scan_type == ScanType::OpNotEquals) {
+      const auto is_equals = predicate.scan_type == ScanType::OpEquals;
+      scan_offsets([&](const ChunkOffset chunk_offset) {
+        return values.equals(chunk_offset, comparison_value) == is_equals;
+      });
+      return;
+    }
+
+    if (predicate.scan_type == ScanType::OpBetween) {
+      const auto upper_value = type_cast<T>(predicate.upper_value);
+      const auto upper_comparison_value = CompactStringVector::ComparisonValue{upper_value};
+      scan_offsets([&](const ChunkOffset chunk_offset) {
+        return values.compare(chunk_offset, comparison_value) >= 0 &&
+               values.compare(chunk_offset, upper_comparison_value) <= 0;
+      });
+      return;
+    }
+
+    with_comparator(predicate.scan_type, [&](auto comparator) {
+      scan_offsets([&](const ChunkOffset chunk_offset) {
+        return comparator(values.compare(chunk_offset, comparison_value), 0);
+      });
+    });
+    return;
+  }
+
+  if (predicate.scan_type == ScanType::OpBetween) {
+    const auto upper_value = type_cast<T>(predicate.upper_value);
+    scan([&](const auto& value) { return search_value <= value && value <= upper_value; });
+    return;
+  }
+
+  with_comparator(predicate.scan_type, [&](auto comparator) {
+    scan([&](const auto& value) { return comparator(value, search_value); });
+  });
+}
+
+// The ValueIDs of a DictionarySegment that satisfy a predicate. Since the dictionary is sorted, these are the ValueIDs
+// in [begin, end) or, if the range is negated (i.e., for OpNotEquals), all dictionary ValueIDs outside of it.
+struct ValueIDRange {
+  ValueID::base_type begin;
+  ValueID::base_type end;
+  bool is_negated;
+
+  // The ValueIDs of the first and behind the last dictionary entry. The NULL ValueID lies outside of them.
+  ValueID::base_type dictionary_begin;
+  ValueID::base_type dictionary_end;
+
+  // Returns the number of qualifying dictionary entries.
+  size_t size() const {
+    return is_negated ? (dictionary_end - dictionary_begin) - (end - begin) : end - begin;
+  }
+
+  bool matches_all_values() const {
+    return size() == dictionary_end - dictionary_begin;
+  }
+};
+
+template <typename T>
+ValueIDRange value_id_range(const DictionarySegment<T>& segment, const ScanPredicate& predicate) {
+  const auto dictionary_begin = ValueID::base_type{segment.is_nullable() ? 1u : 0u};
+  const auto dictionary_end = static_cast<ValueID::base_type>(dictionary_begin + segment.dictionary().size());
+  const auto bound = [&](const ValueID value_id) {
+    return value_id == INVALID_VALUE_ID ? dictionary_end : static_cast<ValueID::base_type>(value_id);
+  };
+
+  const auto search_value = type_cast<T>(predicate.value);
+  const auto lower_bound = bound(segment.lower_bound(search_value));
+  const auto upper_bound = bound(segment.upper_bound(search_value));
+
+  switch (predicate.scan_type) {
+    case ScanType::OpEquals:
+      return {lower_bound, upper_bound, false, dictionary_begin, dictionary_end};
+    case ScanType::OpNotEquals:
+      return {lower_bound, upper_bound, true, dictionary_begin, dictionary_end};
+    case ScanType::OpLessThan:
+      return {dictionary_begin, lower_bound, false, dictionary_begin, dictionary_end};
+    case ScanType::OpLessThanEquals:
+      return {dictionary_begin, upper_bound, false, dictionary_begin, dictionary_end};
+    case ScanType::OpGreaterThan:
+      return {upper_bound, dictionary_end, false, dictionary_begin, dictionary_end};
+    case ScanType::OpGreaterThanEquals:
+      return {lower_bound, dictionary_end, false, dictionary_begin, dictionary_end};
+    case ScanType::OpBetween: {
+      const auto between_end = bound(segment.upper_bound(type_cast<T>(predicate.upper_value)));
+      return {lower_bound, std::max(lower_bound, between_end), false, dictionary_begin, dictionary_end};
+    }
+    case ScanType::OpLike:
+      // Only prefix patterns end up here (see uses_value_id_matches).
+      if constexpr (std::is_same_v<T, std::string>) {
+        const auto prefix = *LikeMatcher{search_value}.prefix();
+        const auto prefix_begin = bound(segment.lower_bound(prefix));
+        const auto prefix_end = prefix_upper_bound(prefix);
+        return {prefix_begin, prefix_end ? bound(segment.lower_bound(*prefix_end)) : dictionary_end, false,
+                dictionary_begin, dictionary_end};
+      }
+      break;
+    case ScanType::OpIn:
+      break;
+  }
+  Fail("Unsupported ScanType.");
+}
+
+// Returns one entry per ValueID of the segment that is 1 if the dictionary value satisfies the predicate and 0
+// otherwise. The entry of the NULL ValueID is always 0. Using bytes instead of bits makes the lookup per row a plain
+// load without any branches or shifts.
+template <typename T>
+std::vector<uint8_t> value_id_matches(const DictionarySegment<T>& segment, const ScanPredicate& predicate) {
+  const auto& dictionary = segment.dictionary();
+  const auto dictionary_begin = segment.is_nullable() ? size_t{1} : size_t{0};
+  auto matches = std::vector<uint8_t>(dictionary_begin + dictionary.size());
+
+  if (predicate.scan_type == ScanType::OpIn) {
+    for (const auto& in_value : predicate.in_values) {
+      if (variant_is_null(in_value)) {
+        continue;
+      }
+
+      const auto typed_in_value = type_cast<T>(in_value);
+      const auto value_id = segment.lower_bound(typed_in_value);
+      if (value_id != INVALID_VALUE_ID && segment.value_of_value_id(value_id) == typed_in_value) {
+        matches[value_id] = 1;
+      }
+    }
+    return matches;
+  }
+
+  if constexpr (std::is_same_v<T, std::string>) {
+    DebugAssert(predicate.scan_type == ScanType::OpLike, "Unexpected ScanType.");
+    const auto like_matcher = LikeMatcher{type_cast<std::string>(predicate.value)};
+    const auto dictionary_size = dictionary.size();
+    for (auto index = size_t{0}; index < dictionary_size; ++index) {
+      matches[dictionary_begin + index] = like_matcher.matches(dictionary[index]);
+    }
+    return matches;
+  } else {
+    Fail("LIKE can only be applied to string columns.");
+  }
+}
+
+// Calls `functor` with the ValueIDs of the segment's attribute vector as a plain vector of integers.
+template <typename T, typename Functor>
+void with_value_ids(const DictionarySegment<T>& segment, const Functor& functor) {
+  opossum::with_value_ids(*segment.attribute_vector(), functor);
+}
+
+// Dictionary segments are scanned on their ValueIDs only. The predicate is translated into a ValueID range once, and
+// the attribute vector is filtered with two integer comparisons per row. Predicates that do not form a range look up
+// each ValueID in a table that holds the result of the predicate for each dictionary entry.
+template <typename T>
+void scan_dictionary_segment(const DictionarySegment<T>& segment, const ScanPredicate& predicate,
+                             std::optional<SelectionVector>& selection) {
+  if (uses_value_id_matches(predicate)) {
+    const auto matches = value_id_matches(segment, predicate);
+    if (std::find(matches.cbegin(), matches.cend(), uint8_t{1}) == matches.cend()) {
+      selection.emplace();
+      return;
+    }
+
+    with_value_ids(segment, [&](const auto& value_ids) {
+      filter_selection(selection, static_cast<ChunkOffset>(value_ids.size()),
+                       [&](const ChunkOffset chunk_offset) { return matches[value_ids[chunk_offset]] != 0; });
+    });
+    return;
+  }
+
+  const auto range = value_id_range(segment, predicate);
+  if (range.size() == 0) {
+    selection.emplace();
+    return;
+  }
+  if (range.matches_all_values() && !segment.is_nullable()) {
+    return;
+  }
+
+  with_value_ids(segment, [&](const auto& value_ids) {
+    const auto chunk_size = static_cast<ChunkOffset>(value_ids.size());
+    if (range.is_negated) {
+      // The NULL ValueID is excluded by the first comparison.
+      filter_selection(selection, chunk_size, [&](const ChunkOffset chunk_offset) {
+        const auto value_id = value_ids[chunk_offset];
+        return value_id >= range.dictionary_begin && (value_id < range.begin || value_id >= range.end);
+      });
+    } else {
+      filter_selection(selection, chunk_size, [&](const ChunkOffset chunk_offset) {
+        const auto value_id = value_ids[chunk_offset];
+        return value_id >= range.begin && value_id < range.end;
+      });
+    }
+  });
+}
+
+template <typename T>
+void scan_segment(const AbstractSegment& segment, const ScanPredicate& predicate,
+                  std::optional<SelectionVector>& selection) {
+  if (never_matches(predicate)) {
+    selection.emplace();
+    return;
+  }
+
+  if (const auto value_segment = dynamic_cast<const ValueSegment<T>*>(&segment)) {
+    const auto* validity = value_segment->is_nullable() ? &value_segment->validity() : nullptr;
+    scan_values<T>(value_segment->values(), validity, predicate, selection);
+    return;
+  }
+
+  if (const auto dictionary_segment = dynamic_cast<const DictionarySegment<T>*>(&segment)) {
+    scan_dictionary_segment(*dictionary_segment, predicate, selection);
+    return;
+  }
+
+  // Other segment types (e.g., ReferenceSegments) are materialized first.
+  auto values = std::vector<T>{};
+  auto nulls = std::vector<bool>{};
+  materialize_values_and_nulls(segment, values, nulls);
+  const auto validity = ValidityBitmap{nulls};
+  scan_values<T>(values, &validity, predicate, selection);
+}
+
+// Calls `functor` with the values of the segment and a pointer to its validity bitmap, which is nullptr if the segment
+// contains no NULLs. ValueSegments are accessed directly, other segments are decoded into typed vectors first.
+template <typename T, typename Functor>
+void with_typed_values(const AbstractSegment& segment, const Functor& functor) {
+  if (const auto value_segment = dynamic_cast<const ValueSegment<T>*>(&segment)) {
+    functor(value_segment->values(), value_segment->is_nullable() ? &value_segment->validity() : nullptr);
+    return;
+  }
+
+  auto values = std::vector<T>{};
+  auto nulls = std::vector<bool>{};
+  materialize_values_and_nulls(segment, values, nulls);
+  const auto validity = ValidityBitmap{nulls};
+  functor(values, &validity);
+}
+
+// The kernel for one (left type, right type, ScanType) combination. Both segments are walked in lockstep.
+template <typename Left, typename Right>
+void scan_column_pair(const AbstractSegment& left_segment, const AbstractSegment& right_segment,
+                      const ScanType scan_type, std::optional<SelectionVector>& selection) {
+  const auto chunk_size = left_segment.size();
+  with_typed_values<Left>(left_segment, [&](const auto& left_values, const auto* left_validity) {
+    with_typed_values<Right>(right_segment, [&](const auto& right_values, const auto* right_validity) {
+      with_comparator(scan_type, [&](auto comparator) {
+        if (!left_validity && !right_validity) {
+          filter_selection(selection, chunk_size, [&](const ChunkOffset chunk_offset) {
+            return comparator(left_values[chunk_offset], right_values[chunk_offset]);
+          });
+          return;
+        }
+
+        filter_selection(selection, chunk_size, [&](const ChunkOffset chunk_offset) {
+          return !(left_validity && left_validity->is_null(chunk_offset)) &&
+                 !(right_validity && right_validity->is_null(chunk_offset)) &&
+                 comparator(left_values[chunk_offset], right_values[chunk_offset]);
+        });
+      });
+    });
+  });
+}
+
+// Returns the positions of `input_pos_list` at the selected offsets. Position lists that reference a single chunk stay
+// compact, and if all positions are selected, the input list is shared.
+std::shared_ptr<const AbstractPosList> resolve_selected_positions(
+    const std::shared_ptr<const AbstractPosList>& input_pos_list, const Table& referenced_table,
+    const SelectionVector& selection, const std::shared_ptr<QueryMemoryContext>& memory_context) {
+  if (selection.size() == input_pos_list->size()) {
+    return input_pos_list;
+  }
+
+  auto pos_list = std::shared_ptr<const AbstractPosList>{};
+  resolve_pos_list_type(*input_pos_list, [&](const auto& typed_pos_list) {
+    using PosListType = std::decay_t<decltype(typed_pos_list)>;
+    if constexpr (std::is_same_v<PosListType, PosList>) {
+      auto resolved_pos_list = make_shared_in<PosList>(memory_context, get_memory_resource(memory_context));
+      resolved_pos_list->reserve(selection.size());
+      for (const auto chunk_offset : selection) {
+        resolved_pos_list->push_back(typed_pos_list[chunk_offset]);
+      }
+      pos_list = std::move(resolved_pos_list);
+    } else {
+      const auto chunk_id = *typed_pos_list.single_chunk_id();
+      auto chunk_offsets = std::pmr::vector<ChunkOffset>{get_memory_resource(memory_context)};
+      if constexpr (std::is_same_v<PosListType, EntireChunkPosList>) {
+        chunk_offsets.assign(selection.cbegin(), selection.cend());
+      } else {
+        const auto& input_chunk_offsets = typed_pos_list.chunk_offsets();
+        chunk_offsets.reserve(selection.size());
+        for (const auto chunk_offset : selection) {
+          chunk_offsets.push_back(input_chunk_offsets[chunk_offset]);
+        }
+      }
+
+      // Only the offsets of a SingleChunkPosList can be unordered or repeated.
+      if (std::adjacent_find(chunk_offsets.cbegin(), chunk_offsets.cend(), std::greater_equal<>{}) !=
+          chunk_offsets.cend()) {
+        pos_list = make_shared_in<SingleChunkPosList>(memory_context, chunk_id, std::move(chunk_offsets));
+        return;
+      }
+      pos_list = make_single_chunk_pos_list(chunk_id, referenced_table.get_chunk(chunk_id)->size(),
+                                            std::move(chunk_offsets), memory_context);
+    }
+  });
+  return pos_list;
+}
+
+// A lookup in an index that answers some predicates of a conjunction: equality predicates on the leading indexed
+// columns, optionally followed by a range or IN predicate on the next indexed column. The qualifying rows are
+// [begin, end) with begin = lower_bound(begin_values) and end = upper_bound(end_values), or upper_bound / lower_bound if
+// begin_after_values / end_before_values are set. For an IN predicate, each of the in_values is appended to the values
+// of the equality predicates and looked up on its own.
+struct IndexLookup {
+  const BaseIndex* index{nullptr};
+  std::vector<const ScanPredicate*> predicates{};
+  std::vector<AllTypeVariant> begin_values{};
+  bool begin_after_values{false};
+  std::vector<AllTypeVariant> end_values{};
+  bool end_before_values{false};
+  std::vector<AllTypeVariant> in_values{};
+};
+
+using IndexRange = std::pair<BaseIndex::Iterator, BaseIndex::Iterator>;
+
+// Returns the lookup that answers as many predicates as possible with `index`, or nullopt if it cannot answer any.
+std::optional<IndexLookup> plan_index_lookup(const Chunk& chunk, const BaseIndex& index,
+                                             const std::vector<ScanPredicate>& predicates) {
+  const auto find_predicate = [&](const auto& segment, const auto& supports_scan_type) -> const ScanPredicate* {
+    for (const auto& predicate : predicates) {
+      if (supports_scan_type(predicate.scan_type) && !never_matches(predicate) &&
+          chunk.get_segment(predicate.column_id) == segment) {
+        return &predicate;
+      }
+    }
+    return nullptr;
+  };
+
+  auto lookup = IndexLookup{.index = &index};
+  const auto indexed_segments = index.get_indexed_segments();
+  const auto indexed_segment_count = indexed_segments.size();
+  auto segment_index = size_t{0};
+  for (; segment_index < indexed_segment_count; ++segment_index) {
+    const auto* predicate = find_predicate(indexed_segments[segment_index],
+                                           [](const auto scan_type) { return scan_type == ScanType::OpEquals; });
+    if (!predicate) {
+      break;
+    }
+    lookup.predicates.push_back(predicate);
+    lookup.begin_values.push_back(predicate->value);
+  }
+  lookup.end_values = lookup.begin_values;
+
+  const auto* range_predicate =
+      segment_index == indexed_segment_count
+          ? nullptr
+          : find_predicate(indexed_segments[segment_index], [](const auto scan_type) {
+              return scan_type == ScanType::OpLessThan || scan_type == ScanType::OpLessThanEquals ||
+                     scan_type == ScanType::OpGreaterThan || scan_type == ScanType::OpGreaterThanEquals ||
+                     scan_type == ScanType::OpBetween || scan_type == ScanType::OpIn;
+            });
+  if (range_predicate) {
+    lookup.predicates.push_back(range_predicate);
+    switch (range_predicate->scan_type) {
+      case ScanType::OpLessThan:
+        lookup.end_values.push_back(range_predicate->value);
+        lookup.end_before_values = true;
+        break;
+      case ScanType::OpLessThanEquals:
+        lookup.end_values.push_back(range_predicate->value);
+        break;
+      case ScanType::OpGreaterThan:
+        lookup.begin_values.push_back(range_predicate->value);
+        lookup.begin_after_values = true;
+        break;
+      case ScanType::OpGreaterThanEquals:
+        lookup.begin_values.push_back(range_predicate->value);
+        break;
+      case ScanType::OpBetween:
+        lookup.begin_values.push_back(range_predicate->value);
+        lookup.end_values.push_back(range_predicate->upper_value);
+        break;
+      case ScanType::OpIn:
+        // NULLs never match. never_matches ensures that at least one value is left.
+        std::copy_if(range_predicate->in_values.cbegin(), range_predicate->in_values.cend(),
+                     std::back_inserter(lookup.in_values), [](const auto& value) { return !variant_is_null(value); });
+        break;
+      case ScanType::OpEquals:
+      case ScanType::OpNotEquals:
+      case ScanType::OpLike:
+        Fail("Not a range predicate.");
+    }
+  }
+
+  // Rows with a NULL in any indexed column are not part of the index. This is only correct if the lookup has predicates
+  // on all indexed columns, which exclude these rows anyway, or if the index contains all rows.
+  const auto has_predicates_on_all_columns = segment_index + (range_predicate ? 1 : 0) == indexed_segment_count;
+  if (lookup.predicates.empty() ||
+      (!has_predicates_on_all_columns && index.cend() - index.cbegin() != std::ptrdiff_t{chunk.size()})) {
+    return std::nullopt;
+  }
+  return lookup;
+}
+
+// Returns the ranges of chunk offsets found by an index lookup, in key order. Only IN predicates yield more than one
+// range.
+std::vector<IndexRange> look_up(const IndexLookup& lookup) {
+  const auto& index = *lookup.index;
+  if (!lookup.in_values.empty()) {
+    auto ranges = std::vector<IndexRange>{};
+    ranges.reserve(lookup.in_values.size());
+    auto values = lookup.begin_values;
+    values.emplace_back();
+    for (const auto& in_value : lookup.in_values) {
+      values.back() = in_value;
+      ranges.emplace_back(index.lower_bound(values), index.upper_bound(values));
+    }
+    return ranges;
+  }
+
+  const auto begin =
+      lookup.begin_after_values ? index.upper_bound(lookup.begin_values) : index.lower_bound(lookup.begin_values);
+  const auto end =
+      lookup.end_before_values ? index.lower_bound(lookup.end_values) : index.upper_bound(lookup.end_values);
+  return {{begin, std::max(begin, end)}};
+}
+
+size_t match_count(const std::vector<IndexRange>& ranges) {
+  auto match_count = size_t{0};
+  for (const auto& [begin, end] : ranges) {
+    match_count += static_cast<size_t>(end - begin);
+  }
+  return match_count;
+}
+
+}  // namespace
+
+namespace opossum {
+
+SelectionVector scan_chunk_column_comparison(const Table& table, const ChunkID chunk_id, const ColumnID left_column_id,
+                                             const ScanType scan_type, const ColumnID right_column_id) {
+  const auto chunk = table.get_chunk(chunk_id);
+  const auto& left_segment = *chunk->get_segment(left_column_id);
+  const auto& right_segment = *chunk->get_segment(right_column_id);
+  const auto& left_data_type = table.column_type(left_column_id);
+  const auto& right_data_type = table.column_type(right_column_id);
+  Assert((left_data_type == "string") == (right_data_type == "string"), "Cannot compare strings with numbers.");
+
+  auto selection = std::optional<SelectionVector>{};
+  resolve_data_type(left_data_type, [&](auto left_type) {
+    using LeftDataType = typename decltype(left_type)::type;
+    resolve_data_type(right_data_type, [&](auto right_type) {
+      using RightDataType = typename decltype(right_type)::type;
+      // Mixed numeric types are compared after the usual arithmetic conversions.
+      if constexpr (std::is_same_v<LeftDataType, std::string> == std::is_same_v<RightDataType, std::string>) {
+        scan_column_pair<LeftDataType, RightDataType>(left_segment, right_segment, scan_type, selection);
+      }
+    });
+  });
+  return selection ? std::move(*selection) : SelectionVector{};
+}
+
+SelectionVector scan_chunk(const Table& table, const ChunkID chunk_id, const std::vector<ScanPredicate>& predicates) {
+  const auto chunk = table.get_chunk(chunk_id);
+
+  // The index lookup that finds the fewest rows provides the initial selection, unless scanning is estimated to be
+  // faster (see prefer_index_lookup). The lookups yield the exact number of rows they find.
+  auto index_lookup = std::optional<IndexLookup>{};
+  auto index_ranges = std::vector<IndexRange>{};
+  auto index_match_count = size_t{0};
+  for (const auto& index : chunk->get_indexes()) {
+    auto lookup = plan_index_lookup(*chunk, *index, predicates);
+    if (!lookup) {
+      continue;
+    }
+    auto ranges = look_up(*lookup);
+    const auto lookup_match_count = match_count(ranges);
+    if (!index_lookup || lookup_match_count < index_match_count) {
+      index_lookup = std::move(lookup);
+      index_ranges = std::move(ranges);
+      index_match_count = lookup_match_count;
+    }
+  }
+  if (index_lookup && !prefer_index_lookup(index_match_count, chunk->size())) {
+    index_lookup.reset();
+  }
+
+  auto ordered_predicates = std::vector<std::pair<float, const ScanPredicate*>>{};
+  ordered_predicates.reserve(predicates.size());
+  for (const auto& predicate : predicates) {
+    Assert(predicate.scan_type != ScanType::OpLike || table.column_type(predicate.column_id) == "string",
+           "LIKE can only be applied to string columns.");
+    if (index_lookup && std::find(index_lookup->predicates.cbegin(), index_lookup->predicates.cend(), &predicate) !=
+                            index_lookup->predicates.cend()) {
+      continue;
+    }
+    const auto selectivity = estimate_selectivity(*chunk->get_segment(predicate.column_id),
+                                                  table.column_type(predicate.column_id), predicate);
+    ordered_predicates.emplace_back(selectivity, &predicate);
+  }
+  std::stable_sort(ordered_predicates.begin(), ordered_predicates.end(),
+                   [](const auto& lhs, const auto& rhs) { return lhs.first < rhs.first; });
+
+  auto selection = std::optional<SelectionVector>{};
+  if (index_lookup) {
+    selection.emplace();
+    selection->reserve(index_match_count);
+    for (const auto& [begin, end] : index_ranges) {
+      selection->insert(selection->end(), begin, end);
+    }
+    std::sort(selection->begin(), selection->end());
+    // IN lists may contain a value more than once.
+    if (index_ranges.size() > 1) {
+      selection->erase(std::unique(selection->begin(), selection->end()), selection->end());
+    }
+  }
+  for (const auto& [selectivity, predicate] : ordered_predicates) {
+    if (selection && selection->empty()) {
+      break;
+    }
+
+    resolve_data_type(table.column_type(predicate->column_id), [&](auto type) {
+      using ColumnDataType = typename decltype(type)::type;
+      scan_segment<ColumnDataType>(*chunk->get_segment(predicate->column_id), *predicate, selection);
+    });
+  }
+
+  if (!selection) {
+    selection.emplace(chunk->size());
+    std::iota(selection->begin(), selection->end(), ChunkOffset{0});
+  }
+  return std::move(*selection);
+}
+
+bool index_supports_predicate(const ScanPredicate& predicate) {
+  return predicate.scan_type != ScanType::OpLike;
+}
+
+SelectionVector scan_chunk_with_index(const BaseIndex& index, const ScanPredicate& predicate) {
+  DebugAssert(index_supports_predicate(predicate), "Predicate cannot be answered by an index.");
+  auto selection = SelectionVector{};
+  if (never_matches(predicate)) {
+    return selection;
+  }
+
+  const auto append_range = [&](const BaseIndex::Iterator begin, const BaseIndex::Iterator end) {
+    if (begin < end) {
+      selection.insert(selection.end(), begin, end);
+    }
+  };
+
+  const auto search_values = std::vector<AllTypeVariant>{predicate.value};
+  switch (predicate.scan_type) {
+    case ScanType::OpEquals:
+      append_range(index.lower_bound(search_values), index.upper_bound(search_values));
+      break;
+    case ScanType::OpNotEquals:
+      append_range(index.cbegin(), index.lower_bound(search_values));
+      append_range(index.upper_bound(search_values), index.cend());
+      break;
+    case ScanType::OpLessThan:
+      append_range(index.cbegin(), index.lower_bound(search_values));
+      break;
+    case ScanType::OpLessThanEquals:
+      append_range(index.cbegin(), index.upper_bound(search_values));
+      break;
+    case ScanType::OpGreaterThan:
+      append_range(index.upper_bound(search_values), index.cend());
+      break;
+    case ScanType::OpGreaterThanEquals:
+      append_range(index.lower_bound(search_values), index.cend());
+      break;
+    case ScanType::OpBetween:
+      append_range(index.lower_bound(search_values), index.upper_bound({predicate.upper_value}));
+      break;
+    case ScanType::OpIn:
+      for (const auto& in_value : predicate.in_values) {
+        if (!variant_is_null(in_value)) {
+          append_range(index.lower_bound({in_value}), index.upper_bound({in_value}));
+        }
+      }
+      break;
+    case ScanType::OpLike:
+      Fail("LIKE cannot be answered by an index.");
+  }
+
+  // The index returns the chunk offsets in key order, but selections are ordered by chunk offset. IN lists may contain
+  // a value more than once.
+  std::sort(selection.begin(), selection.end());
+  if (predicate.scan_type == ScanType::OpIn) {
+    selection.erase(std::unique(selection.begin(), selection.end()), selection.end());
+  }
+  return selection;
+}
+
+float estimate_selectivity(const AbstractSegment& segment, const std::string& data_type,
+                           const ScanPredicate& predicate) {
+  if (never_matches(predicate)) {
+    return 0.0f;
+  }
+
+  auto selectivity = std::optional<float>{};
+  resolve_data_type(data_type, [&](auto type) {
+    using ColumnDataType = typename decltype(type)::type;
+    if (const auto dictionary_segment = dynamic_cast<const DictionarySegment<ColumnDataType>*>(&segment)) {
+      const auto dictionary_size = dictionary_segment->dictionary().size();
+      if (dictionary_size == 0) {
+        selectivity = 0.0f;
+        return;
+      }
+      auto match_count = size_t{0};
+      if (uses_value_id_matches(predicate)) {
+        const auto matches = value_id_matches(*dictionary_segment, predicate);
+        match_count = std::count(matches.cbegin(), matches.cend(), uint8_t{1});
+      } else {
+        match_count = value_id_range(*dictionary_segment, predicate).size();
+      }
+      selectivity = static_cast<float>(match_count) / static_cast<float>(dictionary_size);
+    }
+  });
+  if (selectivity) {
+    return *selectivity;
+  }
+
+  switch (predicate.scan_type) {
+    case ScanType::OpEquals:
+      return DEFAULT_EQUALS_SELECTIVITY;
+    case ScanType::OpNotEquals:
+      return 1.0f - DEFAULT_EQUALS_SELECTIVITY;
+    case ScanType::OpLessThan:
+    case ScanType::OpLessThanEquals:
+    case ScanType::OpGreaterThan:
+    case ScanType::OpGreaterThanEquals:
+      return DEFAULT_RANGE_SELECTIVITY;
+    case ScanType::OpBetween:
+      return DEFAULT_BETWEEN_SELECTIVITY;
+    case ScanType::OpIn:
+      return std::min(1.0f, static_cast<float>(predicate.in_values.size()) * DEFAULT_EQUALS_SELECTIVITY);
+    case ScanType::OpLike:
+      return DEFAULT_LIKE_SELECTIVITY;
+  }
+  Fail("Unsupported ScanType.");
+}
+
+std::shared_ptr<Table> reference_selected_rows(const std::shared_ptr<const Table>& input_table,
+                                               const std::vector<SelectionVector>& selections,
+                                               const std::shared_ptr<QueryMemoryContext>& memory_context) {
+  const auto chunk_count = input_table->chunk_count();
+  DebugAssert(selections.size() == chunk_count, "Expected one SelectionVector per chunk.");
+
+  auto output_table = create_reference_table(*input_table, memory_context);
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    if (const auto output_chunk =
+            reference_selected_rows_of_chunk(input_table, chunk_id, selections[chunk_id], memory_context)) {
+      output_table->emplace_chunk(output_chunk);
+    }
+  }
+
+  return output_table;
+}
+
+std::shared_ptr<Table> create_reference_table(const Table& input_table,
+                                              const std::shared_ptr<QueryMemoryContext>& memory_context) {
+  auto output_table = std::make_shared<Table>(input_table.target_chunk_size(), memory_context);
+  const auto column_count = input_table.column_count();
+  for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+    output_table->add_column(input_table.column_name(column_id), input_table.column_type(column_id),
+                             input_table.column_nullable(column_id));
+  }
+  return output_table;
+}
+
+std::shared_ptr<Chunk> reference_selected_rows_of_chunk(const std::shared_ptr<const Table>& input_table,
+                                                        const ChunkID chunk_id, const SelectionVector& selection,
+                                                        const std::shared_ptr<QueryMemoryContext>& memory_context) {
+  if (selection.empty()) {
+    return nullptr;
+  }
+
+  const auto input_chunk = input_table->get_chunk(chunk_id);
+  const auto output_chunk = make_shared_in<Chunk>(memory_context);
+
+  // The position list for segments that hold data is created on first use. The position lists of ReferenceSegments
+  // are resolved once per input position list.
+  auto data_pos_list = std::shared_ptr<const AbstractPosList>{};
+  auto resolved_pos_lists =
+      std::unordered_map<std::shared_ptr<const AbstractPosList>, std::shared_ptr<const AbstractPosList>>{};
+
+  const auto column_count = input_table->column_count();
+  for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+    const auto segment = input_chunk->get_segment(column_id);
+    if (const auto reference_segment = std::dynamic_pointer_cast<const ReferenceSegment>(segment)) {
+      auto& pos_list = resolved_pos_lists[reference_segment->pos_list()];
+      if (!pos_list) {
+        pos_list = resolve_selected_positions(reference_segment->pos_list(), *reference_segment->referenced_table(),
+                                              selection, memory_context);
+      }
+      const auto& referenced_table = reference_segment->referenced_table();
+      const auto referenced_column_id = reference_segment->referenced_column_id();
+      output_chunk->add_segment(
+          make_shared_in<ReferenceSegment>(memory_context, referenced_table, referenced_column_id, pos_list));
+    } else {
+      if (!data_pos_list) {
+        data_pos_list = make_single_chunk_pos_list(
+            chunk_id, input_chunk->size(),
+            std::pmr::vector<ChunkOffset>{selection.cbegin(), selection.cend(), get_memory_resource(memory_context)},
+            memory_context);
+      }
+      output_chunk->add_segment(
+          make_shared_in<ReferenceSegment>(memory_context, input_table, column_id, data_pos_list));
+    }
+  }
+
+  return output_chunk;
+}
+
+}  // namespace opossum
@@ -0,0 +1,77 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "all_type_variant.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class AbstractSegment;
+class BaseIndex;
+class Chunk;
+class QueryMemoryContext;
+class Table;
+
+// A predicate of the form `column <scan_type> value`. OpBetween matches `value <= column <= upper_value`, OpIn matches
+// if the column equals any of the `in_values`, and OpLike takes the pattern as `value`. Rows for which the column is
+// NULL never qualify.
+struct ScanPredicate {
+  ColumnID column_id;
+  ScanType scan_type;
+  AllTypeVariant value{};
+  AllTypeVariant upper_value{};
+  std::vector<AllTypeVariant> in_values{};
+};
+
+// The ascending offsets of the rows of a chunk that satisfy all predicates evaluated so far.
+using SelectionVector = std::vector<ChunkOffset>;
+
+// Returns the rows of the given chunk that satisfy all predicates. The predicates are evaluated one after another,
+// starting with the one that is estimated to be the most selective in this chunk. Each further predicate only looks at
+// the rows that are still selected, so no intermediate PosList or table is created. If an index of the chunk covers
+// columns with equality predicates, optionally followed by a column with a range or IN predicate (e.g., a = 1 AND b < 5
+// for an index on (a, b)), these predicates are answered by an index lookup, one per value of an IN list, and only the
+// rest is scanned, provided that the lookup finds few enough rows to be faster than a scan (see prefer_index_lookup).
+SelectionVector scan_chunk(const Table& table, const ChunkID chunk_id, const std::vector<ScanPredicate>& predicates);
+
+// Returns the rows of the given chunk for which `left_column <scan_type> right_column` holds. Both segments are
+// accessed with their concrete types and compared row by row without creating AllTypeVariants. Only binary
+// comparisons are supported.
+SelectionVector scan_chunk_column_comparison(const Table& table, const ChunkID chunk_id, const ColumnID left_column_id,
+                                             const ScanType scan_type, const ColumnID right_column_id);
+
+// Returns whether scan_chunk_with_index can evaluate the predicate. This holds for all scan types except OpLike.
+bool index_supports_predicate(const ScanPredicate& predicate);
+
+// Returns the rows of a chunk that satisfy the predicate by looking up its search values in an index over the
+// predicate's column. The work is proportional to the number of qualifying rows (plus sorting them by chunk offset)
+// rather than to the size of the chunk.
+SelectionVector scan_chunk_with_index(const BaseIndex& index, const ScanPredicate& predicate);
+
+// Returns the estimated fraction of rows of the segment that satisfy the predicate. DictionarySegments derive it from
+// the number of qualifying dictionary entries, all other segments use fixed defaults per ScanType.
+float estimate_selectivity(const AbstractSegment& segment, const std::string& data_type,
+                           const ScanPredicate& predicate);
+
+// Returns a table of ReferenceSegments that holds the selected rows of each chunk of `input_table`. If a segment of
+// the input already is a ReferenceSegment, the output points to the table it references, so that reference chains do
+// not grow with each operator. Segments of the same chunk that share a position list also share it in the output.
+// Selections from a single chunk are stored compactly (see make_single_chunk_pos_list). Chunks, segments, and position
+// lists are allocated from the memory context, if one is given.
+std::shared_ptr<Table> reference_selected_rows(const std::shared_ptr<const Table>& input_table,
+                                               const std::vector<SelectionVector>& selections,
+                                               const std::shared_ptr<QueryMemoryContext>& memory_context = nullptr);
+
+// Returns an empty table with the columns of `input_table`, to which reference_selected_rows_of_chunk adds chunks.
+std::shared_ptr<Table> create_reference_table(const Table& input_table,
+                                              const std::shared_ptr<QueryMemoryContext>& memory_context = nullptr);
+
+// Returns a chunk of ReferenceSegments that holds the selected rows of one chunk of `input_table` as described for
+// reference_selected_rows, or nullptr if no row is selected.
+std::shared_ptr<Chunk> reference_selected_rows_of_chunk(
+    const std::shared_ptr<const Table>& input_table, const ChunkID chunk_id, const SelectionVector& selection,
+    const std::shared_ptr<QueryMemoryContext>& memory_context = nullptr);
+
+}  // namespace opossum
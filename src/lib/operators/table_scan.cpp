@@ -0,0 +1,47 @@
+#include "table_scan.hpp"
+
+#include "scan_utils.hpp"
+#include "storage/table.hpp"
+
+namespace opossum {
+
+TableScan::TableScan(const std::shared_ptr<const AbstractOperator>& in, const ColumnID column_id,
+                     const ScanType scan_type, const AllTypeVariant search_value)
+    : AbstractOperator(in), _column_id(column_id), _scan_type(scan_type), _search_value(search_value) {
+  Assert(scan_type != ScanType::OpBetween && scan_type != ScanType::OpIn,
+         "TableScan takes a single search value, use ConjunctiveScan for OpBetween and OpIn.");
+}
+
+ColumnID TableScan::column_id() const {
+  return _column_id;
+}
+
+ScanType TableScan::scan_type() const {
+  return _scan_type;
+}
+
+const AllTypeVariant& TableScan::search_value() const {
+  return _search_value;
+}
+
+bool TableScan::is_pipelineable() const {
+  return true;
+}
+
+std::shared_ptr<const Table> TableScan::_on_execute() {
+  return _execute_chunk_by_chunk();
+}
+
+std::shared_ptr<Table> TableScan::_create_output_table(const std::shared_ptr<const Table>& input_table) const {
+  Assert(_column_id < input_table->column_count(), "Column ID out of range.");
+  return create_reference_table(*input_table, _memory_context);
+}
+
+std::shared_ptr<Chunk> TableScan::_on_execute_chunk(const std::shared_ptr<const Table>& input_table,
+                                                    const ChunkID chunk_id) const {
+  const auto predicates = std::vector<ScanPredicate>{{_column_id, _scan_type, _search_value}};
+  const auto selection = scan_chunk(*input_table, chunk_id, predicates);
+  return reference_selected_rows_of_chunk(input_table, chunk_id, selection, _memory_context);
+}
+
+}  // namespace opossum
@@ -0,0 +1,254 @@
+#include "top_n.hpp"
+
+#include <algorithm>
+#include <functional>
+#include <string_view>
+#include <type_traits>
+
+#include "resolve_type.hpp"
+#include "storage/abstract_attribute_vector.hpp"
+#include "storage/dictionary_segment.hpp"
+#include "storage/materialize.hpp"
+#include "storage/table.hpp"
+#include "storage/value_segment.hpp"
+#include "utils/assert.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT(build/namespaces)
+
+// Keeps the best `limit` rows seen so far. ValueComparator is std::less for ascending and std::greater for descending
+// orders. The entries form a heap whose front is the worst of the kept rows, i.e., the current k-th value.
+template <typename T, typename ValueComparator>
+class BoundedHeap {
+ public:
+  explicit BoundedHeap(const size_t limit) : _limit(limit) {
+    DebugAssert(limit > 0, "BoundedHeap requires a positive limit.");
+    _entries.reserve(limit);
+  }
+
+  bool is_full() const {
+    return _entries.size() == _limit;
+  }
+
+  // Returns whether a row with the given value could still enter the heap. Rows are visited in RowID order, so a value
+  // equal to the current k-th value loses the tie.
+  template <typename Value>
+  bool qualifies(const Value& value) const {
+    if constexpr (std::is_same_v<Value, std::pmr::string>) {
+      // Dictionary strings use a different allocator than T and only compare with it through std::string_view.
+      return qualifies(std::string_view{value});
+    } else {
+      return !is_full() || ValueComparator{}(value, _entries.front().value);
+    }
+  }
+
+  template <typename Value>
+  void push(const Value& value, const RowID row_id) {
+    if (!qualifies(value)) {
+      return;
+    }
+
+    if (is_full()) {
+      std::pop_heap(_entries.begin(), _entries.end(), _precedes);
+      _entries.pop_back();
+    }
+    _entries.push_back({T{value}, row_id});
+    std::push_heap(_entries.begin(), _entries.end(), _precedes);
+  }
+
+  // Returns the RowIDs of the kept rows in output order.
+  std::vector<RowID> sorted_row_ids() {
+    std::sort_heap(_entries.begin(), _entries.end(), _precedes);
+
+    auto row_ids = std::vector<RowID>{};
+    row_ids.reserve(_entries.size());
+    for (const auto& entry : _entries) {
+      row_ids.push_back(entry.row_id);
+    }
+    return row_ids;
+  }
+
+ private:
+  struct Entry {
+    T value;
+    RowID row_id;
+  };
+
+  // Returns whether lhs comes before rhs in the output.
+  static bool _precedes(const Entry& lhs, const Entry& rhs) {
+    const auto value_comparator = ValueComparator{};
+    if (value_comparator(lhs.value, rhs.value)) {
+      return true;
+    }
+    if (value_comparator(rhs.value, lhs.value)) {
+      return false;
+    }
+    return lhs.row_id < rhs.row_id;
+  }
+
+  const size_t _limit;
+  std::vector<Entry> _entries;
+};
+
+// Returns the RowIDs of the best `limit` rows and increments pruned_chunk_count for each chunk that was skipped.
+template <typename T, typename ValueComparator>
+std::vector<RowID> top_n_row_ids(const Table& table, const ColumnID column_id, const size_t limit,
+                                 size_t& pruned_chunk_count) {
+  auto heap = BoundedHeap<T, ValueComparator>{limit};
+
+  // NULLs are sorted last, so they are only part of the result if there are fewer than `limit` non-NULL values. We
+  // stop collecting them as soon as the heap is full.
+  auto null_row_ids = std::vector<RowID>{};
+  const auto add_null = [&](const RowID row_id) {
+    if (!heap.is_full() && null_row_ids.size() < limit) {
+      null_row_ids.push_back(row_id);
+    }
+  };
+
+  const auto chunk_count = table.chunk_count();
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    const auto chunk = table.get_chunk(chunk_id);
+    const auto chunk_size = chunk->size();
+    const auto segment = chunk->get_segment(column_id);
+
+    if (const auto value_segment = std::dynamic_pointer_cast<const ValueSegment<T>>(segment)) {
+      const auto& values = value_segment->values();
+      if (value_segment->is_nullable()) {
+        const auto& validity = value_segment->validity();
+        for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk_size; ++chunk_offset) {
+          if (validity.is_null(chunk_offset)) {
+            add_null(RowID{chunk_id, chunk_offset});
+          } else {
+            heap.push(values[chunk_offset], RowID{chunk_id, chunk_offset});
+          }
+        }
+      } else {
+        for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk_size; ++chunk_offset) {
+          heap.push(values[chunk_offset], RowID{chunk_id, chunk_offset});
+        }
+      }
+    } else if (const auto dictionary_segment = std::dynamic_pointer_cast<const DictionarySegment<T>>(segment)) {
+      // The sorted dictionary gives us the segment's minimum and maximum for free. If even the best value of this
+      // chunk cannot beat the current k-th value, no row of the chunk can enter the heap.
+      const auto& dictionary = dictionary_segment->dictionary();
+      if (heap.is_full()) {
+        if (dictionary.empty()) {
+          ++pruned_chunk_count;
+          continue;
+        }
+        const auto& best_value =
+            ValueComparator{}(dictionary.back(), dictionary.front()) ? dictionary.back() : dictionary.front();
+        if (!heap.qualifies(best_value)) {
+          ++pruned_chunk_count;
+          continue;
+        }
+      }
+
+      const auto& attribute_vector = *dictionary_segment->attribute_vector();
+      const auto null_value_id = dictionary_segment->null_value_id();
+      const auto is_nullable = dictionary_segment->is_nullable();
+      for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk_size; ++chunk_offset) {
+        const auto value_id = attribute_vector.get(chunk_offset);
+        if (is_nullable && value_id == null_value_id) {
+          add_null(RowID{chunk_id, chunk_offset});
+        } else {
+          heap.push(dictionary_segment->value_of_value_id(value_id), RowID{chunk_id, chunk_offset});
+        }
+      }
+    } else {
+      // Other segment types (e.g., ReferenceSegments) are decoded into typed vectors first.
+      auto values = std::vector<T>{};
+      auto nulls = std::vector<bool>{};
+      materialize_values_and_nulls(*segment, values, nulls);
+      for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk_size; ++chunk_offset) {
+        if (nulls[chunk_offset]) {
+          add_null(RowID{chunk_id, chunk_offset});
+        } else {
+          heap.push(values[chunk_offset], RowID{chunk_id, chunk_offset});
+        }
+      }
+    }
+  }
+
+  auto row_ids = heap.sorted_row_ids();
+  const auto missing_row_count = std::min(limit - row_ids.size(), null_row_ids.size());
+  row_ids.insert(row_ids.end(), null_row_ids.begin(), null_row_ids.begin() + missing_row_count);
+  return row_ids;
+}
+
+}  // namespace
+
+namespace opossum {
+
+TopN::TopN(const std::shared_ptr<const AbstractOperator>& in, const ColumnID column_id,
+           const OrderByMode order_by_mode, const size_t limit)
+    : AbstractOperator(in), _column_id(column_id), _order_by_mode(order_by_mode), _limit(limit) {}
+
+ColumnID TopN::column_id() const {
+  return _column_id;
+}
+
+OrderByMode TopN::order_by_mode() const {
+  return _order_by_mode;
+}
+
+size_t TopN::limit() const {
+  return _limit;
+}
+
+size_t TopN::pruned_chunk_count() const {
+  return _pruned_chunk_count;
+}
+
+std::shared_ptr<const Table> TopN::_on_execute() {
+  const auto input_table = _left_input_table();
+  const auto column_count = input_table->column_count();
+  Assert(_column_id < column_count, "Column ID out of range.");
+
+  auto output_table = std::make_shared<Table>(input_table->target_chunk_size(), _memory_context);
+  for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+    output_table->add_column(input_table->column_name(column_id), input_table->column_type(column_id),
+                             input_table->column_nullable(column_id));
+  }
+
+  _pruned_chunk_count = 0;
+  if (_limit == 0) {
+    return output_table;
+  }
+
+  auto row_ids = std::vector<RowID>{};
+  resolve_data_type(input_table->column_type(_column_id), [&](auto type) {
+    using ColumnDataType = typename decltype(type)::type;
+    if (_order_by_mode == OrderByMode::Ascending) {
+      row_ids = top_n_row_ids<ColumnDataType, std::less<>>(*input_table, _column_id, _limit, _pruned_chunk_count);
+    } else {
+      row_ids = top_n_row_ids<ColumnDataType, std::greater<>>(*input_table, _column_id, _limit, _pruned_chunk_count);
+    }
+  });
+
+  // The result holds at most `limit` rows, so we materialize it instead of referencing the input.
+  const auto row_count = row_ids.size();
+  const auto target_chunk_size = size_t{input_table->target_chunk_size()};
+  for (auto chunk_begin = size_t{0}; chunk_begin < row_count; chunk_begin += target_chunk_size) {
+    const auto chunk_end = std::min(chunk_begin + target_chunk_size, row_count);
+    const auto chunk = make_shared_in<Chunk>(_memory_context);
+    for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+      resolve_data_type(input_table->column_type(column_id), [&](auto type) {
+        using ColumnDataType = typename decltype(type)::type;
+        const auto segment = make_shared_in<ValueSegment<ColumnDataType>>(
+            _memory_context, input_table->column_nullable(column_id), output_table->memory_resource());
+        for (auto row_index = chunk_begin; row_index < chunk_end; ++row_index) {
+          const auto& row_id = row_ids[row_index];
+          segment->append((*input_table->get_chunk(row_id.chunk_id)->get_segment(column_id))[row_id.chunk_offset]);
+        }
+        chunk->add_segment(segment);
+      });
+    }
+    output_table->emplace_chunk(chunk);
+  }
+
+  return output_table;
+}
+
+}  // namespace opossum
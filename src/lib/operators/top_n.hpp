@@ -0,0 +1,38 @@
+#pragma once
+
+#include "abstract_operator.hpp"
+
+namespace opossum {
+
+/**
+ * Operator for ORDER BY ... LIMIT k queries. Instead of sorting the entire input, TopN keeps a bounded heap holding the
+ * best k rows seen so far. Once the heap is full, dictionary-encoded chunks whose smallest (or largest) value cannot
+ * beat the current k-th value are skipped without looking at their attribute vectors.
+ *
+ * Ties are broken by the position in the input table, i.e., earlier rows win. NULL values are sorted last for both
+ * orders. The result is a materialized table with the input's schema.
+ */
+class TopN : public AbstractOperator {
+ public:
+  TopN(const std::shared_ptr<const AbstractOperator>& in, const ColumnID column_id, const OrderByMode order_by_mode,
+       const size_t limit);
+
+  ColumnID column_id() const;
+
+  OrderByMode order_by_mode() const;
+
+  size_t limit() const;
+
+  // Returns the number of dictionary-encoded chunks that the last execution skipped.
+  size_t pruned_chunk_count() const;
+
+ protected:
+  std::shared_ptr<const Table> _on_execute() override;
+
+  const ColumnID _column_id;
+  const OrderByMode _order_by_mode;
+  const size_t _limit;
+  size_t _pruned_chunk_count = 0;
+};
+
+}  // namespace opossum
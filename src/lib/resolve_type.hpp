@@ -70,4 +70,31 @@ void resolve_data_type(const std::string& type_string, const Functor& func) {
   });
 }
 
+/**
+ * Returns the type string (e.g., "int") of a supported data type. This is the inverse of resolve_data_type.
+ */
+template <typename T>
+std::string data_type_name() {
+  auto name = std::string{};
+  hana::for_each(data_types, [&](auto x) {
+    if constexpr (std::is_same_v<typename decltype(+hana::second(x))::type, T>) {
+      name = hana::first(x);
+    }
+  });
+  return name;
+}
+
+/**
+ * Returns the type string of the value stored in an AllTypeVariant, or an empty string if the value is NULL.
+ */
+inline std::string data_type_from_all_type_variant(const AllTypeVariant& value) {
+  auto name = std::string{};
+  hana::for_each(data_types, [&](auto x) {
+    if (value.type() == typeid(typename decltype(+hana::second(x))::type)) {
+      name = hana::first(x);
+    }
+  });
+  return name;
+}
+
 }  // namespace opossum
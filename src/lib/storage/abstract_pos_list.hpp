@@ -0,0 +1,34 @@
+#pragma once
+
+#include <optional>
+
+#include "types.hpp"
+
+namespace opossum {
+
+// AbstractPosList is the abstract super class for all position lists, i.e., lists of RowIDs that ReferenceSegments
+// point to. Besides the plain PosList, which stores one RowID per position, there are more compact representations for
+// positions that all lie in a single chunk (SingleChunkPosList, EntireChunkPosList, BitmapPosList). Operators that need
+// many positions should resolve the concrete type (see resolve_pos_list_type) instead of calling operator[] per row.
+class AbstractPosList {
+ public:
+  virtual ~AbstractPosList() = default;
+
+  // Returns the RowID at the given position.
+  virtual RowID operator[](const size_t index) const = 0;
+
+  // Returns the number of positions.
+  virtual size_t size() const = 0;
+
+  bool empty() const {
+    return size() == 0;
+  }
+
+  // Returns the ChunkID if all positions are known to lie in this chunk. Such lists never contain NULL_ROW_ID.
+  virtual std::optional<ChunkID> single_chunk_id() const = 0;
+
+  // Returns the number of bytes used to store the positions.
+  virtual size_t memory_usage() const = 0;
+};
+
+}  // namespace opossum
@@ -0,0 +1,34 @@
+#pragma once
+
+#include <memory>
+
+#include "abstract_segment.hpp"
+
+namespace opossum {
+
+class AbstractAttributeVector;
+
+// BaseDictionarySegment is the type-independent interface of DictionarySegment<T>. Components that only work on
+// ValueIDs, such as the GroupKeyIndex, use it without resolving the data type of the segment.
+class BaseDictionarySegment : public AbstractSegment {
+ public:
+  // Returns the ValueIDs of all rows.
+  virtual std::shared_ptr<const AbstractAttributeVector> attribute_vector() const = 0;
+
+  // Returns whether the segment can contain NULL values.
+  virtual bool is_nullable() const = 0;
+
+  // Returns the ValueID used to represent a NULL value.
+  virtual ValueID null_value_id() const = 0;
+
+  // Returns the first ValueID that refers to a value >= the search value, or INVALID_VALUE_ID.
+  virtual ValueID lower_bound(const AllTypeVariant& value) const = 0;
+
+  // Returns the first ValueID that refers to a value > the search value, or INVALID_VALUE_ID.
+  virtual ValueID upper_bound(const AllTypeVariant& value) const = 0;
+
+  // Returns the number of dictionary entries.
+  virtual ChunkOffset unique_values_count() const = 0;
+};
+
+}  // namespace opossum
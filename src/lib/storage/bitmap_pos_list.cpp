@@ -0,0 +1,99 @@
+#include "bitmap_pos_list.hpp"
+
+#include <algorithm>
+#include <functional>
+#include <iterator>
+
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+BitmapPosList::BitmapPosList(const ChunkID chunk_id, const std::span<const ChunkOffset> chunk_offsets,
+                             std::pmr::memory_resource* memory_resource)
+    : _chunk_id(chunk_id), _size(chunk_offsets.size()), _blocks(memory_resource) {
+  DebugAssert(std::adjacent_find(chunk_offsets.begin(), chunk_offsets.end(), std::greater_equal<>{}) ==
+                  chunk_offsets.end(),
+              "Chunk offsets have to be strictly ascending.");
+
+  auto block_begin = chunk_offsets.begin();
+  while (block_begin != chunk_offsets.end()) {
+    const auto base = *block_begin & ~(BLOCK_SIZE - 1);
+    const auto block_end = std::lower_bound(block_begin, chunk_offsets.end(), base + BLOCK_SIZE);
+    const auto position_count = static_cast<size_t>(block_end - block_begin);
+
+    auto block = Block{.base = base,
+                       .first_index = static_cast<size_t>(block_begin - chunk_offsets.begin()),
+                       .array = std::pmr::vector<uint16_t>{memory_resource},
+                       .bitmap = std::pmr::vector<uint64_t>{memory_resource}};
+    if (position_count <= MAX_ARRAY_SIZE) {
+      block.array.reserve(position_count);
+      for (auto iter = block_begin; iter != block_end; ++iter) {
+        block.array.push_back(static_cast<uint16_t>(*iter - base));
+      }
+    } else {
+      block.bitmap.resize(BLOCK_SIZE / 64);
+      for (auto iter = block_begin; iter != block_end; ++iter) {
+        const auto lower_bits = *iter - base;
+        block.bitmap[lower_bits / 64] |= uint64_t{1} << (lower_bits % 64);
+      }
+    }
+
+    _blocks.push_back(std::move(block));
+    block_begin = block_end;
+  }
+}
+
+RowID BitmapPosList::operator[](const size_t index) const {
+  DebugAssert(index < _size, "Index out of range.");
+  const auto block = std::prev(std::upper_bound(_blocks.cbegin(), _blocks.cend(), index,
+                                                [](const auto value, const auto& block) {
+                                                  return value < block.first_index;
+                                                }));
+  auto rank = index - block->first_index;
+  if (!block->array.empty()) {
+    return RowID{_chunk_id, block->base + block->array[rank]};
+  }
+
+  auto word_index = size_t{0};
+  auto word = block->bitmap[0];
+  for (auto bit_count = static_cast<size_t>(std::popcount(word)); rank >= bit_count;
+       bit_count = static_cast<size_t>(std::popcount(word))) {
+    rank -= bit_count;
+    word = block->bitmap[++word_index];
+  }
+
+  // Clears the lower set bits of the word until the requested one is the lowest.
+  for (; rank > 0; --rank) {
+    word &= word - 1;
+  }
+  return RowID{_chunk_id, block->base + static_cast<ChunkOffset>(word_index * 64 + std::countr_zero(word))};
+}
+
+size_t BitmapPosList::size() const {
+  return _size;
+}
+
+std::optional<ChunkID> BitmapPosList::single_chunk_id() const {
+  return _chunk_id;
+}
+
+size_t BitmapPosList::memory_usage() const {
+  auto bytes = _blocks.size() * sizeof(Block);
+  for (const auto& block : _blocks) {
+    bytes += block.array.size() * sizeof(uint16_t) + block.bitmap.size() * sizeof(uint64_t);
+  }
+  return bytes;
+}
+
+std::pmr::memory_resource* BitmapPosList::memory_resource() const {
+  return _blocks.get_allocator().resource();
+}
+
+std::vector<ChunkOffset> BitmapPosList::chunk_offsets() const {
+  auto chunk_offsets = std::vector<ChunkOffset>{};
+  chunk_offsets.reserve(_size);
+  for_each_chunk_offset([&](const auto chunk_offset) { chunk_offsets.push_back(chunk_offset); });
+  return chunk_offsets;
+}
+
+}  // namespace opossum
@@ -0,0 +1,73 @@
+#pragma once
+
+#include <bit>
+#include <memory_resource>
+#include <span>
+#include <vector>
+
+#include "abstract_pos_list.hpp"
+
+namespace opossum {
+
+// BitmapPosList references an ascending set of positions of a single chunk and is meant for dense selections. Like a
+// roaring bitmap, it splits the chunk into blocks of 2^16 rows. A block stores its positions either as a sorted array
+// of their lower 16 bits (two bytes per position) or, if it holds more than MAX_ARRAY_SIZE positions, as a bitmap of
+// 8 KB. Blocks without positions are not stored. Iterating over the positions with for_each_chunk_offset is cheap,
+// while operator[] has to search for the block and, for bitmaps, count bits.
+class BitmapPosList final : public AbstractPosList {
+ public:
+  static constexpr auto BLOCK_SIZE = ChunkOffset{1} << 16;
+  static constexpr auto MAX_ARRAY_SIZE = size_t{4096};
+
+  // The chunk offsets have to be strictly ascending. The blocks are allocated from the given memory resource.
+  BitmapPosList(const ChunkID chunk_id, const std::span<const ChunkOffset> chunk_offsets,
+                std::pmr::memory_resource* memory_resource = std::pmr::get_default_resource());
+
+  RowID operator[](const size_t index) const final;
+
+  size_t size() const final;
+
+  std::optional<ChunkID> single_chunk_id() const final;
+
+  size_t memory_usage() const final;
+
+  // Calls functor(chunk_offset) for all positions in ascending order.
+  template <typename Functor>
+  void for_each_chunk_offset(const Functor& functor) const {
+    for (const auto& block : _blocks) {
+      for (const auto lower_bits : block.array) {
+        functor(block.base + lower_bits);
+      }
+
+      const auto word_count = static_cast<ChunkOffset>(block.bitmap.size());
+      for (auto word_index = ChunkOffset{0}; word_index < word_count; ++word_index) {
+        auto word = block.bitmap[word_index];
+        while (word) {
+          functor(block.base + word_index * 64 + static_cast<ChunkOffset>(std::countr_zero(word)));
+          word &= word - 1;
+        }
+      }
+    }
+  }
+
+  // Returns the chunk offsets of all positions in ascending order.
+  std::vector<ChunkOffset> chunk_offsets() const;
+
+  std::pmr::memory_resource* memory_resource() const;
+
+ protected:
+  // Either `array` or `bitmap` is used.
+  struct Block {
+    ChunkOffset base{};
+    // Index of the first position of the block within the list.
+    size_t first_index{};
+    std::pmr::vector<uint16_t> array{};
+    std::pmr::vector<uint64_t> bitmap{};
+  };
+
+  const ChunkID _chunk_id;
+  size_t _size{};
+  std::pmr::vector<Block> _blocks;
+};
+
+}  // namespace opossum
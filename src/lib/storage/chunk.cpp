@@ -1,6 +1,11 @@
 #include "chunk.hpp"
 
+#include <algorithm>
+#include <unordered_set>
+
 #include "abstract_segment.hpp"
+#include "index/base_index.hpp"
+#include "reference_segment.hpp"
 #include "resolve_type.hpp"
 #include "utils/assert.hpp"
 #include "value_segment.hpp"
@@ -15,6 +20,7 @@ void Chunk::append(const std::vector<AllTypeVariant>& values) {
   static const auto data_types = std::vector<std::string>{"int", "long", "float", "double", "string"};
   const auto column_count = _segments.size();
   Assert(values.size() == column_count, "Number of segments does not match value list.");
+  Assert(_indexes.empty(), "Cannot append to a chunk with indexes.");
 
   for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
     auto success = false;
@@ -41,6 +47,55 @@ std::shared_ptr<AbstractSegment> Chunk::get_segment(const ColumnID column_id) co
   return _segments.at(column_id);
 }
 
+const std::vector<std::shared_ptr<BaseIndex>>& Chunk::get_indexes() const {
+  return _indexes;
+}
+
+std::vector<std::shared_ptr<BaseIndex>> Chunk::get_indexes(const std::vector<ColumnID>& column_ids) const {
+  const auto segments = _get_segments_for_ids(column_ids);
+  auto indexes = std::vector<std::shared_ptr<BaseIndex>>{};
+  for (const auto& index : _indexes) {
+    if (index->is_index_for(segments)) {
+      indexes.push_back(index);
+    }
+  }
+  return indexes;
+}
+
+void Chunk::remove_index(const std::shared_ptr<BaseIndex>& index) {
+  const auto iter = std::find(_indexes.cbegin(), _indexes.cend(), index);
+  Assert(iter != _indexes.cend(), "Index is not part of this chunk.");
+  _indexes.erase(iter);
+}
+
+size_t Chunk::estimate_memory_usage() const {
+  auto memory_usage = size_t{0};
+  auto counted_pos_lists = std::unordered_set<const AbstractPosList*>{};
+  for (const auto& segment : _segments) {
+    if (const auto reference_segment = std::dynamic_pointer_cast<const ReferenceSegment>(segment)) {
+      if (!counted_pos_lists.insert(reference_segment->pos_list().get()).second) {
+        continue;
+      }
+    }
+    memory_usage += segment->estimate_memory_usage();
+  }
+
+  for (const auto& index : _indexes) {
+    memory_usage += index->memory_consumption();
+  }
+  return memory_usage;
+}
+
+std::vector<std::shared_ptr<const AbstractSegment>> Chunk::_get_segments_for_ids(
+    const std::vector<ColumnID>& column_ids) const {
+  auto segments = std::vector<std::shared_ptr<const AbstractSegment>>{};
+  segments.reserve(column_ids.size());
+  for (const auto column_id : column_ids) {
+    segments.push_back(get_segment(column_id));
+  }
+  return segments;
+}
+
 ColumnCount Chunk::column_count() const {
   return ColumnCount(_segments.size());
 }
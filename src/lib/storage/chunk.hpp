@@ -1,6 +1,7 @@
 #pragma once
 
 #include <memory>
+#include <vector>
 
 #include "all_type_variant.hpp"
 #include "types.hpp"
@@ -35,9 +36,36 @@ class Chunk : private Noncopyable {
   // Returns the segment at a given position.
   std::shared_ptr<AbstractSegment> get_segment(ColumnID column_id) const;
 
+  // Creates an index of the given type (e.g., SortedIndex) over the segments of the given columns and adds it to the
+  // chunk. Indexes are not maintained on appends, so they should only be created for chunks that are complete.
+  template <typename Index>
+  std::shared_ptr<Index> create_index(const std::vector<ColumnID>& column_ids) {
+    const auto index = std::make_shared<Index>(_get_segments_for_ids(column_ids));
+    _indexes.emplace_back(index);
+    return index;
+  }
+
+  // Returns all indexes of the chunk.
+  const std::vector<std::shared_ptr<BaseIndex>>& get_indexes() const;
+
+  // Returns the indexes that cover exactly the given columns in this order.
+  std::vector<std::shared_ptr<BaseIndex>> get_indexes(const std::vector<ColumnID>& column_ids) const;
+
+  // Removes an index from the chunk.
+  void remove_index(const std::shared_ptr<BaseIndex>& index);
+
+  // Returns the calculated memory usage of all segments and indexes. Position lists that are shared by the
+  // ReferenceSegments of the chunk are counted once.
+  size_t estimate_memory_usage() const;
+
  protected:
+  std::vector<std::shared_ptr<const AbstractSegment>> _get_segments_for_ids(
+      const std::vector<ColumnID>& column_ids) const;
+
   // The segments of the chunk. Each segment represents a column in the table.
   std::vector<std::shared_ptr<AbstractSegment>> _segments;
+
+  std::vector<std::shared_ptr<BaseIndex>> _indexes;
 };
 
 }  // namespace opossum
@@ -0,0 +1,187 @@
+#include "chunk_file.hpp"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cstring>
+#include <fstream>
+#include <type_traits>
+
+#include "chunk.hpp"
+#include "dictionary_segment.hpp"
+#include "fixed_width_integer_vector.hpp"
+#include "query_memory_context.hpp"
+#include "resolve_type.hpp"
+#include "utils/assert.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT(build/namespaces)
+
+template <typename T>
+void write_scalar(std::ofstream& stream, const T value) {
+  stream.write(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+template <typename T>
+void write_values(std::ofstream& stream, const std::pmr::vector<T>& values) {
+  write_scalar(stream, static_cast<uint32_t>(values.size()));
+  if constexpr (std::is_same_v<T, std::pmr::string>) {
+    for (const auto& value : values) {
+      write_scalar(stream, static_cast<uint32_t>(value.size()));
+      stream.write(value.data(), static_cast<std::streamsize>(value.size()));
+    }
+  } else {
+    stream.write(reinterpret_cast<const char*>(values.data()), static_cast<std::streamsize>(values.size() * sizeof(T)));
+  }
+}
+
+template <typename T>
+void write_dictionary_segment(std::ofstream& stream, const DictionarySegment<T>& segment) {
+  write_scalar(stream, static_cast<uint8_t>(segment.is_nullable()));
+  write_values(stream, segment.dictionary());
+
+  const auto& attribute_vector = *segment.attribute_vector();
+  write_scalar(stream, attribute_vector.width());
+  with_value_ids(attribute_vector, [&](const auto& value_ids) { write_values(stream, value_ids); });
+}
+
+// Reads the contents of a memory-mapped chunk file front to back. Values are copied with memcpy, since the file does
+// not align them. Segments and their values are allocated from the memory context, if one is given.
+class ChunkFileReader {
+ public:
+  ChunkFileReader(const char* begin, const size_t size, const std::shared_ptr<QueryMemoryContext>& memory_context)
+      : _position(begin), _end(begin + size), _memory_context(memory_context) {}
+
+  template <typename T>
+  T read_scalar() {
+    auto value = T{};
+    _read(&value, sizeof(T));
+    return value;
+  }
+
+  template <typename T>
+  std::pmr::vector<T> read_values() {
+    const auto count = read_scalar<uint32_t>();
+    auto values = std::pmr::vector<T>(count, get_memory_resource(_memory_context));
+    // The strings of a vector use its memory resource as well.
+    if constexpr (std::is_same_v<T, std::pmr::string>) {
+      for (auto& value : values) {
+        value.resize(read_scalar<uint32_t>());
+        _read(value.data(), value.size());
+      }
+    } else {
+      _read(values.data(), count * sizeof(T));
+    }
+    return values;
+  }
+
+  template <typename T>
+  std::shared_ptr<DictionarySegment<T>> read_dictionary_segment() {
+    const auto nullable = read_scalar<uint8_t>() != 0;
+    auto dictionary = read_values<DictionaryEntry<T>>();
+
+    auto attribute_vector = std::shared_ptr<AbstractAttributeVector>{};
+    const auto width = read_scalar<AttributeVectorWidth>();
+    if (width == 1) {
+      attribute_vector = make_shared_in<FixedWidthIntegerVector<uint8_t>>(_memory_context, read_values<uint8_t>());
+    } else if (width == 2) {
+      attribute_vector = make_shared_in<FixedWidthIntegerVector<uint16_t>>(_memory_context, read_values<uint16_t>());
+    } else {
+      Assert(width == 4, "Invalid attribute vector width in chunk file.");
+      attribute_vector = make_shared_in<FixedWidthIntegerVector<uint32_t>>(_memory_context, read_values<uint32_t>());
+    }
+    return make_shared_in<DictionarySegment<T>>(_memory_context, std::move(dictionary), attribute_vector, nullable);
+  }
+
+  bool at_end() const {
+    return _position == _end;
+  }
+
+ protected:
+  void _read(void* destination, const size_t size) {
+    Assert(static_cast<size_t>(_end - _position) >= size, "Chunk file is truncated.");
+    std::memcpy(destination, _position, size);
+    _position += size;
+  }
+
+  const char* _position;
+  const char* const _end;
+  const std::shared_ptr<QueryMemoryContext> _memory_context;
+};
+
+}  // namespace
+
+namespace opossum {
+
+bool can_write_chunk_file(const Chunk& chunk) {
+  if (!chunk.get_indexes().empty()) {
+    return false;
+  }
+
+  const auto column_count = chunk.column_count();
+  for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+    if (!std::dynamic_pointer_cast<const BaseDictionarySegment>(chunk.get_segment(column_id))) {
+      return false;
+    }
+  }
+  return true;
+}
+
+void write_chunk_file(const Chunk& chunk, const std::filesystem::path& path) {
+  Assert(can_write_chunk_file(chunk), "Only dictionary-encoded chunks without indexes can be written to a file.");
+  auto stream = std::ofstream{path, std::ios::binary | std::ios::trunc};
+  Assert(stream.is_open(), "Cannot open chunk file " + path.string() + ".");
+
+  const auto column_count = chunk.column_count();
+  write_scalar(stream, static_cast<uint32_t>(column_count));
+  for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+    const auto segment = chunk.get_segment(column_id);
+    hana::for_each(types, [&](auto type) {
+      using DataType = typename decltype(type)::type;
+      if (const auto dictionary_segment = std::dynamic_pointer_cast<const DictionarySegment<DataType>>(segment)) {
+        write_dictionary_segment(stream, *dictionary_segment);
+      }
+    });
+  }
+
+  stream.close();
+  Assert(stream.good(), "Cannot write chunk file " + path.string() + ".");
+}
+
+std::shared_ptr<Chunk> read_chunk_file(const std::filesystem::path& path, const std::vector<std::string>& column_types,
+                                       const std::shared_ptr<QueryMemoryContext>& memory_context) {
+  const auto file_descriptor = open(path.c_str(), O_RDONLY);
+  Assert(file_descriptor >= 0, "Cannot open chunk file " + path.string() + ".");
+  struct stat file_stat {};
+  fstat(file_descriptor, &file_stat);
+  const auto file_size = static_cast<size_t>(file_stat.st_size);
+  auto* const mapping = mmap(nullptr, file_size, PROT_READ, MAP_PRIVATE, file_descriptor, 0);
+  close(file_descriptor);
+  Assert(mapping != MAP_FAILED, "Cannot map chunk file " + path.string() + ".");
+  // The whole file is read once, front to back.
+  madvise(mapping, file_size, MADV_SEQUENTIAL);
+
+  auto chunk = make_shared_in<Chunk>(memory_context);
+  try {
+    auto reader = ChunkFileReader{static_cast<const char*>(mapping), file_size, memory_context};
+    Assert(reader.read_scalar<uint32_t>() == column_types.size(), "Chunk file does not match the column types.");
+    for (const auto& column_type : column_types) {
+      resolve_data_type(column_type, [&](auto type) {
+        using DataType = typename decltype(type)::type;
+        chunk->add_segment(reader.read_dictionary_segment<DataType>());
+      });
+    }
+    Assert(reader.at_end(), "Chunk file has trailing data.");
+  } catch (...) {
+    munmap(mapping, file_size);
+    throw;
+  }
+
+  munmap(mapping, file_size);
+  return chunk;
+}
+
+}  // namespace opossum
@@ -0,0 +1,28 @@
+#pragma once
+
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace opossum {
+
+class Chunk;
+class QueryMemoryContext;
+
+// Returns whether a chunk can be written to a chunk file, i.e., whether it is dictionary-encoded and has no indexes,
+// which would not survive the round trip.
+bool can_write_chunk_file(const Chunk& chunk);
+
+// Writes a dictionary-encoded chunk to a binary file. For each segment, the file holds its NULL flag, its dictionary
+// (strings prefixed with their length), and the raw ValueIDs of its attribute vector. The data types of the segments
+// are not stored, so they have to be passed when reading the file.
+void write_chunk_file(const Chunk& chunk, const std::filesystem::path& path);
+
+// Reads a chunk from a file written by write_chunk_file. The file is mapped into memory, and dictionaries and attribute
+// vectors are copied from the mapping with a single pass over it. The chunk, its segments, and their values are
+// allocated from the memory context, if one is given.
+std::shared_ptr<Chunk> read_chunk_file(const std::filesystem::path& path, const std::vector<std::string>& column_types,
+                                       const std::shared_ptr<QueryMemoryContext>& memory_context = nullptr);
+
+}  // namespace opossum
@@ -0,0 +1,65 @@
+#include "compact_string_vector.hpp"
+
+#include <algorithm>
+#include <limits>
+
+#include "utils/assert.hpp"
+
+namespace {
+
+// Returns the first four characters of a string, padded with zeros.
+std::array<char, sizeof(uint32_t)> padded_prefix(const std::string_view value) {
+  auto prefix = std::array<char, sizeof(uint32_t)>{};
+  std::copy_n(value.data(), std::min(value.size(), prefix.size()), prefix.data());
+  return prefix;
+}
+
+}  // namespace
+
+namespace opossum {
+
+CompactStringVector::ComparisonValue::ComparisonValue(const std::string_view value)
+    : _value(value), _prefix(CompactStringVector::_prefix(padded_prefix(value).data())) {}
+
+CompactStringVector::CompactStringVector(std::pmr::memory_resource* memory_resource)
+    : _headers(memory_resource), _characters(memory_resource) {}
+
+CompactStringVector::CompactStringVector(std::span<const std::string> values,
+                                         std::pmr::memory_resource* memory_resource)
+    : CompactStringVector(memory_resource) {
+  auto character_count = size_t{0};
+  for (const auto& value : values) {
+    character_count += value.size() > INLINE_SIZE ? value.size() : 0;
+  }
+  reserve(values.size(), character_count);
+
+  for (const auto& value : values) {
+    push_back(value);
+  }
+}
+
+void CompactStringVector::push_back(const std::string_view value) {
+  Assert(value.size() <= std::numeric_limits<uint32_t>::max(), "String is too long.");
+  auto header = Header{static_cast<uint32_t>(value.size()), {}};
+  if (value.size() <= INLINE_SIZE) {
+    std::copy(value.cbegin(), value.cend(), header.data.begin());
+  } else {
+    const auto prefix = padded_prefix(value);
+    std::copy(prefix.cbegin(), prefix.cend(), header.data.begin());
+    const auto offset = uint64_t{_characters.size()};
+    std::memcpy(header.data.data() + sizeof(uint32_t), &offset, sizeof(offset));
+    _characters.insert(_characters.end(), value.cbegin(), value.cend());
+  }
+  _headers.push_back(header);
+}
+
+void CompactStringVector::reserve(const size_t value_count, const size_t character_count) {
+  _headers.reserve(value_count);
+  _characters.reserve(character_count);
+}
+
+size_t CompactStringVector::memory_usage() const {
+  return _headers.size() * sizeof(Header) + _characters.size();
+}
+
+}  // namespace opossum
@@ -0,0 +1,131 @@
+#pragma once
+
+#include <array>
+#include <bit>
+#include <cstdint>
+#include <cstring>
+#include <memory_resource>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace opossum {
+
+/**
+ * The values of a ValueSegment<std::string>, stored without a heap allocation per value. Each string has a 16-byte
+ * header (the "German string" layout of Umbra): its length, its first four characters, and either the remaining
+ * characters if the string has at most 12 of them, or the offset of the whole string in a contiguous character arena.
+ * Compared to a std::vector<std::string>, this halves the fixed size per value, and appending only ever grows two
+ * vectors.
+ *
+ * Strings are returned as std::string_views, which stay valid until the next append. Comparisons with a prepared
+ * ComparisonValue look at the lengths and four-character prefixes first, which decides most of them without touching
+ * the arena. Headers and arena are allocated from the memory resource passed on construction.
+ */
+class CompactStringVector {
+ public:
+  // Strings with at most this many characters are stored in their header.
+  static constexpr auto INLINE_SIZE = size_t{12};
+
+  // A string that values of the vector are compared with. Its prefix is prepared once for all comparisons.
+  class ComparisonValue {
+   public:
+    explicit ComparisonValue(const std::string_view value);
+
+   protected:
+    friend class CompactStringVector;
+
+    const std::string_view _value;
+    const uint32_t _prefix;
+  };
+
+  explicit CompactStringVector(std::pmr::memory_resource* memory_resource = std::pmr::get_default_resource());
+
+  explicit CompactStringVector(std::span<const std::string> values,
+                               std::pmr::memory_resource* memory_resource = std::pmr::get_default_resource());
+
+  std::string_view operator[](const size_t index) const {
+    const auto& header = _headers[index];
+    if (header.size <= INLINE_SIZE) {
+      return {header.data.data(), header.size};
+    }
+    return {_characters.data() + _arena_offset(header), header.size};
+  }
+
+  // Prefetches the header of the value at `index`.
+  void prefetch(const size_t index) const {
+    __builtin_prefetch(&_headers[index]);
+  }
+
+  void push_back(const std::string_view value);
+
+  // Reserves memory for `value_count` values with `character_count` characters in total.
+  void reserve(const size_t value_count, const size_t character_count = 0);
+
+  size_t size() const {
+    return _headers.size();
+  }
+
+  bool empty() const {
+    return _headers.empty();
+  }
+
+  // Returns a negative number, zero, or a positive number if the value at `index` is less than, equal to, or greater
+  // than `value`, like std::string::compare.
+  int compare(const size_t index, const ComparisonValue& value) const {
+    const auto& header = _headers[index];
+    const auto prefix = _prefix(header.data.data());
+    if (prefix != value._prefix) {
+      return prefix < value._prefix ? -1 : 1;
+    }
+    // Equal prefixes of strings with at most four characters differ at most in trailing zero characters.
+    if (header.size <= sizeof(uint32_t) && value._value.size() <= sizeof(uint32_t)) {
+      return static_cast<int>(header.size) - static_cast<int>(value._value.size());
+    }
+    return (*this)[index].compare(value._value);
+  }
+
+  bool equals(const size_t index, const ComparisonValue& value) const {
+    const auto& header = _headers[index];
+    return header.size == value._value.size() && _prefix(header.data.data()) == value._prefix &&
+           (*this)[index] == value._value;
+  }
+
+  // Returns the number of bytes used by the headers and the arena.
+  size_t memory_usage() const;
+
+  std::pmr::polymorphic_allocator<> get_allocator() const {
+    return _headers.get_allocator();
+  }
+
+ protected:
+  struct Header {
+    uint32_t size;
+    // The first four characters, followed by either the next eight characters or the arena offset. Unused characters
+    // are zero.
+    std::array<char, INLINE_SIZE> data;
+  };
+  static_assert(sizeof(Header) == 16);
+
+  // Returns the first four characters as a big-endian integer, so that prefixes compare like the characters.
+  static uint32_t _prefix(const char* characters) {
+    auto prefix = uint32_t{0};
+    std::memcpy(&prefix, characters, sizeof(prefix));
+    if constexpr (std::endian::native == std::endian::little) {
+      prefix = __builtin_bswap32(prefix);
+    }
+    return prefix;
+  }
+
+  static uint64_t _arena_offset(const Header& header) {
+    auto offset = uint64_t{0};
+    std::memcpy(&offset, header.data.data() + sizeof(uint32_t), sizeof(offset));
+    return offset;
+  }
+
+  std::pmr::vector<Header> _headers;
+  std::pmr::vector<char> _characters;
+};
+
+}  // namespace opossum
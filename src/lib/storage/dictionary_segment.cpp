@@ -1,7 +1,10 @@
 #include "dictionary_segment.hpp"
 
-#include <map>
-#include <set>
+#include <algorithm>
+#include <bit>
+#include <string_view>
+#include <utility>
+
 #include "fixed_width_integer_vector.hpp"
 #include "type_cast.hpp"
 #include "utils/assert.hpp"
@@ -9,59 +12,87 @@
 
 namespace opossum {
 
-std::shared_ptr<AbstractAttributeVector> get_attribute_vector(size_t vector_size, size_t size) {
-  const auto bits_needed = std::bit_width(vector_size - 1);
+std::shared_ptr<AbstractAttributeVector> get_attribute_vector(size_t value_id_count, size_t size,
+                                                              std::pmr::memory_resource* memory_resource) {
+  // The largest ValueID that has to be stored is value_id_count - 1. An empty dictionary still needs one bit.
+  const auto bits_needed = std::bit_width(std::max(value_id_count, size_t{2}) - 1);
   Assert(bits_needed <= 32, "Too many values in dictionary, cant use more than 32 bits!");
   if (bits_needed <= 8) {
-    return std::make_shared<FixedWidthIntegerVector<uint8_t>>(size);
+    return std::make_shared<FixedWidthIntegerVector<uint8_t>>(size, memory_resource);
   }
   if (bits_needed <= 16) {
-    return std::make_shared<FixedWidthIntegerVector<uint16_t>>(size);
+    return std::make_shared<FixedWidthIntegerVector<uint16_t>>(size, memory_resource);
+  }
+  return std::make_shared<FixedWidthIntegerVector<uint32_t>>(size, memory_resource);
+}
+
+// Returns the memory resource of a ValueSegment, or the default one for other segments (which cannot be encoded).
+template <typename T>
+std::pmr::memory_resource* abstract_segment_memory_resource(const std::shared_ptr<AbstractSegment>& segment) {
+  if (const auto value_segment = std::dynamic_pointer_cast<const ValueSegment<T>>(segment)) {
+    return value_segment->memory_resource();
+  }
+  return std::pmr::get_default_resource();
+}
+
+// Returns a value in a form that compares with dictionary entries. std::strings and the std::pmr::strings of the
+// dictionary only compare through std::string_view.
+template <typename T>
+auto dictionary_search_value(const T& value) {
+  if constexpr (std::is_same_v<T, std::string>) {
+    return std::string_view{value};
+  } else {
+    return value;
   }
-  return std::make_shared<FixedWidthIntegerVector<uint32_t>>(size);
 }
 
 template <typename T>
-DictionarySegment<T>::DictionarySegment(const std::shared_ptr<AbstractSegment>& abstract_segment) {
+DictionarySegment<T>::DictionarySegment(const std::shared_ptr<AbstractSegment>& abstract_segment,
+                                        std::pmr::memory_resource* memory_resource)
+    : _dictionary(memory_resource ? memory_resource : abstract_segment_memory_resource<T>(abstract_segment)) {
   const auto value_segment = std::dynamic_pointer_cast<ValueSegment<T>>(abstract_segment);
   Assert(value_segment, "DictionarySegment only supports ValueSegments");
 
-  const auto values = value_segment->values();
+  memory_resource = _dictionary.get_allocator().resource();
+
+  const auto& values = value_segment->values();
   const auto size = value_segment->size();
 
   _is_nullable = value_segment->is_nullable();
 
-  auto dict_map = std::map<T, ValueID>();
-  auto last_index = _is_nullable ? 1 : 0;
-
-  for (auto index = size_t{0}; index < size; ++index) {
+  // Collect the distinct values in sorted order. Their position in the dictionary determines their ValueID, which is
+  // shifted by one for nullable segments because ValueID 0 is reserved for NULL.
+  _dictionary.reserve(size);
+  for (auto index = ChunkOffset{0}; index < size; ++index) {
     if (!value_segment->is_null(index)) {
-      const auto value = values[index];
-      if (dict_map.find(value) == dict_map.end()) {
-        auto inserted = dict_map.insert(std::pair(value, last_index));
-        if (inserted.second) {
-          last_index++;
-        }
-      }
+      _dictionary.emplace_back(values[index]);
     }
   }
+  std::sort(_dictionary.begin(), _dictionary.end());
+  _dictionary.erase(std::unique(_dictionary.begin(), _dictionary.end()), _dictionary.end());
+  _dictionary.shrink_to_fit();
 
-  for (auto [key, val] : dict_map) {
-    _dictionary.push_back(std::move(key));
-  }
-  const auto attribute_vector = get_attribute_vector(dict_map.size(), size);
+  const auto attribute_vector =
+      get_attribute_vector(_dictionary.size() + _value_id_offset(), size, memory_resource);
 
-  for (auto index = size_t{0}; index < size; ++index) {
+  for (auto index = ChunkOffset{0}; index < size; ++index) {
     if (value_segment->is_null(index)) {
       attribute_vector->set(index, null_value_id());
     } else {
-      const auto dict_value = dict_map[values[index]];
-      attribute_vector->set(index, dict_value);
+      const auto dictionary_iterator = std::lower_bound(_dictionary.cbegin(), _dictionary.cend(), values[index]);
+      const auto dictionary_index = std::distance(_dictionary.cbegin(), dictionary_iterator);
+      attribute_vector->set(index, ValueID{static_cast<ValueID::base_type>(dictionary_index + _value_id_offset())});
     }
   }
   _attribute_vector = attribute_vector;
 }
 
+template <typename T>
+DictionarySegment<T>::DictionarySegment(std::pmr::vector<DictionaryEntry<T>>&& dictionary,
+                                        const std::shared_ptr<AbstractAttributeVector>& attribute_vector,
+                                        bool nullable)
+    : _dictionary(std::move(dictionary)), _attribute_vector(attribute_vector), _is_nullable(nullable) {}
+
 template <typename T>
 AllTypeVariant DictionarySegment<T>::operator[](const ChunkOffset chunk_offset) const {
   const auto return_type = get_typed_value(chunk_offset);
@@ -81,14 +112,14 @@ T DictionarySegment<T>::get(const ChunkOffset chunk_offset) const {
 template <typename T>
 std::optional<T> DictionarySegment<T>::get_typed_value(const ChunkOffset chunk_offset) const {
   const auto value_id = attribute_vector()->get(chunk_offset);
-  if (value_id == null_value_id()) {
+  if (_is_nullable && value_id == null_value_id()) {
     return std::nullopt;
   }
   return value_of_value_id(value_id);
 }
 
 template <typename T>
-const std::vector<T>& DictionarySegment<T>::dictionary() const {
+const std::pmr::vector<DictionaryEntry<T>>& DictionarySegment<T>::dictionary() const {
   return _dictionary;
 }
 
@@ -97,6 +128,11 @@ std::shared_ptr<const AbstractAttributeVector> DictionarySegment<T>::attribute_v
   return _attribute_vector;
 }
 
+template <typename T>
+bool DictionarySegment<T>::is_nullable() const {
+  return _is_nullable;
+}
+
 template <typename T>
 ValueID DictionarySegment<T>::null_value_id() const {
   return ValueID{0};
@@ -105,16 +141,17 @@ ValueID DictionarySegment<T>::null_value_id() const {
 template <typename T>
 const T DictionarySegment<T>::value_of_value_id(const ValueID value_id) const {
   Assert(!(_is_nullable && value_id == null_value_id()), "Can't retrieve value for null value.");
-  return dictionary().at(value_id - (_is_nullable ? 1 : 0));
+  return T{dictionary().at(value_id - _value_id_offset())};
 }
 
 template <typename T>
 ValueID DictionarySegment<T>::lower_bound(const T value) const {
-  auto lower_bound_iterator = std::lower_bound(_dictionary.begin(), _dictionary.end(), value);
+  auto lower_bound_iterator = std::lower_bound(_dictionary.begin(), _dictionary.end(), dictionary_search_value(value));
   if (lower_bound_iterator == _dictionary.end()) {
     return INVALID_VALUE_ID;
   }
-  return ValueID{static_cast<ChunkOffset>(std::distance(_dictionary.begin(), lower_bound_iterator))};
+  return ValueID{static_cast<ValueID::base_type>(std::distance(_dictionary.begin(), lower_bound_iterator) +
+                                                 _value_id_offset())};
 }
 
 template <typename T>
@@ -124,11 +161,12 @@ ValueID DictionarySegment<T>::lower_bound(const AllTypeVariant& value) const {
 
 template <typename T>
 ValueID DictionarySegment<T>::upper_bound(const T value) const {
-  auto upper_bound_iterator = std::upper_bound(_dictionary.begin(), _dictionary.end(), value);
+  auto upper_bound_iterator = std::upper_bound(_dictionary.begin(), _dictionary.end(), dictionary_search_value(value));
   if (upper_bound_iterator == _dictionary.end()) {
     return INVALID_VALUE_ID;
   }
-  return ValueID{static_cast<ChunkOffset>(std::distance(_dictionary.begin(), upper_bound_iterator))};
+  return ValueID{static_cast<ValueID::base_type>(std::distance(_dictionary.begin(), upper_bound_iterator) +
+                                                 _value_id_offset())};
 }
 
 template <typename T>
@@ -146,9 +184,23 @@ ChunkOffset DictionarySegment<T>::size() const {
   return static_cast<ChunkOffset>(attribute_vector()->size());
 }
 
+template <typename T>
+ValueID::base_type DictionarySegment<T>::_value_id_offset() const {
+  return _is_nullable ? 1 : 0;
+}
+
 template <typename T>
 size_t DictionarySegment<T>::estimate_memory_usage() const {
-  auto dict_size = sizeof(T) * dictionary().size();
+  auto dict_size = sizeof(DictionaryEntry<T>) * dictionary().size();
+  if constexpr (std::is_same_v<T, std::string>) {
+    // Strings that do not fit into the small string buffer keep their characters (and a terminator) on the heap.
+    const auto inline_capacity = std::pmr::string{}.capacity();
+    for (const auto& value : _dictionary) {
+      if (value.capacity() > inline_capacity) {
+        dict_size += value.capacity() + 1;
+      }
+    }
+  }
   auto att_vec_size = attribute_vector()->width() * attribute_vector()->size();
   return dict_size + att_vec_size;
 }
@@ -1,19 +1,36 @@
 #pragma once
 
-#include "abstract_segment.hpp"
+#include <memory_resource>
+#include <string>
+#include <type_traits>
+
+#include "base_dictionary_segment.hpp"
 
 namespace opossum {
 
 class AbstractAttributeVector;
 
-// Dictionary is a specific segment type that stores all its values in a vector
+// The type of the dictionary entries of a DictionarySegment<T>. Strings are stored as std::pmr::strings, so that their
+// characters are allocated from the memory resource of the dictionary as well.
+template <typename T>
+using DictionaryEntry = std::conditional_t<std::is_same_v<T, std::string>, std::pmr::string, T>;
+
+// Dictionary is a specific segment type that stores all its values in a vector. The dictionary, including the
+// characters of its strings, and the attribute vector are allocated from the same memory resource.
 template <typename T>
-class DictionarySegment : public AbstractSegment {
+class DictionarySegment : public BaseDictionarySegment {
  public:
   /**
-   * Creates a Dictionary segment from a given value segment.
+   * Creates a Dictionary segment from a given value segment. Dictionary and attribute vector are allocated from the
+   * given memory resource, or from the one of the value segment if none is given.
    */
-  explicit DictionarySegment(const std::shared_ptr<AbstractSegment>& abstract_segment);
+  explicit DictionarySegment(const std::shared_ptr<AbstractSegment>& abstract_segment,
+                             std::pmr::memory_resource* memory_resource = nullptr);
+
+  // Creates a Dictionary segment from an already sorted dictionary and a matching attribute vector, e.g., when a chunk
+  // is loaded from disk.
+  DictionarySegment(std::pmr::vector<DictionaryEntry<T>>&& dictionary,
+                    const std::shared_ptr<AbstractAttributeVector>& attribute_vector, bool nullable);
 
   // Returns the value at a certain position. If you want to write efficient operators, back off!
   AllTypeVariant operator[](const ChunkOffset chunk_offset) const override;
@@ -25,13 +42,17 @@ class DictionarySegment : public AbstractSegment {
   std::optional<T> get_typed_value(const ChunkOffset chunk_offset) const;
 
   // Returns an underlying dictionary.
-  const std::vector<T>& dictionary() const;
+  const std::pmr::vector<DictionaryEntry<T>>& dictionary() const;
 
   // Returns an underlying data structure.
-  std::shared_ptr<const AbstractAttributeVector> attribute_vector() const;
+  std::shared_ptr<const AbstractAttributeVector> attribute_vector() const final;
+
+  // Returns whether the segment can contain NULL values.
+  bool is_nullable() const final;
 
-  // Returns the ValueID used to represent a NULL value.
-  ValueID null_value_id() const;
+  // Returns the ValueID used to represent a NULL value. It is only stored in nullable segments, where the ValueIDs of
+  // all dictionary values are shifted by one.
+  ValueID null_value_id() const final;
 
   // Returns the value represented by a given ValueID.
   const T value_of_value_id(const ValueID value_id) const;
@@ -41,26 +62,30 @@ class DictionarySegment : public AbstractSegment {
   ValueID lower_bound(const T value) const;
 
   // Same as lower_bound(T), but accepts an AllTypeVariant.
-  ValueID lower_bound(const AllTypeVariant& value) const;
+  ValueID lower_bound(const AllTypeVariant& value) const final;
 
   // Returns the first value ID that refers to a value > the search value. Returns INVALID_VALUE_ID if all values are
   // smaller than or equal to the search value.
   ValueID upper_bound(const T value) const;
 
   // Same as upper_bound(T), but accepts an AllTypeVariant.
-  ValueID upper_bound(const AllTypeVariant& value) const;
+  ValueID upper_bound(const AllTypeVariant& value) const final;
 
   // Returns the number of unique_values (dictionary entries).
-  ChunkOffset unique_values_count() const;
+  ChunkOffset unique_values_count() const final;
 
   // Returns the number of entries.
   ChunkOffset size() const override;
 
-  // Returns the calculated memory usage.
+  // Returns the calculated memory usage of the dictionary, including the heap buffers of long strings, and of the
+  // attribute vector.
   size_t estimate_memory_usage() const final;
 
  protected:
-  std::vector<T> _dictionary;
+  // Returns the distance between a value's position in the dictionary and its ValueID.
+  ValueID::base_type _value_id_offset() const;
+
+  std::pmr::vector<DictionaryEntry<T>> _dictionary;
   std::shared_ptr<AbstractAttributeVector> _attribute_vector;
   bool _is_nullable;
 };
@@ -0,0 +1,35 @@
+#pragma once
+
+#include "abstract_pos_list.hpp"
+
+namespace opossum {
+
+// EntireChunkPosList references the first `size` rows of a chunk in order, e.g., when a scan selects all of them. It
+// does not store any positions. The size is fixed on construction, so rows appended to the chunk later are not part
+// of the list.
+class EntireChunkPosList final : public AbstractPosList {
+ public:
+  EntireChunkPosList(const ChunkID chunk_id, const ChunkOffset size) : _chunk_id(chunk_id), _size(size) {}
+
+  RowID operator[](const size_t index) const final {
+    return RowID{_chunk_id, static_cast<ChunkOffset>(index)};
+  }
+
+  size_t size() const final {
+    return _size;
+  }
+
+  std::optional<ChunkID> single_chunk_id() const final {
+    return _chunk_id;
+  }
+
+  size_t memory_usage() const final {
+    return 0;
+  }
+
+ protected:
+  const ChunkID _chunk_id;
+  const ChunkOffset _size;
+};
+
+}  // namespace opossum
@@ -2,11 +2,19 @@
 // Created by Jiang, Yang on 2024/3/5.
 //
 #include "fixed_width_integer_vector.hpp"
+
+#include <utility>
+
 #include "utils/assert.hpp"
 
 namespace opossum {
 template <typename uintX_t>
-FixedWidthIntegerVector<uintX_t>::FixedWidthIntegerVector(size_t size) : _values(size) {}
+FixedWidthIntegerVector<uintX_t>::FixedWidthIntegerVector(size_t size, std::pmr::memory_resource* memory_resource)
+    : _values(size, memory_resource) {}
+
+template <typename uintX_t>
+FixedWidthIntegerVector<uintX_t>::FixedWidthIntegerVector(std::pmr::vector<uintX_t>&& values)
+    : _values(std::move(values)) {}
 
 template <typename uintX_t>
 ValueID FixedWidthIntegerVector<uintX_t>::get(const size_t index) const {
@@ -30,6 +38,11 @@ AttributeVectorWidth FixedWidthIntegerVector<uintX_t>::width() const {
   return sizeof(uintX_t);
 }
 
+template <typename uintX_t>
+const std::pmr::vector<uintX_t>& FixedWidthIntegerVector<uintX_t>::values() const {
+  return _values;
+}
+
 template class FixedWidthIntegerVector<uint8_t>;
 template class FixedWidthIntegerVector<uint16_t>;
 template class FixedWidthIntegerVector<uint32_t>;
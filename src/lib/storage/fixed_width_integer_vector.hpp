@@ -1,15 +1,22 @@
 //
 // Created by Jiang, Yang on 2024/3/5.
 //
+#include <memory_resource>
+
 #include "abstract_attribute_vector.hpp"
 #include "types.hpp"
+#include "utils/assert.hpp"
 
 #pragma once
 namespace opossum {
 template <typename uintX_t>
 class FixedWidthIntegerVector: public AbstractAttributeVector {
   public:
-   explicit FixedWidthIntegerVector(size_t size);
+   explicit FixedWidthIntegerVector(size_t size,
+                                    std::pmr::memory_resource* memory_resource = std::pmr::get_default_resource());
+
+   // Takes over already computed ValueIDs together with their memory resource.
+   explicit FixedWidthIntegerVector(std::pmr::vector<uintX_t>&& values);
 
    ValueID get(const size_t index) const override;
 
@@ -19,7 +26,25 @@ class FixedWidthIntegerVector: public AbstractAttributeVector {
 
    AttributeVectorWidth width() const override;
 
+   // Returns the underlying ValueIDs. Scans use this to loop over the plain integers without a virtual call per row.
+   const std::pmr::vector<uintX_t>& values() const;
+
    protected:
-    std::vector<uintX_t> _values;
+    std::pmr::vector<uintX_t> _values;
 };
+
+// Calls func with the ValueIDs of the attribute vector as a plain vector of integers, so that loops over them do not
+// need a virtual call per row.
+template <typename Functor>
+void with_value_ids(const AbstractAttributeVector& attribute_vector, const Functor& func) {
+  if (const auto values_8 = dynamic_cast<const FixedWidthIntegerVector<uint8_t>*>(&attribute_vector)) {
+    func(values_8->values());
+  } else if (const auto values_16 = dynamic_cast<const FixedWidthIntegerVector<uint16_t>*>(&attribute_vector)) {
+    func(values_16->values());
+  } else if (const auto values_32 = dynamic_cast<const FixedWidthIntegerVector<uint32_t>*>(&attribute_vector)) {
+    func(values_32->values());
+  } else {
+    Fail("Unsupported attribute vector type.");
+  }
+}
 } // namespace opossum
\ No newline at end of file
@@ -0,0 +1,157 @@
+#include "adaptive_radix_tree_index.hpp"
+
+#include <algorithm>
+#include <numeric>
+
+#include "adaptive_radix_tree_nodes.hpp"
+#include "resolve_type.hpp"
+#include "storage/materialize.hpp"
+#include "storage/segment_data_type.hpp"
+#include "utils/assert.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT(build/namespaces)
+
+template <typename T>
+BinaryComparableKey make_key(const AllTypeVariant& value) {
+  auto key = BinaryComparableKey{};
+  append_binary_comparable(type_cast<T>(value), key);
+  return key;
+}
+
+}  // namespace
+
+namespace opossum {
+
+AdaptiveRadixTreeIndex::AdaptiveRadixTreeIndex(
+    const std::vector<std::shared_ptr<const AbstractSegment>>& segments_to_index)
+    : BaseIndex(SegmentIndexType::AdaptiveRadixTree), _indexed_segment(segments_to_index.at(0)) {
+  Assert(segments_to_index.size() == 1, "AdaptiveRadixTreeIndex only works with a single segment.");
+
+  auto keys = std::vector<BinaryComparableKey>{};
+  resolve_data_type(segment_data_type(*_indexed_segment), [&](auto type) {
+    using DataType = typename decltype(type)::type;
+    _make_key = &make_key<DataType>;
+
+    auto values = std::vector<DataType>{};
+    auto nulls = std::vector<bool>{};
+    materialize_values_and_nulls(*_indexed_segment, values, nulls);
+
+    const auto row_count = static_cast<ChunkOffset>(values.size());
+    keys.resize(row_count);
+    _chunk_offsets.reserve(row_count);
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < row_count; ++chunk_offset) {
+      if (!nulls[chunk_offset]) {
+        append_binary_comparable(values[chunk_offset], keys[chunk_offset]);
+        _chunk_offsets.push_back(chunk_offset);
+      }
+    }
+  });
+
+  // Equal keys keep the order of their chunk offsets.
+  std::stable_sort(_chunk_offsets.begin(), _chunk_offsets.end(),
+                   [&](const auto lhs, const auto rhs) { return keys[lhs] < keys[rhs]; });
+
+  // Each distinct key is inserted once, together with the position of its first chunk offset.
+  auto distinct_keys = std::vector<BinaryComparableKey>{};
+  auto key_positions = std::vector<ChunkOffset>{};
+  const auto position_count = static_cast<ChunkOffset>(_chunk_offsets.size());
+  for (auto position = ChunkOffset{0}; position < position_count; ++position) {
+    auto& key = keys[_chunk_offsets[position]];
+    if (distinct_keys.empty() || key != distinct_keys.back()) {
+      distinct_keys.push_back(std::move(key));
+      key_positions.push_back(position);
+    }
+  }
+  key_positions.push_back(position_count);
+
+  if (!distinct_keys.empty()) {
+    _root = _bulk_insert(distinct_keys, key_positions, 0, distinct_keys.size(), 0);
+  }
+}
+
+AdaptiveRadixTreeIndex::~AdaptiveRadixTreeIndex() = default;
+
+std::unique_ptr<ARTNode> AdaptiveRadixTreeIndex::_bulk_insert(const std::vector<BinaryComparableKey>& keys,
+                                                              const std::vector<ChunkOffset>& key_positions,
+                                                              const size_t keys_begin, const size_t keys_end,
+                                                              const size_t depth) {
+  const auto begin = key_positions[keys_begin];
+  const auto end = key_positions[keys_end];
+  if (keys_end - keys_begin == 1) {
+    return std::make_unique<ARTLeaf>(keys[keys_begin], begin, end);
+  }
+
+  // Since the keys are sorted, the bytes shared by the first and the last key are shared by all of them. No key is a
+  // prefix of another one, so all keys continue after the shared bytes.
+  const auto& first_key = keys[keys_begin];
+  const auto& last_key = keys[keys_end - 1];
+  auto child_depth = depth;
+  while (first_key[child_depth] == last_key[child_depth]) {
+    ++child_depth;
+  }
+  auto prefix = BinaryComparableKey(first_key.cbegin() + static_cast<std::ptrdiff_t>(depth),
+                                    first_key.cbegin() + static_cast<std::ptrdiff_t>(child_depth));
+
+  // The keys of a child form a run of equal bytes at child_depth.
+  auto child_begins = std::vector<size_t>{};
+  for (auto key_index = keys_begin; key_index < keys_end; ++key_index) {
+    if (key_index == keys_begin || keys[key_index][child_depth] != keys[key_index - 1][child_depth]) {
+      child_begins.push_back(key_index);
+    }
+  }
+  child_begins.push_back(keys_end);
+
+  const auto child_count = child_begins.size() - 1;
+  auto node = std::unique_ptr<ARTInnerNode>{};
+  if (child_count <= 4) {
+    node = std::make_unique<ARTNode4>(std::move(prefix), begin, end);
+  } else if (child_count <= 16) {
+    node = std::make_unique<ARTNode16>(std::move(prefix), begin, end);
+  } else if (child_count <= 48) {
+    node = std::make_unique<ARTNode48>(std::move(prefix), begin, end);
+  } else {
+    node = std::make_unique<ARTNode256>(std::move(prefix), begin, end);
+  }
+
+  for (auto child_index = size_t{0}; child_index < child_count; ++child_index) {
+    const auto child_keys_begin = child_begins[child_index];
+    const auto child_keys_end = child_begins[child_index + 1];
+    node->add_child(keys[child_keys_begin][child_depth],
+                    _bulk_insert(keys, key_positions, child_keys_begin, child_keys_end, child_depth + 1));
+  }
+  return node;
+}
+
+BaseIndex::Iterator AdaptiveRadixTreeIndex::_lower_bound(const std::vector<AllTypeVariant>& values) const {
+  if (values.empty() || !_root) {
+    return _chunk_offsets.cbegin();
+  }
+  return _chunk_offsets.cbegin() + _root->lower_bound(_make_key(values[0]), 0);
+}
+
+BaseIndex::Iterator AdaptiveRadixTreeIndex::_upper_bound(const std::vector<AllTypeVariant>& values) const {
+  if (values.empty() || !_root) {
+    return _chunk_offsets.cend();
+  }
+  return _chunk_offsets.cbegin() + _root->upper_bound(_make_key(values[0]), 0);
+}
+
+BaseIndex::Iterator AdaptiveRadixTreeIndex::_cbegin() const {
+  return _chunk_offsets.cbegin();
+}
+
+BaseIndex::Iterator AdaptiveRadixTreeIndex::_cend() const {
+  return _chunk_offsets.cend();
+}
+
+std::vector<std::shared_ptr<const AbstractSegment>> AdaptiveRadixTreeIndex::_get_indexed_segments() const {
+  return {_indexed_segment};
+}
+
+size_t AdaptiveRadixTreeIndex::_memory_consumption() const {
+  return _chunk_offsets.size() * sizeof(ChunkOffset) + (_root ? _root->memory_consumption() : 0);
+}
+
+}  // namespace opossum
@@ -0,0 +1,55 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "base_index.hpp"
+#include "binary_comparable_key.hpp"
+
+namespace opossum {
+
+class ARTNode;
+
+/**
+ * Index over a single segment of any type, based on an Adaptive Radix Tree (Leis et al., ICDE 2013). The values are
+ * converted to binary-comparable keys (see append_binary_comparable), and each distinct key is stored along the path of
+ * its bytes. Inner nodes grow from 4 to 16, 48, and 256 children depending on how many different bytes follow at
+ * their depth, and bytes shared by all keys of a node are compressed into the node. A lookup thus touches at most one
+ * node per key byte, independent of the number of rows, and compares bytes instead of values. This pays off for
+ * high-cardinality columns, where the dictionary search of a GroupKeyIndex and the binary search of a SortedIndex
+ * become expensive, especially for long strings.
+ *
+ * The chunk offsets of all non-NULL rows are stored in key order, equal keys keeping the order of their chunk offsets.
+ * The tree is bulk-loaded from the sorted keys, and each of its nodes refers to the range of chunk offsets of its keys.
+ */
+class AdaptiveRadixTreeIndex : public BaseIndex {
+ public:
+  explicit AdaptiveRadixTreeIndex(const std::vector<std::shared_ptr<const AbstractSegment>>& segments_to_index);
+
+  ~AdaptiveRadixTreeIndex() override;
+
+ protected:
+  Iterator _lower_bound(const std::vector<AllTypeVariant>& values) const final;
+  Iterator _upper_bound(const std::vector<AllTypeVariant>& values) const final;
+  Iterator _cbegin() const final;
+  Iterator _cend() const final;
+  std::vector<std::shared_ptr<const AbstractSegment>> _get_indexed_segments() const final;
+  size_t _memory_consumption() const final;
+
+  // Creates the node for the sorted distinct keys [keys_begin, keys_end). `key_positions[i]` is the position of the
+  // first chunk offset of keys[i] in _chunk_offsets, `depth` the number of bytes all of these keys share with the path.
+  static std::unique_ptr<ARTNode> _bulk_insert(const std::vector<BinaryComparableKey>& keys,
+                                               const std::vector<ChunkOffset>& key_positions, const size_t keys_begin,
+                                               const size_t keys_end, const size_t depth);
+
+  const std::shared_ptr<const AbstractSegment> _indexed_segment;
+  std::vector<ChunkOffset> _chunk_offsets;
+
+  // nullptr if the segment has no non-NULL rows.
+  std::unique_ptr<const ARTNode> _root;
+
+  // Converts a search value to the key of the indexed data type.
+  BinaryComparableKey (*_make_key)(const AllTypeVariant&){nullptr};
+};
+
+}  // namespace opossum
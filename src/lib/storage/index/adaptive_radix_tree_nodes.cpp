@@ -0,0 +1,154 @@
+#include "adaptive_radix_tree_nodes.hpp"
+
+#include <algorithm>
+
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+ARTLeaf::ARTLeaf(BinaryComparableKey key, const ChunkOffset begin, const ChunkOffset end)
+    : ARTNode(begin, end), _key(std::move(key)) {}
+
+ChunkOffset ARTLeaf::lower_bound(const BinaryComparableKey& key, const size_t depth) const {
+  // The first `depth` bytes are equal, since the leaf was reached through them.
+  const auto is_less =
+      std::lexicographical_compare(_key.cbegin() + depth, _key.cend(), key.cbegin() + depth, key.cend());
+  return is_less ? _end : _begin;
+}
+
+ChunkOffset ARTLeaf::upper_bound(const BinaryComparableKey& key, const size_t depth) const {
+  const auto is_greater =
+      std::lexicographical_compare(key.cbegin() + depth, key.cend(), _key.cbegin() + depth, _key.cend());
+  return is_greater ? _begin : _end;
+}
+
+size_t ARTLeaf::memory_consumption() const {
+  return sizeof(ARTLeaf) + _key.capacity();
+}
+
+ARTInnerNode::ARTInnerNode(BinaryComparableKey prefix, const ChunkOffset begin, const ChunkOffset end)
+    : ARTNode(begin, end), _prefix(std::move(prefix)) {}
+
+ChunkOffset ARTInnerNode::lower_bound(const BinaryComparableKey& key, const size_t depth) const {
+  return _bound<false>(key, depth);
+}
+
+ChunkOffset ARTInnerNode::upper_bound(const BinaryComparableKey& key, const size_t depth) const {
+  return _bound<true>(key, depth);
+}
+
+template <bool is_upper_bound>
+ChunkOffset ARTInnerNode::_bound(const BinaryComparableKey& key, size_t depth) const {
+  // All keys below this node start with the compressed prefix. If the search key deviates from it, all of them are
+  // either greater or less than the search key. If the search key ends within the prefix or right after it, it is a
+  // proper prefix of all keys below this node, which makes them greater.
+  const auto key_size = key.size();
+  for (const auto prefix_byte : _prefix) {
+    if (depth == key_size || key[depth] < prefix_byte) {
+      return _begin;
+    }
+    if (key[depth] > prefix_byte) {
+      return _end;
+    }
+    ++depth;
+  }
+  if (depth == key_size) {
+    return _begin;
+  }
+
+  const auto byte = key[depth];
+  const auto [child_byte, child] = _child_greater_equal(byte);
+  if (!child) {
+    return _end;
+  }
+  if (child_byte > byte) {
+    return child->begin();
+  }
+  return is_upper_bound ? child->upper_bound(key, depth + 1) : child->lower_bound(key, depth + 1);
+}
+
+size_t ARTInnerNode::_prefix_memory_consumption() const {
+  return _prefix.capacity();
+}
+
+template <size_t capacity>
+void ARTSortedNode<capacity>::add_child(const uint8_t byte, std::unique_ptr<ARTNode> child) {
+  DebugAssert(_child_count < capacity, "Node is full.");
+  DebugAssert(_child_count == 0 || _keys[_child_count - 1] < byte, "Children have to be added in ascending order.");
+  _keys[_child_count] = byte;
+  _children[_child_count] = std::move(child);
+  ++_child_count;
+}
+
+template <size_t capacity>
+std::pair<uint8_t, const ARTNode*> ARTSortedNode<capacity>::_child_greater_equal(const uint8_t byte) const {
+  // With at most 16 keys, a linear scan over the contiguous key bytes is as fast as a binary search.
+  for (auto child_index = uint8_t{0}; child_index < _child_count; ++child_index) {
+    if (_keys[child_index] >= byte) {
+      return {_keys[child_index], _children[child_index].get()};
+    }
+  }
+  return {0, nullptr};
+}
+
+template <size_t capacity>
+size_t ARTSortedNode<capacity>::memory_consumption() const {
+  auto bytes = sizeof(ARTSortedNode<capacity>) + _prefix_memory_consumption();
+  for (auto child_index = uint8_t{0}; child_index < _child_count; ++child_index) {
+    bytes += _children[child_index]->memory_consumption();
+  }
+  return bytes;
+}
+
+template class ARTSortedNode<4>;
+template class ARTSortedNode<16>;
+
+void ARTNode48::add_child(const uint8_t byte, std::unique_ptr<ARTNode> child) {
+  DebugAssert(_child_count < _children.size(), "Node is full.");
+  _children[_child_count] = std::move(child);
+  ++_child_count;
+  _child_slots[byte] = _child_count;
+}
+
+std::pair<uint8_t, const ARTNode*> ARTNode48::_child_greater_equal(const uint8_t byte) const {
+  for (auto child_byte = size_t{byte}; child_byte < _child_slots.size(); ++child_byte) {
+    const auto slot = _child_slots[child_byte];
+    if (slot != 0) {
+      return {static_cast<uint8_t>(child_byte), _children[slot - 1].get()};
+    }
+  }
+  return {0, nullptr};
+}
+
+size_t ARTNode48::memory_consumption() const {
+  auto bytes = sizeof(ARTNode48) + _prefix_memory_consumption();
+  for (auto child_index = uint8_t{0}; child_index < _child_count; ++child_index) {
+    bytes += _children[child_index]->memory_consumption();
+  }
+  return bytes;
+}
+
+void ARTNode256::add_child(const uint8_t byte, std::unique_ptr<ARTNode> child) {
+  _children[byte] = std::move(child);
+}
+
+std::pair<uint8_t, const ARTNode*> ARTNode256::_child_greater_equal(const uint8_t byte) const {
+  for (auto child_byte = size_t{byte}; child_byte < _children.size(); ++child_byte) {
+    if (_children[child_byte]) {
+      return {static_cast<uint8_t>(child_byte), _children[child_byte].get()};
+    }
+  }
+  return {0, nullptr};
+}
+
+size_t ARTNode256::memory_consumption() const {
+  auto bytes = sizeof(ARTNode256) + _prefix_memory_consumption();
+  for (const auto& child : _children) {
+    if (child) {
+      bytes += child->memory_consumption();
+    }
+  }
+  return bytes;
+}
+
+}  // namespace opossum
@@ -0,0 +1,133 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <utility>
+
+#include "binary_comparable_key.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+/**
+ * Nodes of the AdaptiveRadixTreeIndex. Each node covers the keys that start with the bytes on the path from the root to
+ * it. Since the chunk offsets of the index are stored in key order, the chunk offsets of a node's keys are the range
+ * [begin(), end()) of the index's chunk offset array. Lookups therefore return positions in that array.
+ *
+ * Inner nodes come in four sizes, depending on the number of their children: ARTNode4 and ARTNode16 store sorted key
+ * bytes next to their children, ARTNode48 maps each byte to one of 48 child slots, and ARTNode256 holds one child slot
+ * per byte. Inner nodes also store the bytes that all their keys share beyond the path (path compression), so that
+ * chains of nodes with a single child are not materialized. Leaves store one distinct key.
+ */
+class ARTNode : private Noncopyable {
+ public:
+  ARTNode(const ChunkOffset begin, const ChunkOffset end) : _begin(begin), _end(end) {}
+
+  virtual ~ARTNode() = default;
+
+  // Returns the position of the first chunk offset whose key is not less (lower_bound) or greater (upper_bound) than
+  // `key`. `depth` is the number of key bytes that were already matched on the path to this node.
+  virtual ChunkOffset lower_bound(const BinaryComparableKey& key, const size_t depth) const = 0;
+  virtual ChunkOffset upper_bound(const BinaryComparableKey& key, const size_t depth) const = 0;
+
+  // Returns the number of bytes used by this node and its children.
+  virtual size_t memory_consumption() const = 0;
+
+  ChunkOffset begin() const {
+    return _begin;
+  }
+
+  ChunkOffset end() const {
+    return _end;
+  }
+
+ protected:
+  const ChunkOffset _begin;
+  const ChunkOffset _end;
+};
+
+class ARTLeaf final : public ARTNode {
+ public:
+  ARTLeaf(BinaryComparableKey key, const ChunkOffset begin, const ChunkOffset end);
+
+  ChunkOffset lower_bound(const BinaryComparableKey& key, const size_t depth) const final;
+  ChunkOffset upper_bound(const BinaryComparableKey& key, const size_t depth) const final;
+  size_t memory_consumption() const final;
+
+ protected:
+  const BinaryComparableKey _key;
+};
+
+class ARTInnerNode : public ARTNode {
+ public:
+  ARTInnerNode(BinaryComparableKey prefix, const ChunkOffset begin, const ChunkOffset end);
+
+  ChunkOffset lower_bound(const BinaryComparableKey& key, const size_t depth) const final;
+  ChunkOffset upper_bound(const BinaryComparableKey& key, const size_t depth) const final;
+
+  // Adds a child for the next key byte. Children have to be added in ascending order of their bytes.
+  virtual void add_child(const uint8_t byte, std::unique_ptr<ARTNode> child) = 0;
+
+ protected:
+  template <bool is_upper_bound>
+  ChunkOffset _bound(const BinaryComparableKey& key, size_t depth) const;
+
+  // Returns the child with the smallest byte that is not less than `byte` together with its byte, or nullptr.
+  virtual std::pair<uint8_t, const ARTNode*> _child_greater_equal(const uint8_t byte) const = 0;
+
+  size_t _prefix_memory_consumption() const;
+
+  const BinaryComparableKey _prefix;
+};
+
+// ARTNode4 and ARTNode16 find children by searching their sorted key bytes.
+template <size_t capacity>
+class ARTSortedNode final : public ARTInnerNode {
+ public:
+  using ARTInnerNode::ARTInnerNode;
+
+  void add_child(const uint8_t byte, std::unique_ptr<ARTNode> child) final;
+  size_t memory_consumption() const final;
+
+ protected:
+  std::pair<uint8_t, const ARTNode*> _child_greater_equal(const uint8_t byte) const final;
+
+  uint8_t _child_count{0};
+  std::array<uint8_t, capacity> _keys{};
+  std::array<std::unique_ptr<ARTNode>, capacity> _children{};
+};
+
+using ARTNode4 = ARTSortedNode<4>;
+using ARTNode16 = ARTSortedNode<16>;
+
+class ARTNode48 final : public ARTInnerNode {
+ public:
+  using ARTInnerNode::ARTInnerNode;
+
+  void add_child(const uint8_t byte, std::unique_ptr<ARTNode> child) final;
+  size_t memory_consumption() const final;
+
+ protected:
+  std::pair<uint8_t, const ARTNode*> _child_greater_equal(const uint8_t byte) const final;
+
+  // Slot of each byte's child plus one, 0 means that there is no child.
+  std::array<uint8_t, 256> _child_slots{};
+  uint8_t _child_count{0};
+  std::array<std::unique_ptr<ARTNode>, 48> _children{};
+};
+
+class ARTNode256 final : public ARTInnerNode {
+ public:
+  using ARTInnerNode::ARTInnerNode;
+
+  void add_child(const uint8_t byte, std::unique_ptr<ARTNode> child) final;
+  size_t memory_consumption() const final;
+
+ protected:
+  std::pair<uint8_t, const ARTNode*> _child_greater_equal(const uint8_t byte) const final;
+
+  std::array<std::unique_ptr<ARTNode>, 256> _children{};
+};
+
+}  // namespace opossum
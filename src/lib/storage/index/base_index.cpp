@@ -0,0 +1,47 @@
+#include "base_index.hpp"
+
+#include <algorithm>
+
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+BaseIndex::BaseIndex(const SegmentIndexType type) : _type(type) {}
+
+bool BaseIndex::is_index_for(const std::vector<std::shared_ptr<const AbstractSegment>>& segments) const {
+  return _get_indexed_segments() == segments;
+}
+
+std::vector<std::shared_ptr<const AbstractSegment>> BaseIndex::get_indexed_segments() const {
+  return _get_indexed_segments();
+}
+
+BaseIndex::Iterator BaseIndex::lower_bound(const std::vector<AllTypeVariant>& values) const {
+  DebugAssert(values.size() <= _get_indexed_segments().size(), "Index does not have enough columns.");
+  Assert(std::none_of(values.cbegin(), values.cend(), variant_is_null), "Cannot search an index for NULL.");
+  return _lower_bound(values);
+}
+
+BaseIndex::Iterator BaseIndex::upper_bound(const std::vector<AllTypeVariant>& values) const {
+  DebugAssert(values.size() <= _get_indexed_segments().size(), "Index does not have enough columns.");
+  Assert(std::none_of(values.cbegin(), values.cend(), variant_is_null), "Cannot search an index for NULL.");
+  return _upper_bound(values);
+}
+
+BaseIndex::Iterator BaseIndex::cbegin() const {
+  return _cbegin();
+}
+
+BaseIndex::Iterator BaseIndex::cend() const {
+  return _cend();
+}
+
+SegmentIndexType BaseIndex::type() const {
+  return _type;
+}
+
+size_t BaseIndex::memory_consumption() const {
+  return _memory_consumption();
+}
+
+}  // namespace opossum
@@ -0,0 +1,69 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "all_type_variant.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class AbstractSegment;
+
+enum class SegmentIndexType { Sorted, GroupKey, AdaptiveRadixTree, Composite };
+
+// BaseIndex is the abstract super class for all secondary indexes of a chunk. An index covers one or more segments of
+// the same chunk and orders their chunk offsets by key, i.e., by the values of the indexed segments compared
+// lexicographically. Iterating from cbegin() to cend() yields the chunk offsets of all rows in key order, and
+// [lower_bound(values), upper_bound(values)) are the chunk offsets of the rows whose key starts with `values`. Rows
+// with a NULL in any indexed segment are not part of the index.
+//
+// Indexes are created through Chunk::create_index and are not updated when rows are appended to the chunk.
+class BaseIndex : private Noncopyable {
+ public:
+  using Iterator = std::vector<ChunkOffset>::const_iterator;
+
+  explicit BaseIndex(const SegmentIndexType type);
+
+  virtual ~BaseIndex() = default;
+
+  // We need to explicitly set the move constructor to default when we overwrite the copy constructor.
+  BaseIndex(BaseIndex&&) = default;
+  BaseIndex& operator=(BaseIndex&&) = default;
+
+  // Returns whether the index covers exactly the given segments in this order.
+  bool is_index_for(const std::vector<std::shared_ptr<const AbstractSegment>>& segments) const;
+
+  // Returns the indexed segments in the order of the key.
+  std::vector<std::shared_ptr<const AbstractSegment>> get_indexed_segments() const;
+
+  // Returns an iterator to the first chunk offset whose key is not less than `values`. `values` may hold fewer values
+  // than there are indexed segments, in which case only the leading segments are compared. NULL is not a valid search
+  // value.
+  Iterator lower_bound(const std::vector<AllTypeVariant>& values) const;
+
+  // Returns an iterator behind the last chunk offset whose key is not greater than `values` (see lower_bound).
+  Iterator upper_bound(const std::vector<AllTypeVariant>& values) const;
+
+  Iterator cbegin() const;
+
+  Iterator cend() const;
+
+  SegmentIndexType type() const;
+
+  // Returns the number of bytes used by the index.
+  size_t memory_consumption() const;
+
+ protected:
+  virtual Iterator _lower_bound(const std::vector<AllTypeVariant>& values) const = 0;
+  virtual Iterator _upper_bound(const std::vector<AllTypeVariant>& values) const = 0;
+  virtual Iterator _cbegin() const = 0;
+  virtual Iterator _cend() const = 0;
+  virtual std::vector<std::shared_ptr<const AbstractSegment>> _get_indexed_segments() const = 0;
+  virtual size_t _memory_consumption() const = 0;
+
+ private:
+  SegmentIndexType _type;
+};
+
+}  // namespace opossum
@@ -0,0 +1,50 @@
+#pragma once
+
+#include <bit>
+#include <cstdint>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace opossum {
+
+// A key whose bytes, compared lexicographically as unsigned values (i.e., with memcmp), order keys like the values
+// they were created from.
+using BinaryComparableKey = std::vector<uint8_t>;
+
+// Appends the binary-comparable encoding of `value` to `key`. Integers are stored big-endian with a flipped sign bit.
+// Floating-point numbers additionally flip all other bits if they are negative, so that larger magnitudes come first.
+// Strings are terminated by two zero bytes, and zero bytes within them are escaped as 0x00 0xFF. Thus, no encoded value
+// is a prefix of another one, and the encodings of multiple values can be concatenated to compare tuples.
+template <typename T>
+void append_binary_comparable(const T& value, BinaryComparableKey& key) {
+  if constexpr (std::is_same_v<T, std::string>) {
+    for (const auto character : value) {
+      key.push_back(static_cast<uint8_t>(character));
+      if (character == '\0') {
+        key.push_back(0xFF);
+      }
+    }
+    key.push_back(0);
+    key.push_back(0);
+  } else {
+    static_assert(sizeof(T) == 4 || sizeof(T) == 8, "Unsupported data type.");
+    using Bits = std::conditional_t<sizeof(T) == 4, uint32_t, uint64_t>;
+    constexpr auto SIGN_BIT = Bits{1} << (sizeof(T) * 8 - 1);
+
+    auto bits = Bits{};
+    if constexpr (std::is_floating_point_v<T>) {
+      // -0.0 and 0.0 are equal and need the same key.
+      bits = std::bit_cast<Bits>(value == T{0} ? T{0} : value);
+      bits = (bits & SIGN_BIT) ? ~bits : bits | SIGN_BIT;
+    } else {
+      bits = static_cast<Bits>(value) ^ SIGN_BIT;
+    }
+
+    for (auto shift = static_cast<int>(sizeof(T) * 8) - 8; shift >= 0; shift -= 8) {
+      key.push_back(static_cast<uint8_t>(bits >> shift));
+    }
+  }
+}
+
+}  // namespace opossum
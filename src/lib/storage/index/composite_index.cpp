@@ -0,0 +1,133 @@
+#include "composite_index.hpp"
+
+#include <algorithm>
+#include <ranges>
+
+#include "resolve_type.hpp"
+#include "storage/materialize.hpp"
+#include "storage/segment_data_type.hpp"
+#include "utils/assert.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT(build/namespaces)
+
+template <typename T>
+void append_key(const AllTypeVariant& value, BinaryComparableKey& key) {
+  append_binary_comparable(type_cast<T>(value), key);
+}
+
+}  // namespace
+
+namespace opossum {
+
+CompositeIndex::CompositeIndex(const std::vector<std::shared_ptr<const AbstractSegment>>& segments_to_index)
+    : BaseIndex(SegmentIndexType::Composite), _indexed_segments(segments_to_index) {
+  Assert(!_indexed_segments.empty(), "CompositeIndex needs at least one segment.");
+  const auto row_count = _indexed_segments.front()->size();
+  for (const auto& segment : _indexed_segments) {
+    Assert(segment->size() == row_count, "Indexed segments have to be of the same chunk.");
+  }
+
+  // The keys of all rows, built segment by segment. Rows with a NULL in any segment are not indexed.
+  auto row_keys = std::vector<BinaryComparableKey>(row_count);
+  auto row_is_null = std::vector<bool>(row_count);
+  auto has_strings = false;
+  for (const auto& segment : _indexed_segments) {
+    resolve_data_type(segment_data_type(*segment), [&](auto type) {
+      using DataType = typename decltype(type)::type;
+      _append_key_functions.push_back(&append_key<DataType>);
+      has_strings |= std::is_same_v<DataType, std::string>;
+
+      auto values = std::vector<DataType>{};
+      auto nulls = std::vector<bool>{};
+      materialize_values_and_nulls(*segment, values, nulls);
+      for (auto chunk_offset = ChunkOffset{0}; chunk_offset < row_count; ++chunk_offset) {
+        if (nulls[chunk_offset]) {
+          row_is_null[chunk_offset] = true;
+        } else if (!row_is_null[chunk_offset]) {
+          append_binary_comparable(values[chunk_offset], row_keys[chunk_offset]);
+        }
+      }
+    });
+  }
+
+  // Equal keys keep the order of their chunk offsets.
+  for (auto chunk_offset = ChunkOffset{0}; chunk_offset < row_count; ++chunk_offset) {
+    if (!row_is_null[chunk_offset]) {
+      _chunk_offsets.push_back(chunk_offset);
+    }
+  }
+  std::stable_sort(_chunk_offsets.begin(), _chunk_offsets.end(),
+                   [&](const auto lhs, const auto rhs) { return row_keys[lhs] < row_keys[rhs]; });
+
+  if (!has_strings && !_chunk_offsets.empty()) {
+    _fixed_key_size = row_keys[_chunk_offsets.front()].size();
+  } else if (has_strings) {
+    _key_offsets.reserve(_chunk_offsets.size() + 1);
+    _key_offsets.push_back(0);
+  }
+  for (const auto chunk_offset : _chunk_offsets) {
+    const auto& key = row_keys[chunk_offset];
+    _keys.insert(_keys.end(), key.cbegin(), key.cend());
+    if (has_strings) {
+      _key_offsets.push_back(_keys.size());
+    }
+  }
+}
+
+BaseIndex::Iterator CompositeIndex::_lower_bound(const std::vector<AllTypeVariant>& values) const {
+  // A key that starts with the search key is greater than it, so the first key that is not less than the search key
+  // is the first one with the searched prefix.
+  const auto search_key = _make_key(values);
+  const auto positions = std::views::iota(size_t{0}, _chunk_offsets.size());
+  const auto position = *std::ranges::partition_point(positions, [&](const auto position) {
+    return std::ranges::lexicographical_compare(_key(position), search_key);
+  });
+  return _chunk_offsets.cbegin() + static_cast<std::ptrdiff_t>(position);
+}
+
+BaseIndex::Iterator CompositeIndex::_upper_bound(const std::vector<AllTypeVariant>& values) const {
+  // Keys are compared with the search key only up to its length, so that all keys with the searched prefix count as
+  // equal to it.
+  const auto search_key = _make_key(values);
+  const auto positions = std::views::iota(size_t{0}, _chunk_offsets.size());
+  const auto position = *std::ranges::partition_point(positions, [&](const auto position) {
+    const auto key = _key(position);
+    return !std::ranges::lexicographical_compare(search_key, key.first(std::min(key.size(), search_key.size())));
+  });
+  return _chunk_offsets.cbegin() + static_cast<std::ptrdiff_t>(position);
+}
+
+BaseIndex::Iterator CompositeIndex::_cbegin() const {
+  return _chunk_offsets.cbegin();
+}
+
+BaseIndex::Iterator CompositeIndex::_cend() const {
+  return _chunk_offsets.cend();
+}
+
+std::vector<std::shared_ptr<const AbstractSegment>> CompositeIndex::_get_indexed_segments() const {
+  return _indexed_segments;
+}
+
+size_t CompositeIndex::_memory_consumption() const {
+  return _chunk_offsets.size() * sizeof(ChunkOffset) + _keys.size() + _key_offsets.size() * sizeof(size_t);
+}
+
+BinaryComparableKey CompositeIndex::_make_key(const std::vector<AllTypeVariant>& values) const {
+  auto key = BinaryComparableKey{};
+  for (auto value_index = size_t{0}; value_index < values.size(); ++value_index) {
+    _append_key_functions[value_index](values[value_index], key);
+  }
+  return key;
+}
+
+std::span<const uint8_t> CompositeIndex::_key(const size_t position) const {
+  if (_fixed_key_size != 0) {
+    return {_keys.data() + position * _fixed_key_size, _fixed_key_size};
+  }
+  return {_keys.data() + _key_offsets[position], _key_offsets[position + 1] - _key_offsets[position]};
+}
+
+}  // namespace opossum
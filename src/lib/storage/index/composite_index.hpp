@@ -0,0 +1,56 @@
+#pragma once
+
+#include <memory>
+#include <span>
+#include <vector>
+
+#include "base_index.hpp"
+#include "binary_comparable_key.hpp"
+
+namespace opossum {
+
+/**
+ * Index over multiple segments of a chunk, e.g., (tenant_id, entity_id). The values of each row are concatenated into
+ * one binary-comparable key (see append_binary_comparable), so rows are ordered by the first segment, then by the
+ * second one, and so on, and comparing two keys is a single memcmp instead of one comparison per segment.
+ *
+ * Lookups may pass values for the leading segments only. The rows with a given prefix are adjacent, so that equality
+ * on the leading segments plus a range on the next one (e.g., tenant_id = 3 AND entity_id BETWEEN 10 AND 20) is
+ * answered by lower_bound({3, 10}) and upper_bound({3, 20}).
+ *
+ * The keys are stored in key order next to the chunk offsets. If no indexed segment holds strings, all keys have the
+ * same length and no key offsets are needed.
+ */
+class CompositeIndex : public BaseIndex {
+ public:
+  explicit CompositeIndex(const std::vector<std::shared_ptr<const AbstractSegment>>& segments_to_index);
+
+ protected:
+  Iterator _lower_bound(const std::vector<AllTypeVariant>& values) const final;
+  Iterator _upper_bound(const std::vector<AllTypeVariant>& values) const final;
+  Iterator _cbegin() const final;
+  Iterator _cend() const final;
+  std::vector<std::shared_ptr<const AbstractSegment>> _get_indexed_segments() const final;
+  size_t _memory_consumption() const final;
+
+  // Returns the binary-comparable key of values for the leading segments.
+  BinaryComparableKey _make_key(const std::vector<AllTypeVariant>& values) const;
+
+  // Returns the key of the row at the given position of _chunk_offsets.
+  std::span<const uint8_t> _key(const size_t position) const;
+
+  const std::vector<std::shared_ptr<const AbstractSegment>> _indexed_segments;
+
+  // Append the key of a search value for each indexed segment, resolved to the segment's data type.
+  std::vector<void (*)(const AllTypeVariant&, BinaryComparableKey&)> _append_key_functions;
+
+  std::vector<ChunkOffset> _chunk_offsets;
+  std::vector<uint8_t> _keys;
+
+  // The length of all keys if it is fixed, otherwise 0 and the key at position i is [_key_offsets[i],
+  // _key_offsets[i + 1]).
+  size_t _fixed_key_size{0};
+  std::vector<size_t> _key_offsets;
+};
+
+}  // namespace opossum
@@ -0,0 +1,83 @@
+#include "group_key_index.hpp"
+
+#include "storage/base_dictionary_segment.hpp"
+#include "storage/fixed_width_integer_vector.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+GroupKeyIndex::GroupKeyIndex(const std::vector<std::shared_ptr<const AbstractSegment>>& segments_to_index)
+    : BaseIndex(SegmentIndexType::GroupKey),
+      _indexed_segment(std::dynamic_pointer_cast<const BaseDictionarySegment>(segments_to_index.at(0))) {
+  Assert(segments_to_index.size() == 1, "GroupKeyIndex only works with a single segment.");
+  Assert(_indexed_segment, "GroupKeyIndex only works with a DictionarySegment.");
+
+  // The NULL ValueID of nullable segments is 0, the ValueIDs of the dictionary entries start at 1.
+  const auto value_id_offset = ValueID::base_type{_indexed_segment->is_nullable() ? 1u : 0u};
+  const auto unique_values_count = _indexed_segment->unique_values_count();
+
+  with_value_ids(*_indexed_segment->attribute_vector(), [&](const auto& value_ids) {
+    // First pass: count the rows per dictionary entry, shifted by one so that the prefix sum yields the start offsets.
+    _value_start_offsets.resize(unique_values_count + 1);
+    for (const auto value_id : value_ids) {
+      if (value_id >= value_id_offset) {
+        ++_value_start_offsets[value_id - value_id_offset + 1];
+      }
+    }
+    for (auto entry = size_t{0}; entry < unique_values_count; ++entry) {
+      _value_start_offsets[entry + 1] += _value_start_offsets[entry];
+    }
+
+    // Second pass: write each chunk offset to the next free position of its dictionary entry.
+    _positions.resize(_value_start_offsets.back());
+    auto next_positions = std::vector<ChunkOffset>(_value_start_offsets.cbegin(), _value_start_offsets.cend() - 1);
+    const auto row_count = static_cast<ChunkOffset>(value_ids.size());
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < row_count; ++chunk_offset) {
+      const auto value_id = value_ids[chunk_offset];
+      if (value_id >= value_id_offset) {
+        _positions[next_positions[value_id - value_id_offset]++] = chunk_offset;
+      }
+    }
+  });
+}
+
+BaseIndex::Iterator GroupKeyIndex::_lower_bound(const std::vector<AllTypeVariant>& values) const {
+  if (values.empty()) {
+    return _cbegin();
+  }
+  return _get_positions_iterator(_indexed_segment->lower_bound(values[0]));
+}
+
+BaseIndex::Iterator GroupKeyIndex::_upper_bound(const std::vector<AllTypeVariant>& values) const {
+  if (values.empty()) {
+    return _cend();
+  }
+  return _get_positions_iterator(_indexed_segment->upper_bound(values[0]));
+}
+
+BaseIndex::Iterator GroupKeyIndex::_cbegin() const {
+  return _positions.cbegin();
+}
+
+BaseIndex::Iterator GroupKeyIndex::_cend() const {
+  return _positions.cend();
+}
+
+std::vector<std::shared_ptr<const AbstractSegment>> GroupKeyIndex::_get_indexed_segments() const {
+  return {_indexed_segment};
+}
+
+size_t GroupKeyIndex::_memory_consumption() const {
+  return (_value_start_offsets.size() + _positions.size()) * sizeof(ChunkOffset);
+}
+
+BaseIndex::Iterator GroupKeyIndex::_get_positions_iterator(const ValueID value_id) const {
+  if (value_id == INVALID_VALUE_ID) {
+    return _cend();
+  }
+
+  const auto entry = value_id - (_indexed_segment->is_nullable() ? 1u : 0u);
+  return _positions.cbegin() + _value_start_offsets[entry];
+}
+
+}  // namespace opossum
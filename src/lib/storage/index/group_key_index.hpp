@@ -0,0 +1,41 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "base_index.hpp"
+
+namespace opossum {
+
+class BaseDictionarySegment;
+
+/**
+ * Index over a single DictionarySegment. The chunk offsets of all non-NULL rows are grouped by their ValueID in a
+ * compressed sparse row (CSR) layout: _positions holds the chunk offsets of the first dictionary entry, followed by
+ * those of the second one, and so on, and _value_start_offsets[i] is the position in _positions where the chunk offsets
+ * of the i-th dictionary entry begin. Since the dictionary is sorted, the chunk offsets are in key order, and a lookup
+ * is a lower_bound/upper_bound on the dictionary followed by two array accesses. The index is built with a counting
+ * sort, i.e., two linear passes over the attribute vector, and takes up 4 bytes per row and per dictionary entry.
+ */
+class GroupKeyIndex : public BaseIndex {
+ public:
+  explicit GroupKeyIndex(const std::vector<std::shared_ptr<const AbstractSegment>>& segments_to_index);
+
+ protected:
+  Iterator _lower_bound(const std::vector<AllTypeVariant>& values) const final;
+  Iterator _upper_bound(const std::vector<AllTypeVariant>& values) const final;
+  Iterator _cbegin() const final;
+  Iterator _cend() const final;
+  std::vector<std::shared_ptr<const AbstractSegment>> _get_indexed_segments() const final;
+  size_t _memory_consumption() const final;
+
+  // Returns the position in _positions of the first chunk offset with the given ValueID, which is a result of
+  // BaseDictionarySegment::lower_bound or upper_bound.
+  Iterator _get_positions_iterator(const ValueID value_id) const;
+
+  const std::shared_ptr<const BaseDictionarySegment> _indexed_segment;
+  std::vector<ChunkOffset> _value_start_offsets;
+  std::vector<ChunkOffset> _positions;
+};
+
+}  // namespace opossum
@@ -0,0 +1,108 @@
+#include "sorted_index.hpp"
+
+#include <algorithm>
+#include <numeric>
+
+#include "resolve_type.hpp"
+#include "storage/materialize.hpp"
+#include "storage/segment_data_type.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+class SortedIndex::BaseSortedValues {
+ public:
+  virtual ~BaseSortedValues() = default;
+
+  // Return the position of the first value that is not less / greater than the search value.
+  virtual size_t lower_bound(const AllTypeVariant& value) const = 0;
+  virtual size_t upper_bound(const AllTypeVariant& value) const = 0;
+
+  virtual size_t memory_consumption() const = 0;
+};
+
+template <typename T>
+class SortedIndex::SortedValues : public SortedIndex::BaseSortedValues {
+ public:
+  explicit SortedValues(std::vector<T>&& values) : _values(std::move(values)) {}
+
+  size_t lower_bound(const AllTypeVariant& value) const final {
+    return std::lower_bound(_values.cbegin(), _values.cend(), type_cast<T>(value)) - _values.cbegin();
+  }
+
+  size_t upper_bound(const AllTypeVariant& value) const final {
+    return std::upper_bound(_values.cbegin(), _values.cend(), type_cast<T>(value)) - _values.cbegin();
+  }
+
+  size_t memory_consumption() const final {
+    return _values.size() * sizeof(T);
+  }
+
+ protected:
+  const std::vector<T> _values;
+};
+
+SortedIndex::SortedIndex(const std::vector<std::shared_ptr<const AbstractSegment>>& segments_to_index)
+    : BaseIndex(SegmentIndexType::Sorted), _indexed_segment(segments_to_index.at(0)) {
+  Assert(segments_to_index.size() == 1, "SortedIndex only works with a single segment.");
+
+  resolve_data_type(segment_data_type(*_indexed_segment), [&](auto type) {
+    using DataType = typename decltype(type)::type;
+
+    auto values = std::vector<DataType>{};
+    auto nulls = std::vector<bool>{};
+    materialize_values_and_nulls(*_indexed_segment, values, nulls);
+
+    // Equal values keep the order of their chunk offsets.
+    const auto row_count = static_cast<ChunkOffset>(values.size());
+    _chunk_offsets.reserve(row_count);
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < row_count; ++chunk_offset) {
+      if (!nulls[chunk_offset]) {
+        _chunk_offsets.push_back(chunk_offset);
+      }
+    }
+    std::stable_sort(_chunk_offsets.begin(), _chunk_offsets.end(),
+                     [&](const auto lhs, const auto rhs) { return values[lhs] < values[rhs]; });
+
+    auto sorted_values = std::vector<DataType>{};
+    sorted_values.reserve(_chunk_offsets.size());
+    for (const auto chunk_offset : _chunk_offsets) {
+      sorted_values.push_back(std::move(values[chunk_offset]));
+    }
+    _sorted_values = std::make_unique<SortedValues<DataType>>(std::move(sorted_values));
+  });
+}
+
+SortedIndex::~SortedIndex() = default;
+
+BaseIndex::Iterator SortedIndex::_lower_bound(const std::vector<AllTypeVariant>& values) const {
+  if (values.empty()) {
+    return _chunk_offsets.cbegin();
+  }
+  return _chunk_offsets.cbegin() + static_cast<std::ptrdiff_t>(_sorted_values->lower_bound(values[0]));
+}
+
+BaseIndex::Iterator SortedIndex::_upper_bound(const std::vector<AllTypeVariant>& values) const {
+  if (values.empty()) {
+    return _chunk_offsets.cend();
+  }
+  return _chunk_offsets.cbegin() + static_cast<std::ptrdiff_t>(_sorted_values->upper_bound(values[0]));
+}
+
+BaseIndex::Iterator SortedIndex::_cbegin() const {
+  return _chunk_offsets.cbegin();
+}
+
+BaseIndex::Iterator SortedIndex::_cend() const {
+  return _chunk_offsets.cend();
+}
+
+std::vector<std::shared_ptr<const AbstractSegment>> SortedIndex::_get_indexed_segments() const {
+  return {_indexed_segment};
+}
+
+size_t SortedIndex::_memory_consumption() const {
+  return _chunk_offsets.size() * sizeof(ChunkOffset) + _sorted_values->memory_consumption();
+}
+
+}  // namespace opossum
@@ -0,0 +1,39 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "base_index.hpp"
+
+namespace opossum {
+
+/**
+ * Index over a single segment of any type. It stores the chunk offsets of all non-NULL rows ordered by their value,
+ * together with the values in the same order, so that lookups are binary searches over a contiguous array. This
+ * costs sizeof(T) + 4 bytes per row, but works for every segment type.
+ */
+class SortedIndex : public BaseIndex {
+ public:
+  explicit SortedIndex(const std::vector<std::shared_ptr<const AbstractSegment>>& segments_to_index);
+
+  ~SortedIndex() override;
+
+ protected:
+  // The sorted values of the indexed segment. Their concrete type is resolved when the index is built.
+  class BaseSortedValues;
+  template <typename T>
+  class SortedValues;
+
+  Iterator _lower_bound(const std::vector<AllTypeVariant>& values) const final;
+  Iterator _upper_bound(const std::vector<AllTypeVariant>& values) const final;
+  Iterator _cbegin() const final;
+  Iterator _cend() const final;
+  std::vector<std::shared_ptr<const AbstractSegment>> _get_indexed_segments() const final;
+  size_t _memory_consumption() const final;
+
+  const std::shared_ptr<const AbstractSegment> _indexed_segment;
+  std::vector<ChunkOffset> _chunk_offsets;
+  std::unique_ptr<const BaseSortedValues> _sorted_values;
+};
+
+}  // namespace opossum
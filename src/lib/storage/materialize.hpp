@@ -0,0 +1,273 @@
+#pragma once
+
+#include <ranges>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+#include "abstract_attribute_vector.hpp"
+#include "abstract_segment.hpp"
+#include "dictionary_segment.hpp"
+#include "fixed_width_integer_vector.hpp"
+#include "pos_list_utils.hpp"
+#include "reference_segment.hpp"
+#include "table.hpp"
+#include "type_cast.hpp"
+#include "utils/assert.hpp"
+#include "value_segment.hpp"
+
+namespace opossum {
+
+// Number of positions the gather looks ahead when prefetching referenced values.
+constexpr auto GATHER_PREFETCH_DISTANCE = size_t{16};
+
+// Copies the values of `segment` at the chunk offsets chunk_offset_of(indices[0]), chunk_offset_of(indices[1]), ... to
+// values[indices[0]], values[indices[1]], ... The concrete type of the segment is resolved once for all positions,
+// and since the positions can be random, the referenced values are prefetched.
+template <typename T, typename Indices, typename ChunkOffsetOf>
+void gather_positions(const AbstractSegment& segment, const ChunkOffsetOf& chunk_offset_of, const Indices& indices,
+                      T* values, std::vector<bool>::iterator nulls) {
+  const auto index_count = indices.size();
+
+  if (const auto value_segment = dynamic_cast<const ValueSegment<T>*>(&segment)) {
+    const auto& segment_values = value_segment->values();
+    const auto* validity = value_segment->is_nullable() ? &value_segment->validity() : nullptr;
+    for (auto position = size_t{0}; position < index_count; ++position) {
+      if (position + GATHER_PREFETCH_DISTANCE < index_count) {
+        const auto prefetch_offset = chunk_offset_of(indices[position + GATHER_PREFETCH_DISTANCE]);
+        if constexpr (std::is_same_v<T, std::string>) {
+          segment_values.prefetch(prefetch_offset);
+        } else {
+          __builtin_prefetch(&segment_values[prefetch_offset]);
+        }
+      }
+
+      const auto index = indices[position];
+      const auto chunk_offset = chunk_offset_of(index);
+      values[index] = segment_values[chunk_offset];
+      nulls[index] = validity && validity->is_null(chunk_offset);
+    }
+    return;
+  }
+
+  if (const auto dictionary_segment = dynamic_cast<const DictionarySegment<T>*>(&segment)) {
+    const auto& dictionary = dictionary_segment->dictionary();
+    const auto is_nullable = dictionary_segment->is_nullable();
+    const auto gather = [&](const auto& value_ids) {
+      for (auto position = size_t{0}; position < index_count; ++position) {
+        if (position + GATHER_PREFETCH_DISTANCE < index_count) {
+          __builtin_prefetch(&value_ids[chunk_offset_of(indices[position + GATHER_PREFETCH_DISTANCE])]);
+        }
+
+        // The ValueIDs of dictionary entries are shifted by one in nullable segments, with 0 standing for NULL.
+        const auto index = indices[position];
+        const auto value_id = value_ids[chunk_offset_of(index)];
+        if (is_nullable && value_id == 0) {
+          nulls[index] = true;
+        } else {
+          values[index] = dictionary[value_id - is_nullable];
+          nulls[index] = false;
+        }
+      }
+    };
+
+    with_value_ids(*dictionary_segment->attribute_vector(), gather);
+    return;
+  }
+
+  for (auto position = size_t{0}; position < index_count; ++position) {
+    const auto index = indices[position];
+    const auto value = segment[chunk_offset_of(index)];
+    nulls[index] = variant_is_null(value);
+    if (!nulls[index]) {
+      values[index] = type_cast<T>(value);
+    }
+  }
+}
+
+// Gathers the values of a PosList, which may reference multiple chunks and contain NULL_ROW_IDs, to values[0],
+// values[1], ... Positions are grouped by ChunkID so that each referenced segment is looked up and its type resolved
+// once. Scan results are already ordered by ChunkID and are processed run by run. Other PosLists (e.g., sorted ones)
+// are bucketed by ChunkID first. The NULL flags of NULL positions are left untouched.
+template <typename T>
+void gather_row_ids(const Table& referenced_table, const ColumnID column_id, const PosList& pos_list, T* values,
+                    std::vector<bool>::iterator nulls) {
+  const auto position_count = pos_list.size();
+  const auto chunk_offset_of = [&](const auto index) { return pos_list[index].chunk_offset; };
+
+  auto is_grouped = true;
+  auto previous_chunk_id = ChunkID{0};
+  for (const auto& row_id : pos_list) {
+    if (row_id.is_null()) {
+      continue;
+    }
+    if (row_id.chunk_id < previous_chunk_id) {
+      is_grouped = false;
+      break;
+    }
+    previous_chunk_id = row_id.chunk_id;
+  }
+
+  if (is_grouped) {
+    auto run_begin = size_t{0};
+    while (run_begin < position_count) {
+      const auto chunk_id = pos_list[run_begin].chunk_id;
+      auto run_end = run_begin + 1;
+      while (run_end < position_count && pos_list[run_end].chunk_id == chunk_id) {
+        ++run_end;
+      }
+
+      if (!pos_list[run_begin].is_null()) {
+        // Evicting the chunk only frees the segment once it is no longer held.
+        const auto referenced_segment = referenced_table.get_chunk(chunk_id)->get_segment(column_id);
+        gather_positions(*referenced_segment, chunk_offset_of, std::views::iota(run_begin, run_end), values, nulls);
+      }
+      run_begin = run_end;
+    }
+    return;
+  }
+
+  // Counting sort of the position indices by ChunkID.
+  const auto chunk_count = referenced_table.chunk_count();
+  auto bucket_begins = std::vector<uint32_t>(chunk_count + 1);
+  for (const auto& row_id : pos_list) {
+    if (!row_id.is_null()) {
+      ++bucket_begins[row_id.chunk_id + 1];
+    }
+  }
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    bucket_begins[chunk_id + 1] += bucket_begins[chunk_id];
+  }
+
+  auto grouped_indices = std::vector<uint32_t>(bucket_begins.back());
+  auto bucket_ends = std::vector<uint32_t>(bucket_begins.cbegin(), bucket_begins.cend() - 1);
+  for (auto index = size_t{0}; index < position_count; ++index) {
+    const auto& row_id = pos_list[index];
+    if (!row_id.is_null()) {
+      grouped_indices[bucket_ends[row_id.chunk_id]++] = static_cast<uint32_t>(index);
+    }
+  }
+
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    const auto bucket_begin = bucket_begins[chunk_id];
+    const auto bucket_size = bucket_begins[chunk_id + 1] - bucket_begin;
+    if (bucket_size == 0) {
+      continue;
+    }
+
+    const auto referenced_segment = referenced_table.get_chunk(chunk_id)->get_segment(column_id);
+    gather_positions(*referenced_segment, chunk_offset_of,
+                     std::span<const uint32_t>{grouped_indices.data() + bucket_begin, bucket_size}, values, nulls);
+  }
+}
+
+// Appends the values referenced by a ReferenceSegment to `values` and their NULL flags to `nulls`. Instead of going
+// through the table, chunk, and segment for every position, each referenced segment is looked up and its type resolved
+// once. Position lists of a single chunk are read with their concrete type, so that, e.g., an EntireChunkPosList is
+// gathered without reading any positions.
+template <typename T, typename Allocator>
+void gather_reference_segment(const ReferenceSegment& segment, std::vector<T, Allocator>& values,
+                              std::vector<bool>& nulls) {
+  const auto& referenced_table = *segment.referenced_table();
+  const auto column_id = segment.referenced_column_id();
+  const auto position_count = segment.pos_list()->size();
+
+  const auto output_begin = values.size();
+  values.resize(output_begin + position_count);
+  nulls.resize(output_begin + position_count, true);
+  auto* const output_values = values.data() + output_begin;
+  const auto output_nulls = nulls.begin() + static_cast<std::ptrdiff_t>(output_begin);
+
+  resolve_pos_list_type(*segment.pos_list(), [&](const auto& pos_list) {
+    using PosListType = std::decay_t<decltype(pos_list)>;
+    if constexpr (std::is_same_v<PosListType, PosList>) {
+      gather_row_ids(referenced_table, column_id, pos_list, output_values, output_nulls);
+    } else {
+      if (position_count == 0) {
+        return;
+      }
+
+      const auto referenced_segment = referenced_table.get_chunk(*pos_list.single_chunk_id())->get_segment(column_id);
+      const auto indices = std::views::iota(size_t{0}, position_count);
+      if constexpr (std::is_same_v<PosListType, SingleChunkPosList>) {
+        const auto& chunk_offsets = pos_list.chunk_offsets();
+        gather_positions(
+            *referenced_segment, [&](const auto index) { return chunk_offsets[index]; }, indices, output_values,
+            output_nulls);
+      } else if constexpr (std::is_same_v<PosListType, EntireChunkPosList>) {
+        gather_positions(
+            *referenced_segment, [](const auto index) { return static_cast<ChunkOffset>(index); }, indices,
+            output_values, output_nulls);
+      } else {
+        // Decoding the bitmap once is cheaper than locating each position in it.
+        const auto chunk_offsets = pos_list.chunk_offsets();
+        gather_positions(
+            *referenced_segment, [&](const auto index) { return chunk_offsets[index]; }, indices, output_values,
+            output_nulls);
+      }
+    }
+  });
+}
+
+// Appends all values of a segment to `values` and their NULL flags to `nulls`. NULL positions hold a value-initialized
+// T. The data type of the segment has to be T. Operators should use this instead of AbstractSegment::operator[] when
+// they need the values of a whole segment. `values` may use any allocator, e.g., that of a std::pmr::vector.
+template <typename T, typename Allocator>
+void materialize_values_and_nulls(const AbstractSegment& segment, std::vector<T, Allocator>& values,
+                                  std::vector<bool>& nulls) {
+  const auto segment_size = segment.size();
+  values.reserve(values.size() + segment_size);
+  nulls.reserve(nulls.size() + segment_size);
+
+  if (const auto value_segment = dynamic_cast<const ValueSegment<T>*>(&segment)) {
+    const auto& segment_values = value_segment->values();
+    if constexpr (std::is_same_v<T, std::string>) {
+      for (auto chunk_offset = ChunkOffset{0}; chunk_offset < segment_size; ++chunk_offset) {
+        values.emplace_back(segment_values[chunk_offset]);
+      }
+    } else {
+      values.insert(values.end(), segment_values.cbegin(), segment_values.cend());
+    }
+    if (value_segment->is_nullable()) {
+      const auto& validity = value_segment->validity();
+      for (auto chunk_offset = ChunkOffset{0}; chunk_offset < segment_size; ++chunk_offset) {
+        nulls.push_back(validity.is_null(chunk_offset));
+      }
+    } else {
+      nulls.resize(nulls.size() + segment_size, false);
+    }
+    return;
+  }
+
+  if (const auto dictionary_segment = dynamic_cast<const DictionarySegment<T>*>(&segment)) {
+    const auto& attribute_vector = *dictionary_segment->attribute_vector();
+    const auto is_nullable = dictionary_segment->is_nullable();
+    const auto null_value_id = dictionary_segment->null_value_id();
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < segment_size; ++chunk_offset) {
+      const auto value_id = attribute_vector.get(chunk_offset);
+      if (is_nullable && value_id == null_value_id) {
+        values.emplace_back();
+        nulls.push_back(true);
+      } else {
+        values.push_back(dictionary_segment->value_of_value_id(value_id));
+        nulls.push_back(false);
+      }
+    }
+    return;
+  }
+
+  if (const auto reference_segment = dynamic_cast<const ReferenceSegment*>(&segment)) {
+    gather_reference_segment(*reference_segment, values, nulls);
+    return;
+  }
+
+  // Other segment types are accessed through the generic interface.
+  for (auto chunk_offset = ChunkOffset{0}; chunk_offset < segment_size; ++chunk_offset) {
+    const auto value = segment[chunk_offset];
+    const auto is_null = variant_is_null(value);
+    values.push_back(is_null ? T{} : type_cast<T>(value));
+    nulls.push_back(is_null);
+  }
+}
+
+}  // namespace opossum
@@ -0,0 +1,63 @@
+#pragma once
+
+#include <memory_resource>
+#include <vector>
+
+#include "abstract_pos_list.hpp"
+
+namespace opossum {
+
+// PosList stores one RowID (8 bytes) per position. It is the only position list that can reference multiple chunks and
+// hold NULL_ROW_IDs, e.g., for the output of a join. Apart from that, it is used like a std::pmr::vector<RowID>, whose
+// constructors optionally take the memory resource to allocate from.
+class PosList final : public AbstractPosList, private std::pmr::vector<RowID> {
+ public:
+  using Vector = std::pmr::vector<RowID>;
+
+  using Vector::Vector;
+
+  using Vector::const_iterator;
+  using Vector::iterator;
+  using Vector::value_type;
+
+  using Vector::back;
+  using Vector::begin;
+  using Vector::capacity;
+  using Vector::cbegin;
+  using Vector::cend;
+  using Vector::clear;
+  using Vector::data;
+  using Vector::emplace_back;
+  using Vector::end;
+  using Vector::front;
+  using Vector::get_allocator;
+  using Vector::push_back;
+  using Vector::reserve;
+  using Vector::resize;
+
+  RowID operator[](const size_t index) const final {
+    return Vector::operator[](index);
+  }
+
+  RowID& operator[](const size_t index) {
+    return Vector::operator[](index);
+  }
+
+  size_t size() const final {
+    return Vector::size();
+  }
+
+  std::optional<ChunkID> single_chunk_id() const final {
+    return std::nullopt;
+  }
+
+  size_t memory_usage() const final {
+    return size() * sizeof(RowID);
+  }
+
+  bool operator==(const PosList& other) const {
+    return static_cast<const Vector&>(*this) == static_cast<const Vector&>(other);
+  }
+};
+
+}  // namespace opossum
@@ -0,0 +1,37 @@
+#include "pos_list_utils.hpp"
+
+#include <algorithm>
+#include <functional>
+
+#include "query_memory_context.hpp"
+
+namespace opossum {
+
+std::shared_ptr<const AbstractPosList> make_single_chunk_pos_list(
+    const ChunkID chunk_id, const ChunkOffset chunk_size, std::pmr::vector<ChunkOffset> chunk_offsets,
+    const std::shared_ptr<QueryMemoryContext>& memory_context) {
+  DebugAssert(std::adjacent_find(chunk_offsets.cbegin(), chunk_offsets.cend(), std::greater_equal<>{}) ==
+                  chunk_offsets.cend(),
+              "Chunk offsets have to be strictly ascending.");
+  DebugAssert(chunk_offsets.empty() || chunk_offsets.back() < chunk_size, "Chunk offset out of range.");
+
+  // Strictly ascending offsets below chunk_size can only be as many as chunk_size if they are 0, 1, 2, ...
+  if (chunk_offsets.size() == chunk_size) {
+    return make_shared_in<EntireChunkPosList>(memory_context, chunk_id, chunk_size);
+  }
+
+  auto* const memory_resource = get_memory_resource(memory_context);
+  if (chunk_offsets.size() * BITMAP_POS_LIST_DENSITY >= chunk_size) {
+    return make_shared_in<BitmapPosList>(memory_context, chunk_id, chunk_offsets, memory_resource);
+  }
+
+  // Moving a vector into one that uses another memory resource would copy it anyway.
+  if (chunk_offsets.get_allocator().resource() != memory_resource) {
+    return make_shared_in<SingleChunkPosList>(
+        memory_context, chunk_id,
+        std::pmr::vector<ChunkOffset>{chunk_offsets.cbegin(), chunk_offsets.cend(), memory_resource});
+  }
+  return make_shared_in<SingleChunkPosList>(memory_context, chunk_id, std::move(chunk_offsets));
+}
+
+}  // namespace opossum
@@ -0,0 +1,51 @@
+#pragma once
+
+#include <memory>
+#include <memory_resource>
+#include <vector>
+
+#include "bitmap_pos_list.hpp"
+#include "entire_chunk_pos_list.hpp"
+#include "pos_list.hpp"
+#include "single_chunk_pos_list.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+class QueryMemoryContext;
+
+// A BitmapPosList is used if at least one in BITMAP_POS_LIST_DENSITY rows of the chunk is selected. From there on, one
+// bit per row of the chunk is cheaper than the four bytes per position of a SingleChunkPosList.
+constexpr auto BITMAP_POS_LIST_DENSITY = size_t{32};
+
+// Calls func with the position list cast to its concrete type, so that its positions can be accessed without a virtual
+// call per row. Example:
+//
+//   resolve_pos_list_type(*reference_segment->pos_list(), [&](const auto& pos_list) {
+//     using PosListType = std::decay_t<decltype(pos_list)>;
+//     if constexpr (std::is_same_v<PosListType, BitmapPosList>) { ... }
+//   });
+template <typename Functor>
+void resolve_pos_list_type(const AbstractPosList& pos_list, const Functor& func) {
+  if (const auto row_id_pos_list = dynamic_cast<const PosList*>(&pos_list)) {
+    func(*row_id_pos_list);
+  } else if (const auto single_chunk_pos_list = dynamic_cast<const SingleChunkPosList*>(&pos_list)) {
+    func(*single_chunk_pos_list);
+  } else if (const auto entire_chunk_pos_list = dynamic_cast<const EntireChunkPosList*>(&pos_list)) {
+    func(*entire_chunk_pos_list);
+  } else if (const auto bitmap_pos_list = dynamic_cast<const BitmapPosList*>(&pos_list)) {
+    func(*bitmap_pos_list);
+  } else {
+    Fail("Unsupported position list type.");
+  }
+}
+
+// Returns the most compact position list for the given strictly ascending offsets into a chunk with `chunk_size` rows:
+// an EntireChunkPosList if all rows are selected, a BitmapPosList for dense selections, and a SingleChunkPosList
+// otherwise. The list and its buffers are allocated from the memory context, if one is given. A SingleChunkPosList
+// takes over the offsets if they already are allocated from the context's memory resource.
+std::shared_ptr<const AbstractPosList> make_single_chunk_pos_list(
+    const ChunkID chunk_id, const ChunkOffset chunk_size, std::pmr::vector<ChunkOffset> chunk_offsets,
+    const std::shared_ptr<QueryMemoryContext>& memory_context = nullptr);
+
+}  // namespace opossum
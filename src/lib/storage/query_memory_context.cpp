@@ -0,0 +1,73 @@
+#include "query_memory_context.hpp"
+
+#include <string>
+
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+QueryMemoryContext::QueryMemoryContext() : _tracking_resource{}, _pool_resource{&_tracking_resource} {}
+
+std::pmr::memory_resource* QueryMemoryContext::memory_resource() {
+  return &_pool_resource;
+}
+
+void QueryMemoryContext::set_memory_budget(size_t bytes) {
+  _memory_budget.store(bytes);
+}
+
+size_t QueryMemoryContext::memory_budget() {
+  return _memory_budget.load();
+}
+
+size_t QueryMemoryContext::total_allocated_bytes() {
+  return _total_allocated_bytes.load();
+}
+
+size_t QueryMemoryContext::allocated_bytes() const {
+  return _tracking_resource.allocated_bytes.load();
+}
+
+size_t QueryMemoryContext::peak_allocated_bytes() const {
+  return _tracking_resource.peak_allocated_bytes.load();
+}
+
+size_t QueryMemoryContext::cumulative_allocated_bytes() const {
+  return _tracking_resource.cumulative_allocated_bytes.load();
+}
+
+void* QueryMemoryContext::TrackingResource::do_allocate(size_t bytes, size_t alignment) {
+  // The bytes are reserved before they are allocated, so that concurrent queries cannot overshoot the budget together.
+  const auto total_bytes = _total_allocated_bytes.fetch_add(bytes) + bytes;
+  const auto budget = _memory_budget.load();
+  if (total_bytes > budget) {
+    _total_allocated_bytes.fetch_sub(bytes);
+    Fail("Memory budget of " + std::to_string(budget) + " bytes exceeded, queries would hold " +
+         std::to_string(total_bytes) + " bytes.");
+  }
+
+  auto* pointer = static_cast<void*>(nullptr);
+  try {
+    pointer = std::pmr::new_delete_resource()->allocate(bytes, alignment);
+  } catch (...) {
+    _total_allocated_bytes.fetch_sub(bytes);
+    throw;
+  }
+  cumulative_allocated_bytes.fetch_add(bytes);
+  const auto current_bytes = allocated_bytes.fetch_add(bytes) + bytes;
+  auto peak_bytes = peak_allocated_bytes.load();
+  while (peak_bytes < current_bytes && !peak_allocated_bytes.compare_exchange_weak(peak_bytes, current_bytes)) {}
+  return pointer;
+}
+
+void QueryMemoryContext::TrackingResource::do_deallocate(void* pointer, size_t bytes, size_t alignment) {
+  std::pmr::new_delete_resource()->deallocate(pointer, bytes, alignment);
+  allocated_bytes.fetch_sub(bytes);
+  _total_allocated_bytes.fetch_sub(bytes);
+}
+
+bool QueryMemoryContext::TrackingResource::do_is_equal(const std::pmr::memory_resource& other) const noexcept {
+  return this == &other;
+}
+
+}  // namespace opossum
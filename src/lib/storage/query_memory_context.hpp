@@ -0,0 +1,121 @@
+#pragma once
+
+#include <atomic>
+#include <limits>
+#include <memory>
+#include <memory_resource>
+#include <utility>
+
+#include "types.hpp"
+
+namespace opossum {
+
+// The memory that the operators of a query allocate their intermediate results from, e.g., position lists,
+// ReferenceSegments, and materialized values. Allocations are served by a std::pmr::synchronized_pool_resource, whose
+// per-thread pools keep concurrent queries (and the threads of one query) from contending for the global heap.
+// Memory is returned to the system all at once when the context is destroyed.
+//
+// Objects such as segments and chunks are created with make_shared_in, so that each of them keeps the context alive.
+// Operators also pass the context on to their output tables. Hence, the memory of a query is released once the
+// operators of its plan and the last table or segment it produced are gone.
+//
+// All contexts share a global memory budget. An allocation that would let the memory held by all queries exceed it
+// fails with an exception, which aborts the operator and thus the query before the process runs out of memory.
+class QueryMemoryContext : private Noncopyable {
+ public:
+  static constexpr auto UNLIMITED_MEMORY_BUDGET = std::numeric_limits<size_t>::max();
+
+  QueryMemoryContext();
+
+  // Sets the number of bytes that all queries together may hold. Queries that already hold more are not affected
+  // until they allocate again. Base tables do not count towards the budget.
+  static void set_memory_budget(size_t bytes);
+
+  static size_t memory_budget();
+
+  // Returns the number of bytes that all queries currently hold.
+  static size_t total_allocated_bytes();
+
+  std::pmr::memory_resource* memory_resource();
+
+  // Returns the number of bytes that the query currently holds, including the unused parts of its pools.
+  size_t allocated_bytes() const;
+
+  // Returns the maximum of allocated_bytes() over the lifetime of the context.
+  size_t peak_allocated_bytes() const;
+
+  // Returns the number of bytes that the query has taken from the heap so far, including those it returned since. The
+  // difference before and after an operator is what the operator allocated beyond the free memory of the pools.
+  size_t cumulative_allocated_bytes() const;
+
+ protected:
+  // Counts the bytes that the pools take from the global heap.
+  class TrackingResource : public std::pmr::memory_resource {
+   public:
+    std::atomic<size_t> allocated_bytes{0};
+    std::atomic<size_t> peak_allocated_bytes{0};
+    std::atomic<size_t> cumulative_allocated_bytes{0};
+
+   protected:
+    void* do_allocate(size_t bytes, size_t alignment) final;
+    void do_deallocate(void* pointer, size_t bytes, size_t alignment) final;
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept final;
+  };
+
+  inline static std::atomic<size_t> _memory_budget{UNLIMITED_MEMORY_BUDGET};
+  inline static std::atomic<size_t> _total_allocated_bytes{0};
+
+  TrackingResource _tracking_resource;
+  // Declared after the TrackingResource, since it returns its memory to it on destruction.
+  std::pmr::synchronized_pool_resource _pool_resource;
+};
+
+// Returns the memory resource of the memory context, or the default resource if there is none.
+inline std::pmr::memory_resource* get_memory_resource(const std::shared_ptr<QueryMemoryContext>& memory_context) {
+  return memory_context ? memory_context->memory_resource() : std::pmr::get_default_resource();
+}
+
+// An allocator that allocates from a QueryMemoryContext and keeps it alive, so that objects created with
+// std::allocate_shared can safely outlive the tables and operators of their query.
+template <typename T>
+class QueryMemoryAllocator {
+ public:
+  using value_type = T;
+
+  explicit QueryMemoryAllocator(const std::shared_ptr<QueryMemoryContext>& memory_context)
+      : _memory_context(memory_context) {}
+
+  template <typename U>
+  explicit QueryMemoryAllocator(const QueryMemoryAllocator<U>& other) : _memory_context(other._memory_context) {}
+
+  T* allocate(const size_t count) {
+    return static_cast<T*>(_memory_context->memory_resource()->allocate(count * sizeof(T), alignof(T)));
+  }
+
+  void deallocate(T* pointer, const size_t count) {
+    _memory_context->memory_resource()->deallocate(pointer, count * sizeof(T), alignof(T));
+  }
+
+  template <typename U>
+  bool operator==(const QueryMemoryAllocator<U>& other) const {
+    return _memory_context == other._memory_context;
+  }
+
+ protected:
+  template <typename U>
+  friend class QueryMemoryAllocator;
+
+  std::shared_ptr<QueryMemoryContext> _memory_context;
+};
+
+// Creates an object like std::make_shared, but allocates it together with its control block from the memory context,
+// if one is given.
+template <typename T, typename... Args>
+std::shared_ptr<T> make_shared_in(const std::shared_ptr<QueryMemoryContext>& memory_context, Args&&... args) {
+  if (!memory_context) {
+    return std::make_shared<T>(std::forward<Args>(args)...);
+  }
+  return std::allocate_shared<T>(QueryMemoryAllocator<T>{memory_context}, std::forward<Args>(args)...);
+}
+
+}  // namespace opossum
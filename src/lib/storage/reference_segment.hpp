@@ -1,29 +1,38 @@
 #pragma once
 
 #include "abstract_segment.hpp"
+#include "pos_list.hpp"
 
 namespace opossum {
 
 class Table;
 
 // ReferenceSegment is a specific segment type that stores all its values as position list of a referenced column.
+// The position list can have any representation derived from AbstractPosList (see pos_list_utils.hpp).
 class ReferenceSegment : public AbstractSegment {
  public:
   // Creates a reference segment. The parameters specify the positions and the referenced column.
   ReferenceSegment(const std::shared_ptr<const Table>& referenced_table, const ColumnID referenced_column_id,
-                   const std::shared_ptr<const PosList>& pos);
+                   const std::shared_ptr<const AbstractPosList>& pos);
 
   AllTypeVariant operator[](const ChunkOffset chunk_offset) const override;
 
   ChunkOffset size() const override;
 
-  const std::shared_ptr<const PosList>& pos_list() const;
+  const std::shared_ptr<const AbstractPosList>& pos_list() const;
 
   const std::shared_ptr<const Table>& referenced_table() const;
 
   ColumnID referenced_column_id() const;
 
+  // Returns the memory usage of the position list. The referenced table is not included, since it is accounted for on
+  // its own. Chunk::estimate_memory_usage() counts position lists shared by several segments only once.
   size_t estimate_memory_usage() const final;
+
+ protected:
+  const std::shared_ptr<const Table> _referenced_table;
+  const ColumnID _referenced_column_id;
+  const std::shared_ptr<const AbstractPosList> _pos_list;
 };
 
 }  // namespace opossum
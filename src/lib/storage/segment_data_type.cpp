@@ -0,0 +1,29 @@
+#include "segment_data_type.hpp"
+
+#include "dictionary_segment.hpp"
+#include "reference_segment.hpp"
+#include "resolve_type.hpp"
+#include "table.hpp"
+#include "utils/assert.hpp"
+#include "value_segment.hpp"
+
+namespace opossum {
+
+std::string segment_data_type(const AbstractSegment& segment) {
+  if (const auto reference_segment = dynamic_cast<const ReferenceSegment*>(&segment)) {
+    return reference_segment->referenced_table()->column_type(reference_segment->referenced_column_id());
+  }
+
+  auto data_type = std::string{};
+  hana::for_each(data_types, [&](auto x) {
+    using DataType = typename decltype(+hana::second(x))::type;
+    if (dynamic_cast<const ValueSegment<DataType>*>(&segment) ||
+        dynamic_cast<const DictionarySegment<DataType>*>(&segment)) {
+      data_type = hana::first(x);
+    }
+  });
+  Assert(!data_type.empty(), "Unsupported segment type.");
+  return data_type;
+}
+
+}  // namespace opossum
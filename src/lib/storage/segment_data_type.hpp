@@ -0,0 +1,13 @@
+#pragma once
+
+#include <string>
+
+namespace opossum {
+
+class AbstractSegment;
+
+// Returns the type string (e.g., "int") of the values stored in a segment. Components that only see segments, such as
+// indexes, use this together with resolve_data_type to access the segment with its concrete type.
+std::string segment_data_type(const AbstractSegment& segment);
+
+}  // namespace opossum
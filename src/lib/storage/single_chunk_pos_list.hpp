@@ -0,0 +1,43 @@
+#pragma once
+
+#include <memory_resource>
+#include <utility>
+#include <vector>
+
+#include "abstract_pos_list.hpp"
+
+namespace opossum {
+
+// SingleChunkPosList references positions of a single chunk. Since the ChunkID is stored only once, each position
+// takes up four bytes instead of eight. The offsets stay in the memory resource of the given vector.
+class SingleChunkPosList final : public AbstractPosList {
+ public:
+  SingleChunkPosList(const ChunkID chunk_id, std::pmr::vector<ChunkOffset> chunk_offsets)
+      : _chunk_id(chunk_id), _chunk_offsets(std::move(chunk_offsets)) {}
+
+  RowID operator[](const size_t index) const final {
+    return RowID{_chunk_id, _chunk_offsets[index]};
+  }
+
+  size_t size() const final {
+    return _chunk_offsets.size();
+  }
+
+  std::optional<ChunkID> single_chunk_id() const final {
+    return _chunk_id;
+  }
+
+  size_t memory_usage() const final {
+    return _chunk_offsets.size() * sizeof(ChunkOffset);
+  }
+
+  const std::pmr::vector<ChunkOffset>& chunk_offsets() const {
+    return _chunk_offsets;
+  }
+
+ protected:
+  const ChunkID _chunk_id;
+  const std::pmr::vector<ChunkOffset> _chunk_offsets;
+};
+
+}  // namespace opossum
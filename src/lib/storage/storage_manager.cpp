@@ -1,6 +1,7 @@
 #include "storage_manager.hpp"
 
 #include <utility>
+#include <vector>
 
 #include "utils/assert.hpp"
 
@@ -54,6 +55,25 @@ void StorageManager::print(std::ostream& out) const {
   }
 }
 
+size_t StorageManager::estimate_memory_usage() const {
+  auto memory_usage = size_t{0};
+  for (const auto& [table_name, table] : _tables) {
+    memory_usage += table->estimate_memory_usage();
+  }
+  return memory_usage;
+}
+
+size_t StorageManager::evict_cold_chunks(const size_t memory_limit) {
+  auto chunks = std::vector<std::pair<Table*, ChunkID>>{};
+  for (const auto& [table_name, table] : _tables) {
+    const auto chunk_count = table->chunk_count();
+    for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+      chunks.emplace_back(table.get(), chunk_id);
+    }
+  }
+  return evict_least_recently_accessed_chunks(chunks, estimate_memory_usage(), memory_limit);
+}
+
 void StorageManager::reset() {
   // Implementation goes here
   _tables.clear();
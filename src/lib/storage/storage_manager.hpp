@@ -29,6 +29,14 @@ class StorageManager : private Noncopyable {
   // Prints information about all tables in the storage manager (name, #columns, #rows, #chunks).
   void print(std::ostream& out = std::cout) const;
 
+  // Returns the calculated memory usage of all tables.
+  size_t estimate_memory_usage() const;
+
+  // Evicts the least recently accessed chunks of all tables (see Table::evict_chunk) until the memory that they freed
+  // brings the estimated memory usage down to memory_limit or no more chunks can be evicted. Returns the number of
+  // evicted chunks.
+  size_t evict_cold_chunks(const size_t memory_limit);
+
   // Deletes the entire StorageManager and creates a new one, used especially in tests.
   void reset();
 
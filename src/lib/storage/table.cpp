@@ -1,9 +1,47 @@
 #include "table.hpp"
 
+#include <unistd.h>
+
+#include <algorithm>
+#include <bit>
+#include <chrono>
+#include <mutex>
+#include <thread>
+#include <tuple>
+#include <utility>
+
+#include "chunk_file.hpp"
+#include "dictionary_segment.hpp"
 #include "resolve_type.hpp"
 #include "utils/assert.hpp"
 #include "value_segment.hpp"
 
+namespace {
+
+using namespace opossum;  // NOLINT(build/namespaces)
+
+// Only chunks consisting of ValueSegments can be appended to. Dictionary-encoded chunks are immutable, and so are
+// indexed chunks, as their indexes are not updated on append.
+bool is_mutable(const Chunk& chunk) {
+  if (chunk.column_count() == 0) {
+    return true;
+  }
+
+  if (!chunk.get_indexes().empty()) {
+    return false;
+  }
+
+  auto is_value_segment = false;
+  const auto segment = chunk.get_segment(ColumnID{0});
+  hana::for_each(types, [&](auto type) {
+    using DataType = typename decltype(type)::type;
+    is_value_segment |= static_cast<bool>(std::dynamic_pointer_cast<ValueSegment<DataType>>(segment));
+  });
+  return is_value_segment;
+}
+
+}  // namespace
+
 namespace opossum {
 
 //Notice
@@ -13,11 +51,26 @@ namespace opossum {
  * 2. const 和 引用类型的成员变量: 只能在初始化列表中进行初始化。
  * 3. 类类型的成员变量: ～没有～ 默认构造函数，或者你想用特定的参数来构造它们，那么你必须在初始化列表中进行初始化
   */
-Table::Table(const ChunkOffset target_chunk_size)
-    : _chunks{}, _column_names{}, _column_types{}, _column_nullable{}, _target_chunk_size(target_chunk_size) {
+Table::Table(const ChunkOffset target_chunk_size, const std::shared_ptr<QueryMemoryContext>& memory_context)
+    : _memory_context{memory_context},
+      _column_names{},
+      _column_types{},
+      _column_nullable{},
+      _target_chunk_size(target_chunk_size) {
   create_new_chunk();
 }
 
+Table::~Table() {
+  const auto chunk_count = this->chunk_count();
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    const auto& file = _slot(chunk_id).file;
+    if (!file.empty()) {
+      auto error_code = std::error_code{};
+      std::filesystem::remove(file, error_code);
+    }
+  }
+}
+
 // Notice:
 //push_back：这个方法接受一个已经构造的对象，并将其复制或移动到容器的末尾。如果你传递的是一个临时对象或者可以被移动的对象，
 //    那么push_back会尽可能地使用移动语义以提高效率。但是，如果你传递的对象不能被移动（只能被复制），或者需要先创建一个对象然后再添加到容器中，
@@ -32,11 +85,13 @@ void Table::add_column_definition(const std::string& name, const std::string& ty
 
 void Table::add_column(const std::string& name, const std::string& type, const bool nullable) {
   Assert(row_count() == 0, "Cannot add column definition to non-empty table");
-  for (const auto& chunk : _chunks) {
+  const auto chunk_count = this->chunk_count();
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    const auto chunk = _slot(chunk_id).chunk.load();
     auto new_segment = std::shared_ptr<AbstractSegment>{};
     resolve_data_type(type, [&](auto data_type) {
       using DataType = typename decltype(data_type)::type;
-      new_segment = std::make_shared<ValueSegment<DataType>>(nullable);
+      new_segment = make_shared_in<ValueSegment<DataType>>(_memory_context, nullable, memory_resource());
     });
     chunk->add_segment(new_segment);
   }
@@ -44,24 +99,78 @@ void Table::add_column(const std::string& name, const std::string& type, const b
 }
 
 void Table::create_new_chunk() {
-  auto new_chunk = std::make_shared<Chunk>();
+  auto new_chunk = make_shared_in<Chunk>(_memory_context);
   for (auto index = uint16_t{0}; index < _column_names.size(); ++index) {
     auto new_segment = std::shared_ptr<AbstractSegment>{};
     resolve_data_type(_column_types[index], [&](auto data_type) {
       using DataType = typename decltype(data_type)::type;
-      new_segment = std::make_shared<ValueSegment<DataType>>(_column_nullable[index]);
+      new_segment =
+          make_shared_in<ValueSegment<DataType>>(_memory_context, _column_nullable[index], memory_resource());
     });
     new_chunk->add_segment(new_segment);
   }
-  _chunks.emplace_back(new_chunk);
+  const auto lock = std::unique_lock{_chunks_mutex};
+  _append_chunk(new_chunk);
+}
+
+void Table::emplace_chunk(const std::shared_ptr<Chunk> chunk) {
+  Assert(chunk->column_count() == column_count(), "Chunk does not match the table's column count.");
+  const auto lock = std::unique_lock{_chunks_mutex};
+  if (_chunk_count.load() == 1) {
+    auto& first_slot = _slot(ChunkID{0});
+    const auto first_chunk = first_slot.chunk.load();
+    if (first_chunk && first_chunk->size() == 0) {
+      _reset_slot(first_slot, chunk);
+      return;
+    }
+  }
+  _append_chunk(chunk);
+}
+
+void Table::replace_chunk(const ChunkID chunk_id, const std::shared_ptr<Chunk> chunk) {
+  Assert(chunk->column_count() == column_count(), "Chunk does not match the table's column count.");
+  const auto lock = std::unique_lock{_chunks_mutex};
+  Assert(chunk_id < _chunk_count.load(), "Chunk ID out of range.");
+  auto& slot = _slot(chunk_id);
+  Assert(slot.file.empty(), "Cannot replace an evicted chunk.");
+  _reset_slot(slot, chunk);
+}
+
+Table::ChunkSlot& Table::_slot(const ChunkID chunk_id) const {
+  const auto slot_number = size_t{chunk_id} + 1;
+  const auto block = std::bit_width(slot_number) - 1;
+  return _slot_blocks[block][slot_number - (size_t{1} << block)];
+}
+
+void Table::_append_chunk(const std::shared_ptr<Chunk>& chunk) {
+  const auto chunk_id = ChunkID{_chunk_count.load()};
+  Assert(chunk_id + 1 < INVALID_CHUNK_ID, "Too many chunks.");
+  const auto block = std::bit_width(size_t{chunk_id} + 1) - 1;
+  if (!_slot_blocks[block]) {
+    _slot_blocks[block] = std::make_unique<ChunkSlot[]>(size_t{1} << block);
+  }
+  _slot(chunk_id).chunk.store(chunk);
+  // Publishes the slot to get_chunk, which does not take the lock.
+  _chunk_count.store(chunk_id + 1, std::memory_order_release);
+}
+
+void Table::_reset_slot(ChunkSlot& slot, const std::shared_ptr<Chunk>& chunk) {
+  slot.chunk.store(chunk);
+  slot.last_access.store(0, std::memory_order_relaxed);
+  slot.file.clear();
+  slot.size = 0;
+  slot.evicted_chunk.reset();
 }
 
 void Table::append(const std::vector<AllTypeVariant>& values) {
   Assert(values.size() == _column_names.size(), "Number of values does not match number of columns.");
-  if (_chunks.back()->size() >= _target_chunk_size) {
+  // Evicted chunks are immutable.
+  auto last_chunk = _slot(ChunkID{_chunk_count.load() - 1}).chunk.load();
+  if (!last_chunk || last_chunk->size() >= _target_chunk_size || !is_mutable(*last_chunk)) {
     create_new_chunk();
+    last_chunk = _slot(ChunkID{_chunk_count.load() - 1}).chunk.load();
   }
-  _chunks.back()->append(values);
+  last_chunk->append(values);
 }
 
 ColumnCount Table::column_count() const {
@@ -75,11 +184,21 @@ ColumnCount Table::column_count() const {
 }
 
 uint64_t Table::row_count() const {
-  return ((_chunks.size() - 1) * _target_chunk_size) + _chunks.back()->size();
+  // Chunks emplaced by operators do not necessarily reach the target chunk size, so we cannot derive the row count from
+  // the number of chunks.
+  const auto lock = std::shared_lock{_chunks_mutex};
+  auto row_count = uint64_t{0};
+  const auto chunk_count = this->chunk_count();
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    const auto& slot = _slot(chunk_id);
+    const auto chunk = slot.chunk.load();
+    row_count += chunk ? chunk->size() : slot.size;
+  }
+  return row_count;
 }
 
 ChunkID Table::chunk_count() const {
-  return ChunkID{_chunks.size()};
+  return ChunkID{_chunk_count.load(std::memory_order_acquire)};
 }
 
 ColumnID Table::column_id_by_name(const std::string& column_name) const {
@@ -92,6 +211,25 @@ ChunkOffset Table::target_chunk_size() const {
   return _target_chunk_size;
 }
 
+const std::shared_ptr<QueryMemoryContext>& Table::memory_context() const {
+  return _memory_context;
+}
+
+std::pmr::memory_resource* Table::memory_resource() const {
+  return get_memory_resource(_memory_context);
+}
+
+size_t Table::estimate_memory_usage() const {
+  auto memory_usage = size_t{0};
+  const auto chunk_count = this->chunk_count();
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    if (const auto chunk = _slot(chunk_id).chunk.load()) {
+      memory_usage += chunk->estimate_memory_usage();
+    }
+  }
+  return memory_usage;
+}
+
 const std::vector<std::string>& Table::column_names() const {
   return _column_names;
 }
@@ -109,18 +247,171 @@ bool Table::column_nullable(const ColumnID column_id) const {
 }
 
 std::shared_ptr<Chunk> Table::get_chunk(ChunkID chunk_id) {
-  return _chunks.at(chunk_id);
+  return _load_chunk(chunk_id);
 }
 
 std::shared_ptr<const Chunk> Table::get_chunk(ChunkID chunk_id) const {
-  return _chunks.at(chunk_id);
+  return _load_chunk(chunk_id);
+}
+
+std::shared_ptr<Chunk> Table::_load_chunk(const ChunkID chunk_id) const {
+  Assert(chunk_id < chunk_count(), "Chunk " + std::to_string(chunk_id) + " does not exist.");
+  auto& slot = _slot(chunk_id);
+  // A plain store of the current time, as a shared counter would be contended by all threads that access chunks.
+  const auto access_time =
+      std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch());
+  slot.last_access.store(static_cast<uint64_t>(access_time.count()), std::memory_order_relaxed);
+  // Resident chunks are returned without taking the lock, which all threads accessing the table would contend for.
+  if (auto chunk = slot.chunk.load()) {
+    return chunk;
+  }
+
+  auto file = std::filesystem::path{};
+  {
+    // Another thread may have loaded the chunk in the meantime.
+    const auto lock = std::unique_lock{_chunks_mutex};
+    auto chunk = slot.chunk.load();
+    if (!chunk) {
+      chunk = slot.evicted_chunk.lock();
+    }
+    if (chunk) {
+      slot.chunk.store(chunk);
+      return chunk;
+    }
+    file = slot.file;
+  }
+
+  // The file is read without holding the lock, so that accesses to other chunks are not blocked by the disk read. The
+  // file of an evicted chunk is neither changed nor removed until the table is destroyed.
+  const auto loaded_chunk = read_chunk_file(file, _column_types, _memory_context);
+  const auto lock = std::unique_lock{_chunks_mutex};
+  if (auto chunk = slot.chunk.load()) {
+    return chunk;
+  }
+  slot.chunk.store(loaded_chunk);
+  return loaded_chunk;
 }
 
-// GCOVR_EXCL_START
 void Table::compress_chunk(const ChunkID chunk_id) {
-  // Implementation goes here
-  Fail("Implementation is missing.");
+  const auto chunk = get_chunk(chunk_id);
+  const auto column_count = chunk->column_count();
+
+  // Each segment is encoded independently, so we use one thread per segment.
+  auto compressed_segments = std::vector<std::shared_ptr<AbstractSegment>>(column_count);
+  auto threads = std::vector<std::thread>{};
+  threads.reserve(column_count);
+  for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+    threads.emplace_back([&, column_id]() {
+      resolve_data_type(_column_types[column_id], [&](auto data_type) {
+        using DataType = typename decltype(data_type)::type;
+        compressed_segments[column_id] =
+            make_shared_in<DictionarySegment<DataType>>(_memory_context, chunk->get_segment(column_id));
+      });
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  const auto compressed_chunk = make_shared_in<Chunk>(_memory_context);
+  for (const auto& segment : compressed_segments) {
+    compressed_chunk->add_segment(segment);
+  }
+  const auto lock = std::unique_lock{_chunks_mutex};
+  _slot(chunk_id).chunk.store(compressed_chunk);
+}
+
+void Table::set_eviction_directory(const std::filesystem::path& directory) {
+  _eviction_directory = directory;
+}
+
+size_t Table::evict_chunk(const ChunkID chunk_id) {
+  auto chunk = std::shared_ptr<Chunk>{};
+  auto file = std::filesystem::path{};
+  {
+    const auto lock = std::shared_lock{_chunks_mutex};
+    Assert(chunk_id < chunk_count(), "Chunk " + std::to_string(chunk_id) + " does not exist.");
+    const auto& slot = _slot(chunk_id);
+    chunk = slot.chunk.load();
+    file = slot.file;
+  }
+  if (!chunk || !can_write_chunk_file(*chunk)) {
+    return 0;
+  }
+
+  // The file is written without holding the lock, so that get_chunk is not blocked by the disk write. Only immutable
+  // chunks are written, so the file cannot become outdated meanwhile.
+  const auto writes_file = file.empty();
+  if (writes_file) {
+    const auto directory = _eviction_directory.empty() ? std::filesystem::temp_directory_path() : _eviction_directory;
+    file = directory / ("opossum_" + std::to_string(getpid()) + "_" + std::to_string(_next_file_id++) + ".chunk");
+    write_chunk_file(*chunk, file);
+  }
+
+  const auto lock = std::unique_lock{_chunks_mutex};
+  auto& slot = _slot(chunk_id);
+  // Another thread may have evicted or replaced the chunk, or written its file, in the meantime.
+  const auto is_current_chunk = slot.chunk.load() == chunk;
+  if (writes_file) {
+    if (is_current_chunk && slot.file.empty()) {
+      slot.file = file;
+    } else {
+      auto error_code = std::error_code{};
+      std::filesystem::remove(file, error_code);
+    }
+  }
+  if (!is_current_chunk) {
+    return 0;
+  }
+
+  slot.size = chunk->size();
+  slot.evicted_chunk = chunk;
+  slot.chunk.store(nullptr);
+  // If operators still hold the chunk, its memory is only freed once they release it.
+  return chunk.use_count() == 1 ? chunk->estimate_memory_usage() : 0;
+}
+
+size_t Table::evict_cold_chunks(const size_t memory_limit) {
+  auto chunks = std::vector<std::pair<Table*, ChunkID>>{};
+  const auto chunk_count = this->chunk_count();
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    chunks.emplace_back(this, chunk_id);
+  }
+  return evict_least_recently_accessed_chunks(chunks, estimate_memory_usage(), memory_limit);
+}
+
+bool Table::is_chunk_evicted(const ChunkID chunk_id) const {
+  Assert(chunk_id < chunk_count(), "Chunk " + std::to_string(chunk_id) + " does not exist.");
+  return !_slot(chunk_id).chunk.load();
+}
+
+uint64_t Table::chunk_last_access(const ChunkID chunk_id) const {
+  Assert(chunk_id < chunk_count(), "Chunk " + std::to_string(chunk_id) + " does not exist.");
+  return _slot(chunk_id).last_access.load(std::memory_order_relaxed);
+}
+
+size_t evict_least_recently_accessed_chunks(const std::vector<std::pair<Table*, ChunkID>>& chunks, size_t memory_usage,
+                                            const size_t memory_limit) {
+  auto chunks_by_access = std::vector<std::tuple<uint64_t, Table*, ChunkID>>{};
+  for (const auto& [table, chunk_id] : chunks) {
+    if (!table->is_chunk_evicted(chunk_id)) {
+      chunks_by_access.emplace_back(table->chunk_last_access(chunk_id), table, chunk_id);
+    }
+  }
+  std::sort(chunks_by_access.begin(), chunks_by_access.end());
+
+  auto evicted_chunk_count = size_t{0};
+  for (const auto& [last_access, table, chunk_id] : chunks_by_access) {
+    if (memory_usage <= memory_limit) {
+      break;
+    }
+
+    // Chunks that are still referenced are evicted as well, but colder ones have to free the memory.
+    const auto freed_memory = table->evict_chunk(chunk_id);
+    memory_usage -= std::min(freed_memory, memory_usage);
+    evicted_chunk_count += table->is_chunk_evicted(chunk_id);
+  }
+  return evicted_chunk_count;
 }
-// GCOVR_EXCL_STOP
 
 }  // namespace opossum
@@ -1,19 +1,35 @@
 #pragma once
 
+#include <array>
+#include <atomic>
+#include <filesystem>
+#include <shared_mutex>
+#include <utility>
+#include <vector>
+
 #include "abstract_segment.hpp"
 #include "chunk.hpp"
+#include "query_memory_context.hpp"
 #include "type_cast.hpp"
 
 namespace opossum {
 
 class TableStatistics;
 
-// A table is partitioned horizontally into a number of chunks
+// A table is partitioned horizontally into a number of chunks.
+//
+// Tables support tiered storage: Dictionary-encoded chunks are immutable and can be evicted, i.e., written to a file
+// and dropped from memory. get_chunk transparently loads an evicted chunk back. The file is kept, so that evicting the
+// chunk again does not write it again, and removed together with the table.
 class Table : private Noncopyable {
  public:
   // Creates a table. The parameter specifies the maximum chunk size, i.e., partition size default is the maximum chunk
-  // size minus 1. A table always holds at least one chunk.
-  explicit Table(const ChunkOffset target_chunk_size = std::numeric_limits<ChunkOffset>::max() - 1);
+  // size minus 1. A table always holds at least one chunk. Operators pass the memory context of their query, which the
+  // table keeps alive (see QueryMemoryContext).
+  explicit Table(const ChunkOffset target_chunk_size = std::numeric_limits<ChunkOffset>::max() - 1,
+                 const std::shared_ptr<QueryMemoryContext>& memory_context = nullptr);
+
+  ~Table();
 
   // Returns the number of columns (cannot exceed ColumnID (uint16_t)).
   ColumnCount column_count() const;
@@ -25,7 +41,7 @@ class Table : private Noncopyable {
   // Returns the number of chunks (cannot exceed ChunkID (uint32_t)).
   ChunkID chunk_count() const;
 
-  // Returns the chunk with the given id.
+  // Returns the chunk with the given id. Evicted chunks are loaded back.
   std::shared_ptr<Chunk> get_chunk(const ChunkID chunk_id);
   std::shared_ptr<const Chunk> get_chunk(const ChunkID chunk_id) const;
 
@@ -48,6 +64,16 @@ class Table : private Noncopyable {
   // Return the target chunk size (cannot exceed ChunkOffset (uint32_t)).
   ChunkOffset target_chunk_size() const;
 
+  // Returns the memory context of the query that produced the table, or nullptr for base tables.
+  const std::shared_ptr<QueryMemoryContext>& memory_context() const;
+
+  // Returns the memory resource that the segments of the table are allocated from, i.e., the one of the memory context
+  // or the default resource.
+  std::pmr::memory_resource* memory_resource() const;
+
+  // Returns the calculated memory usage of all chunks. Tables referenced by ReferenceSegments are not included.
+  size_t estimate_memory_usage() const;
+
   // Adds column definition without creating the actual columns. This is helpful when, e.g., an operator first creates
   // the structure of the table and then adds chunk by chunk.
   void add_column_definition(const std::string& name, const std::string& type, const bool nullable);
@@ -63,15 +89,86 @@ class Table : private Noncopyable {
   // Creates a new chunk and appends it.
   void create_new_chunk();
 
+  // Adds a chunk to the table. If the first chunk is empty, it is replaced. This is used by operators that build their
+  // output chunk by chunk.
+  void emplace_chunk(const std::shared_ptr<Chunk> chunk);
+
+  // Replaces a chunk that is not evicted, e.g., to reuse a table that passes one chunk at a time between operators.
+  void replace_chunk(const ChunkID chunk_id, const std::shared_ptr<Chunk> chunk);
+
   // Compresses a ValueColumn into a DictionaryColumn.
   void compress_chunk(const ChunkID chunk_id);
 
+  // Sets the directory that evicted chunks are written to. Defaults to the system's temporary directory.
+  void set_eviction_directory(const std::filesystem::path& directory);
+
+  // Evicts a chunk. Returns the estimated memory that this freed, i.e., the memory usage of the chunk, or 0 if it is
+  // mutable, has indexes, or is already evicted. A chunk that operators still hold is evicted as well, but 0 is
+  // returned, as its memory is only freed once they release it.
+  size_t evict_chunk(const ChunkID chunk_id);
+
+  // Evicts the least recently accessed chunks until the estimated memory that they freed brings the memory usage of the
+  // table down to memory_limit or no more chunks can be evicted. Returns the number of evicted chunks.
+  size_t evict_cold_chunks(const size_t memory_limit);
+
+  bool is_chunk_evicted(const ChunkID chunk_id) const;
+
+  // Returns the time of the last get_chunk call for a chunk in nanoseconds of std::chrono::steady_clock, which all
+  // tables share, so that the StorageManager can compare chunks of different tables. Chunks that were never accessed
+  // return 0.
+  uint64_t chunk_last_access(const ChunkID chunk_id) const;
+
  protected:
-  std::vector<std::shared_ptr<Chunk>> _chunks;
+  // A chunk and its tiered storage state. Slots are never moved, so that get_chunk can access resident chunks without
+  // taking _chunks_mutex.
+  struct ChunkSlot {
+    // nullptr while the chunk is evicted. Changed only while holding _chunks_mutex exclusively.
+    std::atomic<std::shared_ptr<Chunk>> chunk;
+    std::atomic<uint64_t> last_access{0};
+    // The following members are guarded by _chunks_mutex. The file is empty until the chunk is evicted for the first
+    // time.
+    std::filesystem::path file;
+    // Row count of the chunk while it is evicted, so that row_count() does not load it.
+    ChunkOffset size{0};
+    // Operators may still hold the chunk when it is evicted. If so, it is reused instead of read from the file.
+    std::weak_ptr<Chunk> evicted_chunk;
+  };
+
+  // Returns the slot of a chunk. Slot i is stored in block std::bit_width(i + 1) - 1, which holds 2^block slots, so
+  // that appending chunks never moves existing slots.
+  ChunkSlot& _slot(const ChunkID chunk_id) const;
+
+  // Returns the chunk, loading it if it is evicted, and records the access.
+  std::shared_ptr<Chunk> _load_chunk(const ChunkID chunk_id) const;
+
+  // Appends a chunk. The caller must hold a unique lock of _chunks_mutex.
+  void _append_chunk(const std::shared_ptr<Chunk>& chunk);
+
+  // Replaces the chunk of a slot and resets its tiered storage state. The caller must hold a unique lock of
+  // _chunks_mutex.
+  static void _reset_slot(ChunkSlot& slot, const std::shared_ptr<Chunk>& chunk);
+
+  inline static std::atomic<uint64_t> _next_file_id{0};
+
+  // Guards appending chunks, replacing them by nullptr on eviction, and loading them back. get_chunk does not take it
+  // for resident chunks.
+  mutable std::shared_mutex _chunks_mutex;
+  // A block is allocated before the first of its chunks is published through _chunk_count and freed with the table.
+  std::array<std::unique_ptr<ChunkSlot[]>, 32> _slot_blocks;
+  std::atomic<ChunkID::base_type> _chunk_count{0};
+  std::filesystem::path _eviction_directory;
+  std::shared_ptr<QueryMemoryContext> _memory_context;
   std::vector<std::string> _column_names;
   std::vector<std::string> _column_types;
   std::vector<bool> _column_nullable;
   ChunkOffset _target_chunk_size;
 };
 
+// Evicts the least recently accessed of the given chunks (see Table::evict_chunk) until the memory that they freed
+// brings memory_usage down to memory_limit or no more chunks can be evicted. Chunks that are already evicted are
+// skipped. Returns the number of evicted chunks. Used by Table and StorageManager to evict the chunks of one or all
+// tables.
+size_t evict_least_recently_accessed_chunks(const std::vector<std::pair<Table*, ChunkID>>& chunks, size_t memory_usage,
+                                            const size_t memory_limit);
+
 }  // namespace opossum
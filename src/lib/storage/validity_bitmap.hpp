@@ -0,0 +1,69 @@
+#pragma once
+
+#include <bit>
+#include <cstdint>
+#include <memory_resource>
+#include <vector>
+
+#include "types.hpp"
+
+namespace opossum {
+
+// The NULL information of a nullable segment as a bitmap of 64-bit words: bit (i % 64) of word (i / 64) is set if row
+// i is not NULL, and the unused bits of the last word are 0. Kernels can evaluate a predicate for 64 rows at once into
+// a mask of the same layout and AND it with the corresponding word to drop the NULL rows.
+class ValidityBitmap {
+ public:
+  static constexpr auto ROWS_PER_WORD = ChunkOffset{64};
+
+  explicit ValidityBitmap(std::pmr::memory_resource* memory_resource = std::pmr::get_default_resource())
+      : _words(memory_resource) {}
+
+  // Creates the bitmap for NULL flags that are true for NULL rows.
+  explicit ValidityBitmap(const std::vector<bool>& null_values,
+                          std::pmr::memory_resource* memory_resource = std::pmr::get_default_resource())
+      : _words(memory_resource) {
+    _words.reserve((null_values.size() + ROWS_PER_WORD - 1) / ROWS_PER_WORD);
+    for (const auto is_null : null_values) {
+      append(is_null);
+    }
+  }
+
+  bool is_null(const ChunkOffset chunk_offset) const {
+    return !((_words[chunk_offset / ROWS_PER_WORD] >> (chunk_offset % ROWS_PER_WORD)) & 1u);
+  }
+
+  void append(const bool is_null) {
+    if (_size % ROWS_PER_WORD == 0) {
+      _words.push_back(0);
+    }
+    _words.back() |= uint64_t{!is_null} << (_size % ROWS_PER_WORD);
+    ++_size;
+  }
+
+  ChunkOffset size() const {
+    return _size;
+  }
+
+  size_t null_count() const {
+    auto valid_count = size_t{0};
+    for (const auto word : _words) {
+      valid_count += std::popcount(word);
+    }
+    return _size - valid_count;
+  }
+
+  const std::pmr::vector<uint64_t>& words() const {
+    return _words;
+  }
+
+  size_t memory_usage() const {
+    return _words.size() * sizeof(uint64_t);
+  }
+
+ protected:
+  std::pmr::vector<uint64_t> _words;
+  ChunkOffset _size{0};
+};
+
+}  // namespace opossum
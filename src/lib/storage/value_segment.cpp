@@ -3,10 +3,37 @@
 #include "type_cast.hpp"
 #include "utils/assert.hpp"
 
+namespace {
+
+using namespace opossum;  // NOLINT(build/namespaces)
+
+// Takes over materialized values. Strings are copied into a CompactStringVector that uses the same memory resource.
+template <typename T>
+typename ValueSegment<T>::Values adopt_values(std::pmr::vector<T>&& values) {
+  if constexpr (std::is_same_v<T, std::string>) {
+    return CompactStringVector{values, values.get_allocator().resource()};
+  } else {
+    return std::move(values);
+  }
+}
+
+}  // namespace
+
 namespace opossum {
 
 template <typename T>
-ValueSegment<T>::ValueSegment(bool nullable) : _values{}, _is_null_values{}, _segment_is_nullable(nullable) {}
+ValueSegment<T>::ValueSegment(bool nullable, std::pmr::memory_resource* memory_resource)
+    : _values{memory_resource}, _validity{memory_resource}, _segment_is_nullable(nullable) {}
+
+template <typename T>
+ValueSegment<T>::ValueSegment(std::pmr::vector<T>&& values)
+    : _values{adopt_values(std::move(values))}, _validity{memory_resource()}, _segment_is_nullable(false) {}
+
+template <typename T>
+ValueSegment<T>::ValueSegment(std::pmr::vector<T>&& values, const std::vector<bool>& null_values)
+    : _values{adopt_values(std::move(values))}, _validity{null_values, memory_resource()}, _segment_is_nullable(true) {
+  Assert(_values.size() == _validity.size(), "Number of values and NULL flags does not match.");
+}
 
 template <typename T>
 AllTypeVariant ValueSegment<T>::operator[](const ChunkOffset chunk_offset) const {
@@ -18,13 +45,14 @@ AllTypeVariant ValueSegment<T>::operator[](const ChunkOffset chunk_offset) const
 
 template <typename T>
 bool ValueSegment<T>::is_null(const ChunkOffset chunk_offset) const {
-  return is_nullable() && _is_null_values.at(chunk_offset);
+  DebugAssert(chunk_offset < size(), "Chunk offset out of range.");
+  return is_nullable() && _validity.is_null(chunk_offset);
 }
 
 template <typename T>
 T ValueSegment<T>::get(const ChunkOffset chunk_offset) const {
   Assert(!is_null(chunk_offset), "Chunk is null, can't return value.");
-  return _values[chunk_offset];
+  return T{_values[chunk_offset]};
 }
 
 template <typename T>
@@ -39,12 +67,14 @@ template <typename T>
 void ValueSegment<T>::append(const AllTypeVariant& value) {
   if (variant_is_null(value)) {
     Assert(_segment_is_nullable, "Tried to insert NULL value in not nullable segment!");
-    _values.push_back(type_cast<T>(0));
-    _is_null_values.push_back(true);
+    _values.push_back(T{});
+    _validity.append(true);
   } else {
     try {
       _values.push_back(type_cast<T>(value));
-      _is_null_values.push_back(false);
+      if (_segment_is_nullable) {
+        _validity.append(false);
+      }
     } catch (...) {
       throw std::logic_error{"Wrong argument type in append"};
     }
@@ -57,7 +87,7 @@ ChunkOffset ValueSegment<T>::size() const {
 }
 
 template <typename T>
-const std::vector<T>& ValueSegment<T>::values() const {
+const typename ValueSegment<T>::Values& ValueSegment<T>::values() const {
   return _values;
 }
 
@@ -67,14 +97,26 @@ bool ValueSegment<T>::is_nullable() const {
 }
 
 template <typename T>
-const std::vector<bool>& ValueSegment<T>::null_values() const {
-  Assert(is_nullable(), "NULL values are only available if the segment is nullable.");
-  return _is_null_values;
+const ValidityBitmap& ValueSegment<T>::validity() const {
+  Assert(is_nullable(), "The validity bitmap is only available if the segment is nullable.");
+  return _validity;
+}
+
+template <typename T>
+std::pmr::memory_resource* ValueSegment<T>::memory_resource() const {
+  return _values.get_allocator().resource();
 }
 
 template <typename T>
 size_t ValueSegment<T>::estimate_memory_usage() const {
-  return _values.size() * sizeof(T);
+  // The CompactStringVector accounts for both the string headers and the characters of long strings.
+  auto values_size = size_t{0};
+  if constexpr (std::is_same_v<T, std::string>) {
+    values_size = _values.memory_usage();
+  } else {
+    values_size = _values.size() * sizeof(T);
+  }
+  return values_size + _validity.memory_usage();
 }
 
 // Macro to instantiate the following classes:
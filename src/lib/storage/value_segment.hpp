@@ -1,14 +1,31 @@
 #pragma once
 
+#include <memory_resource>
+#include <type_traits>
+
 #include "abstract_segment.hpp"
+#include "compact_string_vector.hpp"
+#include "validity_bitmap.hpp"
 
 namespace opossum {
 
-// ValueSegment is a segment type that stores all its values in a vector.
+// ValueSegment is a segment type that stores all its values in a vector. Strings are stored in a CompactStringVector,
+// whose operator[] returns std::string_views. Values and NULL flags are allocated from a std::pmr::memory_resource, so
+// that, e.g., the intermediate results of a query can be placed in an arena and released at once.
 template <typename T>
 class ValueSegment : public AbstractSegment {
  public:
-  explicit ValueSegment(bool nullable = false);
+  using Values = std::conditional_t<std::is_same_v<T, std::string>, CompactStringVector, std::pmr::vector<T>>;
+
+  explicit ValueSegment(bool nullable = false,
+                        std::pmr::memory_resource* memory_resource = std::pmr::get_default_resource());
+
+  // Creates a non-nullable segment from already materialized values, e.g., the result of an operator. The segment
+  // takes over the values and allocates from their memory resource.
+  explicit ValueSegment(std::pmr::vector<T>&& values);
+
+  // Creates a nullable segment from already materialized values and their NULL flags.
+  ValueSegment(std::pmr::vector<T>&& values, const std::vector<bool>& null_values);
 
   // Returns the value at a certain position. If you want to write efficient operators, back off!
   //当final关键字在方法声明的末尾时，表示该方法不能在任何派生类中被重写。
@@ -35,22 +52,26 @@ class ValueSegment : public AbstractSegment {
   // Returns all values. This is the preferred method to check a value at a certain index. Usually you need to access
   // more than a single value anyway.
   // e.g. const auto& values = value_segment.values(); and then: values[i]; in your loop.
-  const std::vector<T>& values() const;
+  const Values& values() const;
 
   // Returns whether segment supports NULL values.
   bool is_nullable() const;
 
-  // Returns NULL value vector that indicates whether a value is NULL with true at position i. Throw an exception if
-  // is_nullable() returns false. This is the preferred method to check for a NULL value at a certain index. Usually
-  // you need to access more than a single value anyway.
-  const std::vector<bool>& null_values() const;
+  // Returns the validity bitmap, whose bit i is cleared if the value at position i is NULL. Throws an exception if
+  // is_nullable() returns false, since non-nullable segments do not store one. This is the preferred method to check
+  // for NULL values, either row by row with is_null() or 64 rows at a time with words().
+  const ValidityBitmap& validity() const;
+
+  // Returns the memory resource that values and NULL flags are allocated from.
+  std::pmr::memory_resource* memory_resource() const;
 
-  // Returns the calculated memory usage.
+  // Returns the calculated memory usage of the values and the validity bitmap.
   size_t estimate_memory_usage() const final;
 
  protected:
-  std::vector<T> _values;
-  std::vector<bool> _is_null_values;
+  Values _values;
+  // Only maintained if the segment is nullable.
+  ValidityBitmap _validity;
   bool _segment_is_nullable;
 };
 
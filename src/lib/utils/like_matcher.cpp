@@ -0,0 +1,109 @@
+#include "like_matcher.hpp"
+
+#include <limits>
+
+namespace opossum {
+
+LikeMatcher::LikeMatcher(const std::string& pattern) : _pattern(pattern), _pattern_type(PatternType::General) {
+  if (pattern.find('_') != std::string::npos) {
+    return;
+  }
+
+  const auto literal_begin = pattern.find_first_not_of('%');
+  if (literal_begin == std::string::npos) {
+    // The pattern is empty or consists of % only.
+    _pattern_type = pattern.empty() ? PatternType::Exact : PatternType::Prefix;
+    return;
+  }
+
+  const auto literal_end = pattern.find_last_not_of('%') + 1;
+  _literal = pattern.substr(literal_begin, literal_end - literal_begin);
+  if (_literal.find('%') != std::string::npos) {
+    return;
+  }
+
+  const auto has_leading_wildcard = literal_begin > 0;
+  const auto has_trailing_wildcard = literal_end < pattern.size();
+  if (has_leading_wildcard && has_trailing_wildcard) {
+    _pattern_type = PatternType::Contains;
+  } else if (has_leading_wildcard) {
+    _pattern_type = PatternType::Suffix;
+  } else if (has_trailing_wildcard) {
+    _pattern_type = PatternType::Prefix;
+  } else {
+    _pattern_type = PatternType::Exact;
+  }
+}
+
+bool LikeMatcher::matches(const std::string_view value) const {
+  switch (_pattern_type) {
+    case PatternType::Exact:
+      return value == _literal;
+    case PatternType::Prefix:
+      return value.compare(0, _literal.size(), _literal) == 0;
+    case PatternType::Suffix:
+      return value.size() >= _literal.size() &&
+             value.compare(value.size() - _literal.size(), _literal.size(), _literal) == 0;
+    case PatternType::Contains:
+      return value.find(_literal) != std::string::npos;
+    case PatternType::General:
+      return _matches_general(value);
+  }
+  return false;
+}
+
+std::optional<std::string> LikeMatcher::prefix() const {
+  if (_pattern_type != PatternType::Prefix) {
+    return std::nullopt;
+  }
+  return _literal;
+}
+
+bool LikeMatcher::_matches_general(const std::string_view value) const {
+  // Greedy matching that backtracks to the most recent %. This takes O(|pattern| * |value|) in the worst case, but
+  // does not need the exponential backtracking of a naive recursive matcher.
+  const auto pattern_size = _pattern.size();
+  const auto value_size = value.size();
+  auto pattern_index = size_t{0};
+  auto value_index = size_t{0};
+  auto wildcard_index = std::string::npos;
+  auto wildcard_value_index = size_t{0};
+
+  while (value_index < value_size) {
+    const auto pattern_char = pattern_index < pattern_size ? _pattern[pattern_index] : '\0';
+    if (pattern_index < pattern_size && pattern_char == '%') {
+      wildcard_index = pattern_index++;
+      wildcard_value_index = value_index;
+    } else if (pattern_index < pattern_size && (pattern_char == '_' || pattern_char == value[value_index])) {
+      ++pattern_index;
+      ++value_index;
+    } else if (wildcard_index != std::string::npos) {
+      // Let the last % consume one more character and retry.
+      pattern_index = wildcard_index + 1;
+      value_index = ++wildcard_value_index;
+    } else {
+      return false;
+    }
+  }
+
+  while (pattern_index < pattern_size && _pattern[pattern_index] == '%') {
+    ++pattern_index;
+  }
+  return pattern_index == pattern_size;
+}
+
+std::optional<std::string> prefix_upper_bound(const std::string& prefix) {
+  auto upper_bound = prefix;
+  while (!upper_bound.empty() &&
+         static_cast<unsigned char>(upper_bound.back()) == std::numeric_limits<unsigned char>::max()) {
+    upper_bound.pop_back();
+  }
+  if (upper_bound.empty()) {
+    return std::nullopt;
+  }
+
+  upper_bound.back() = static_cast<char>(static_cast<unsigned char>(upper_bound.back()) + 1);
+  return upper_bound;
+}
+
+}  // namespace opossum
@@ -0,0 +1,38 @@
+#pragma once
+
+#include <optional>
+#include <string>
+#include <string_view>
+
+namespace opossum {
+
+// Matches strings against SQL LIKE patterns, where % matches any sequence of characters and _ matches exactly one
+// character. There is no escape character. Patterns of the forms `abc`, `abc%`, `%abc`, and `%abc%` are detected when
+// the matcher is created and are evaluated with plain string comparisons.
+class LikeMatcher {
+ public:
+  explicit LikeMatcher(const std::string& pattern);
+
+  bool matches(const std::string_view value) const;
+
+  // Returns the fixed prefix if the pattern has the form `abc%`. The strings matching such a pattern form a contiguous
+  // range in sorted order, so sorted dictionaries can be searched with two binary searches.
+  std::optional<std::string> prefix() const;
+
+ protected:
+  enum class PatternType { Exact, Prefix, Suffix, Contains, General };
+
+  bool _matches_general(const std::string_view value) const;
+
+  const std::string _pattern;
+  PatternType _pattern_type;
+
+  // The pattern without its leading and trailing %, only used for non-general patterns.
+  std::string _literal;
+};
+
+// Returns the smallest string that is larger than all strings starting with `prefix`, or std::nullopt if there is none
+// (e.g., for an empty prefix).
+std::optional<std::string> prefix_upper_bound(const std::string& prefix);
+
+}  // namespace opossum
@@ -0,0 +1,145 @@
+#include "performance_counters.hpp"
+
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <time.h>
+#include <unistd.h>
+
+#include <array>
+
+namespace {
+
+using namespace opossum;  // NOLINT(build/namespaces)
+
+constexpr auto EVENTS = std::array<uint64_t, 4>{PERF_COUNT_HW_CPU_CYCLES, PERF_COUNT_HW_INSTRUCTIONS,
+                                                PERF_COUNT_HW_CACHE_MISSES, PERF_COUNT_HW_BRANCH_MISSES};
+
+// The counters of one thread. They form a group, so that the kernel schedules them on the PMU together and all counts
+// refer to the same time.
+class ThreadCounters {
+ public:
+  ThreadCounters() {
+    _file_descriptors.fill(-1);
+    for (auto index = size_t{0}; index < EVENTS.size(); ++index) {
+      auto attributes = perf_event_attr{};
+      attributes.size = sizeof(perf_event_attr);
+      attributes.type = PERF_TYPE_HARDWARE;
+      attributes.config = EVENTS[index];
+      // The group leader is enabled once all counters are open, which starts the whole group.
+      attributes.disabled = index == 0;
+      attributes.exclude_kernel = 1;
+      attributes.exclude_hv = 1;
+      attributes.read_format = PERF_FORMAT_GROUP | PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+
+      const auto group_file_descriptor = index == 0 ? -1 : _file_descriptors[0];
+      const auto file_descriptor =
+          static_cast<int>(syscall(SYS_perf_event_open, &attributes, 0, -1, group_file_descriptor, 0));
+      if (file_descriptor == -1) {
+        _close();
+        return;
+      }
+      _file_descriptors[index] = file_descriptor;
+    }
+
+    if (ioctl(_file_descriptors[0], PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP) == -1) {
+      _close();
+    }
+  }
+
+  ~ThreadCounters() {
+    _close();
+  }
+
+  ThreadCounters(const ThreadCounters&) = delete;
+  ThreadCounters& operator=(const ThreadCounters&) = delete;
+
+  std::optional<PerformanceCounterValues> read() const {
+    if (_file_descriptors[0] == -1) {
+      return std::nullopt;
+    }
+
+    // With PERF_FORMAT_GROUP, the kernel reports the number of counters, the times the group was enabled and running,
+    // and then the counts in the order in which the counters were opened.
+    auto data = std::array<uint64_t, 3 + EVENTS.size()>{};
+    if (::read(_file_descriptors[0], data.data(), sizeof(data)) != static_cast<ssize_t>(sizeof(data))) {
+      return std::nullopt;
+    }
+
+    const auto time_enabled = data[1];
+    const auto time_running = data[2];
+    const auto scale = time_running > 0 && time_running < time_enabled
+                           ? static_cast<double>(time_enabled) / static_cast<double>(time_running)
+                           : 1.0;
+    const auto scaled = [&](const size_t index) {
+      return static_cast<uint64_t>(static_cast<double>(data[3 + index]) * scale);
+    };
+    return PerformanceCounterValues{scaled(0), scaled(1), scaled(2), scaled(3)};
+  }
+
+ protected:
+  void _close() {
+    for (auto& file_descriptor : _file_descriptors) {
+      if (file_descriptor != -1) {
+        close(file_descriptor);
+        file_descriptor = -1;
+      }
+    }
+  }
+
+  std::array<int, EVENTS.size()> _file_descriptors{};
+};
+
+double per_kilo_instruction(const uint64_t count, const uint64_t instructions) {
+  return instructions == 0 ? 0.0 : 1'000.0 * static_cast<double>(count) / static_cast<double>(instructions);
+}
+
+}  // namespace
+
+namespace opossum {
+
+double PerformanceCounterValues::instructions_per_cycle() const {
+  return cycles == 0 ? 0.0 : static_cast<double>(instructions) / static_cast<double>(cycles);
+}
+
+double PerformanceCounterValues::cache_misses_per_kilo_instruction() const {
+  return per_kilo_instruction(cache_misses, instructions);
+}
+
+double PerformanceCounterValues::branch_misses_per_kilo_instruction() const {
+  return per_kilo_instruction(branch_misses, instructions);
+}
+
+PerformanceCounterValues PerformanceCounterValues::operator-(const PerformanceCounterValues& other) const {
+  // Extrapolated counts are not strictly monotonic, so differences are clamped at zero.
+  const auto difference = [](const uint64_t minuend, const uint64_t subtrahend) {
+    return minuend > subtrahend ? minuend - subtrahend : uint64_t{0};
+  };
+  return {difference(cycles, other.cycles), difference(instructions, other.instructions),
+          difference(cache_misses, other.cache_misses), difference(branch_misses, other.branch_misses)};
+}
+
+PerformanceCounterValues& PerformanceCounterValues::operator+=(const PerformanceCounterValues& other) {
+  cycles += other.cycles;
+  instructions += other.instructions;
+  cache_misses += other.cache_misses;
+  branch_misses += other.branch_misses;
+  return *this;
+}
+
+std::optional<PerformanceCounterValues> PerformanceCounters::read() {
+  thread_local const auto thread_counters = ThreadCounters{};
+  return thread_counters.read();
+}
+
+bool PerformanceCounters::available() {
+  return read().has_value();
+}
+
+std::chrono::nanoseconds process_cpu_time() {
+  auto time = timespec{};
+  clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &time);
+  return std::chrono::seconds{time.tv_sec} + std::chrono::nanoseconds{time.tv_nsec};
+}
+
+}  // namespace opossum
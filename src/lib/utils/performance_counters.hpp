@@ -0,0 +1,48 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <optional>
+
+namespace opossum {
+
+// Hardware events counted by the PMU of the CPU.
+struct PerformanceCounterValues {
+  uint64_t cycles = 0;
+  uint64_t instructions = 0;
+  // Last-level cache misses.
+  uint64_t cache_misses = 0;
+  uint64_t branch_misses = 0;
+
+  // Returns instructions per cycle, or 0 if no cycles were counted.
+  double instructions_per_cycle() const;
+
+  // Returns the misses per thousand instructions (MPKI), or 0 if no instructions were counted.
+  double cache_misses_per_kilo_instruction() const;
+  double branch_misses_per_kilo_instruction() const;
+
+  PerformanceCounterValues operator-(const PerformanceCounterValues& other) const;
+  PerformanceCounterValues& operator+=(const PerformanceCounterValues& other);
+};
+
+// Counts cycles, instructions, cache misses, and branch misses of the calling thread with perf_event_open. Each
+// thread opens its counters on the first read and keeps them running until it exits, so that a measurement is the
+// difference of two reads and measurements can be nested (e.g., an operator within a benchmark case). Work that other
+// threads do on behalf of the calling thread is not counted.
+//
+// Counting is not available in every environment, e.g., in containers without the perf_event_open syscall, in VMs
+// without a virtual PMU, or if /proc/sys/kernel/perf_event_paranoid is above 2. Then, read returns std::nullopt.
+class PerformanceCounters {
+ public:
+  // Returns the events of the calling thread since its counters were opened, or std::nullopt if counting is not
+  // available. If the kernel had to multiplex the counters, the counts are extrapolated to the full time.
+  static std::optional<PerformanceCounterValues> read();
+
+  // Returns whether counting is available for the calling thread.
+  static bool available();
+};
+
+// Returns the CPU time that all threads of the process have consumed so far.
+std::chrono::nanoseconds process_cpu_time();
+
+}  // namespace opossum
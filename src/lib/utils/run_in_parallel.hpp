@@ -0,0 +1,59 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "tracer.hpp"
+
+namespace opossum {
+
+// Calls task(0), task(1), ..., task(task_count - 1) on up to std::thread::hardware_concurrency() threads. Tasks are
+// handed out one at a time, so tasks of different sizes are balanced across the threads. If tasks throw, the first
+// exception is rethrown once all threads have finished.
+//
+// If the Tracer is enabled, the call, each worker thread, and each task are recorded, the tasks with the given name.
+// Gaps between the tasks of a worker show its idle time.
+template <typename Task>
+void run_in_parallel(const size_t task_count, const Task& task, const char* task_name = "Task") {
+  const auto trace_scope = TraceScope{"run_in_parallel", "scheduler", "tasks", static_cast<int64_t>(task_count)};
+  const auto hardware_threads = std::max(size_t{1}, static_cast<size_t>(std::thread::hardware_concurrency()));
+  const auto thread_count = std::min(task_count, hardware_threads);
+
+  auto next_task = std::atomic<size_t>{0};
+  auto exception = std::exception_ptr{};
+  auto exception_mutex = std::mutex{};
+
+  const auto work = [&]() {
+    const auto worker_trace_scope = TraceScope{"Worker", "scheduler"};
+    for (auto task_id = next_task++; task_id < task_count; task_id = next_task++) {
+      try {
+        const auto task_trace_scope = TraceScope{task_name, "task", "task_id", static_cast<int64_t>(task_id)};
+        task(task_id);
+      } catch (...) {
+        const auto lock = std::lock_guard<std::mutex>{exception_mutex};
+        if (!exception) {
+          exception = std::current_exception();
+        }
+      }
+    }
+  };
+
+  auto threads = std::vector<std::thread>{};
+  threads.reserve(thread_count);
+  for (auto thread_id = size_t{0}; thread_id < thread_count; ++thread_id) {
+    threads.emplace_back(work);
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  if (exception) {
+    std::rethrow_exception(exception);
+  }
+}
+
+}  // namespace opossum
@@ -0,0 +1,29 @@
+#include "scan_type_utils.hpp"
+
+namespace opossum {
+
+std::string scan_type_to_string(const ScanType scan_type) {
+  switch (scan_type) {
+    case ScanType::OpEquals:
+      return "=";
+    case ScanType::OpNotEquals:
+      return "!=";
+    case ScanType::OpLessThan:
+      return "<";
+    case ScanType::OpLessThanEquals:
+      return "<=";
+    case ScanType::OpGreaterThan:
+      return ">";
+    case ScanType::OpGreaterThanEquals:
+      return ">=";
+    case ScanType::OpBetween:
+      return "BETWEEN";
+    case ScanType::OpIn:
+      return "IN";
+    case ScanType::OpLike:
+      return "LIKE";
+  }
+  Fail("Unsupported ScanType.");
+}
+
+}  // namespace opossum
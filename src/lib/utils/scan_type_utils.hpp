@@ -0,0 +1,40 @@
+#pragma once
+
+#include <functional>
+#include <string>
+
+#include "types.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+// Calls `functor` with the comparison function object (e.g., std::less<>) that corresponds to the given ScanType. This
+// lets kernels be instantiated once per ScanType instead of switching over the ScanType for every row. ScanTypes that
+// are not a comparison with a single value (OpBetween, OpIn, OpLike) are not supported.
+template <typename Functor>
+void with_comparator(const ScanType scan_type, const Functor& functor) {
+  switch (scan_type) {
+    case ScanType::OpEquals:
+      return functor(std::equal_to<>{});
+    case ScanType::OpNotEquals:
+      return functor(std::not_equal_to<>{});
+    case ScanType::OpLessThan:
+      return functor(std::less<>{});
+    case ScanType::OpLessThanEquals:
+      return functor(std::less_equal<>{});
+    case ScanType::OpGreaterThan:
+      return functor(std::greater<>{});
+    case ScanType::OpGreaterThanEquals:
+      return functor(std::greater_equal<>{});
+    case ScanType::OpBetween:
+    case ScanType::OpIn:
+    case ScanType::OpLike:
+      break;
+  }
+  Fail("Unsupported ScanType.");
+}
+
+// Returns the SQL representation of a ScanType, e.g., "<=".
+std::string scan_type_to_string(const ScanType scan_type);
+
+}  // namespace opossum
@@ -0,0 +1,390 @@
+#include "tpch_table_generator.hpp"
+
+#include <chrono>
+#include <cmath>
+#include <random>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include "resolve_type.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+#include "storage/value_segment.hpp"
+#include "utils/assert.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT(build/namespaces)
+
+// Collects the rows of a table column by column and adds them to the table as a chunk of ValueSegments whenever
+// chunk_size rows are complete. This avoids the AllTypeVariant per value of Table::append.
+template <typename... DataTypes>
+class TableBuilder {
+ public:
+  TableBuilder(const std::vector<std::string>& column_names, const ChunkOffset chunk_size, const bool compress)
+      : _table(std::make_shared<Table>(chunk_size)), _chunk_size(chunk_size), _compress(compress) {
+    const auto column_types = std::vector<std::string>{data_type_name<DataTypes>()...};
+    Assert(column_names.size() == column_types.size(), "Number of column names does not match the data types.");
+    for (auto column_id = size_t{0}; column_id < column_names.size(); ++column_id) {
+      _table->add_column_definition(column_names[column_id], column_types[column_id], false);
+    }
+    _reserve();
+  }
+
+  void append_row(const DataTypes&... values) {
+    _append_row(std::index_sequence_for<DataTypes...>{}, values...);
+    if (std::get<0>(_columns).size() == _chunk_size) {
+      _flush();
+    }
+  }
+
+  std::shared_ptr<Table> finish() {
+    if (!std::get<0>(_columns).empty()) {
+      _flush();
+    }
+    return _table;
+  }
+
+ protected:
+  template <size_t... ColumnIDs>
+  void _append_row(std::index_sequence<ColumnIDs...> /*column_ids*/, const DataTypes&... values) {
+    (std::get<ColumnIDs>(_columns).push_back(values), ...);
+  }
+
+  void _reserve() {
+    std::apply([&](auto&... columns) { (columns.reserve(_chunk_size), ...); }, _columns);
+  }
+
+  void _flush() {
+    const auto chunk = std::make_shared<Chunk>();
+    std::apply(
+        [&](auto&... columns) {
+          (chunk->add_segment(std::make_shared<ValueSegment<typename std::decay_t<decltype(columns)>::value_type>>(
+               std::move(columns))),
+           ...);
+        },
+        _columns);
+    _table->emplace_chunk(chunk);
+    if (_compress) {
+      _table->compress_chunk(ChunkID{_table->chunk_count() - 1});
+    }
+
+    _columns = {};
+    _reserve();
+  }
+
+  const std::shared_ptr<Table> _table;
+  const ChunkOffset _chunk_size;
+  const bool _compress;
+  std::tuple<std::pmr::vector<DataTypes>...> _columns;
+};
+
+const auto REGION_NAMES = std::vector<std::string>{"AFRICA", "AMERICA", "ASIA", "EUROPE", "MIDDLE EAST"};
+
+const auto NATIONS = std::vector<std::pair<std::string, int32_t>>{
+    {"ALGERIA", 0},      {"ARGENTINA", 1},     {"BRAZIL", 1},        {"CANADA", 1},  {"EGYPT", 4},
+    {"ETHIOPIA", 0},     {"FRANCE", 3},        {"GERMANY", 3},       {"INDIA", 2},   {"INDONESIA", 2},
+    {"IRAN", 4},         {"IRAQ", 4},          {"JAPAN", 2},         {"JORDAN", 4},  {"KENYA", 0},
+    {"MOROCCO", 0},      {"MOZAMBIQUE", 0},    {"PERU", 1},          {"CHINA", 2},   {"ROMANIA", 3},
+    {"SAUDI ARABIA", 4}, {"VIETNAM", 2},       {"RUSSIA", 3},        {"UNITED KINGDOM", 3}, {"UNITED STATES", 1}};
+
+const auto COLORS = std::vector<std::string>{
+    "almond",    "antique",   "aquamarine", "azure",    "beige",     "bisque",    "black",    "blanched", "blue",
+    "blush",     "brown",     "burlywood",  "burnished", "chartreuse", "chiffon", "chocolate", "coral",   "cornflower",
+    "cornsilk",  "cream",     "cyan",       "dark",     "deep",      "dim",       "dodger",   "drab",     "firebrick",
+    "floral",    "forest",    "frosted",    "gainsboro", "ghost",    "goldenrod", "green",    "grey",     "honeydew",
+    "hot",       "indian",    "ivory",      "khaki",    "lace",      "lavender",  "lawn",     "lemon",    "light",
+    "lime",      "linen",     "magenta",    "maroon",   "medium",    "metallic",  "midnight", "mint",     "misty",
+    "moccasin",  "navajo",    "navy",       "olive",    "orange",    "orchid",    "pale",     "papaya",   "peach",
+    "peru",      "pink",      "plum",       "powder",   "puff",      "purple",    "red",      "rose",     "rosy",
+    "royal",     "saddle",    "salmon",     "sandy",    "seashell",  "sienna",    "sky",      "slate",    "smoke",
+    "snow",      "spring",    "steel",      "tan",      "thistle",   "tomato",    "turquoise", "violet",  "wheat",
+    "white",     "yellow"};
+
+const auto TYPE_SIZES = std::vector<std::string>{"STANDARD", "SMALL", "MEDIUM", "LARGE", "ECONOMY", "PROMO"};
+const auto TYPE_FINISHES = std::vector<std::string>{"ANODIZED", "BURNISHED", "PLATED", "POLISHED", "BRUSHED"};
+const auto TYPE_MATERIALS = std::vector<std::string>{"TIN", "NICKEL", "BRASS", "STEEL", "COPPER"};
+const auto CONTAINER_SIZES = std::vector<std::string>{"SM", "LG", "MED", "JUMBO", "WRAP"};
+const auto CONTAINER_TYPES = std::vector<std::string>{"CASE", "BOX", "BAG", "JAR", "PKG", "PACK", "CAN", "DRUM"};
+const auto MARKET_SEGMENTS = std::vector<std::string>{"AUTOMOBILE", "BUILDING", "FURNITURE", "MACHINERY", "HOUSEHOLD"};
+const auto ORDER_PRIORITIES = std::vector<std::string>{"1-URGENT", "2-HIGH", "3-MEDIUM", "4-NOT SPECIFIED", "5-LOW"};
+const auto SHIP_INSTRUCTIONS = std::vector<std::string>{"DELIVER IN PERSON", "COLLECT COD", "NONE", "TAKE BACK RETURN"};
+const auto SHIP_MODES = std::vector<std::string>{"REG AIR", "AIR", "RAIL", "SHIP", "TRUCK", "MAIL", "FOB"};
+
+const auto TEXT_WORDS = std::vector<std::string>{
+    "furiously", "carefully", "quickly",  "blithely",     "slyly",     "fluffily",     "final",       "regular",
+    "express",   "pending",   "ironic",   "bold",         "silent",    "special",      "even",        "unusual",
+    "requests",  "deposits",  "packages", "accounts",     "instructions", "theodolites", "foxes",     "pinto",
+    "beans",     "ideas",     "excuses",  "platelets",    "asymptotes", "courts",      "dolphins",    "sleep",
+    "wake",      "are",       "haggle",   "nag",          "use",       "boost",        "affix",       "detect",
+    "integrate", "cajole",    "among",    "across",       "above",     "according to", "the",         "Customer",
+    "Complaints"};
+
+// Dates are represented by the number of days since 1992-01-01, the first order date of TPC-H.
+const auto START_DATE = std::chrono::sys_days{std::chrono::year{1992} / 1 / 1};
+const auto END_DATE =
+    static_cast<int32_t>((std::chrono::sys_days{std::chrono::year{1998} / 12 / 31} - START_DATE).count());
+// Line items received before this date are returned or accepted, those shipped after it are still open.
+const auto CURRENT_DATE =
+    static_cast<int32_t>((std::chrono::sys_days{std::chrono::year{1995} / 6 / 17} - START_DATE).count());
+
+// Returns the number with leading zeros up to the given width.
+std::string pad(const int64_t number, const size_t width) {
+  const auto digits = std::to_string(number);
+  return std::string(width - std::min(width, digits.size()), '0') + digits;
+}
+
+// Returns the 'YYYY-MM-DD' strings of all dates from START_DATE to END_DATE.
+std::vector<std::string> date_strings() {
+  auto dates = std::vector<std::string>{};
+  dates.reserve(END_DATE + 1);
+  for (auto day = int32_t{0}; day <= END_DATE; ++day) {
+    const auto date = std::chrono::year_month_day{START_DATE + std::chrono::days{day}};
+    dates.push_back(pad(static_cast<int32_t>(date.year()), 4) + "-" + pad(static_cast<unsigned>(date.month()), 2) +
+                    "-" + pad(static_cast<unsigned>(date.day()), 2));
+  }
+  return dates;
+}
+
+// Draws values with the distributions of the TPC-H specification. They are derived from the raw output of mt19937_64,
+// whose sequence is fully specified, rather than from the std distributions, whose results depend on the standard
+// library.
+class TpchRandom {
+ public:
+  explicit TpchRandom(const uint64_t seed) : _generator(seed) {}
+
+  int64_t uniform(const int64_t min, const int64_t max) {
+    return min + static_cast<int64_t>(_generator() % static_cast<uint64_t>(max - min + 1));
+  }
+
+  // Returns an amount of money with two decimal places, given in cents.
+  float money(const int64_t min_cents, const int64_t max_cents) {
+    return static_cast<float>(uniform(min_cents, max_cents)) / 100.0f;
+  }
+
+  const std::string& choice(const std::vector<std::string>& values) {
+    return values[uniform(0, static_cast<int64_t>(values.size()) - 1)];
+  }
+
+  // Returns words from TEXT_WORDS, cut to a length between min_length and max_length.
+  std::string text(const size_t min_length, const size_t max_length) {
+    const auto length =
+        static_cast<size_t>(uniform(static_cast<int64_t>(min_length), static_cast<int64_t>(max_length)));
+    auto text = choice(TEXT_WORDS);
+    while (text.size() < length) {
+      text += " " + choice(TEXT_WORDS);
+    }
+    text.resize(length);
+    return text;
+  }
+
+  std::string phone(const int32_t nation_key) {
+    return std::to_string(nation_key + 10) + "-" + std::to_string(uniform(100, 999)) + "-" +
+           std::to_string(uniform(100, 999)) + "-" + std::to_string(uniform(1000, 9999));
+  }
+
+ protected:
+  std::mt19937_64 _generator;
+};
+
+// The retail price of a part is a function of its key (TPC-H 4.2.3).
+float retail_price(const int32_t part_key) {
+  return static_cast<float>(90'000 + (part_key / 10) % 20'001 + 100 * (part_key % 1'000)) / 100.0f;
+}
+
+// Returns the key of the supplier_index-th of the four suppliers of a part (TPC-H 4.2.3).
+int32_t part_supplier_key(const int32_t part_key, const int32_t supplier_index, const int32_t supplier_count) {
+  const auto stride = supplier_count / 4 + (part_key - 1) / supplier_count;
+  return static_cast<int32_t>((part_key + supplier_index * stride) % supplier_count + 1);
+}
+
+}  // namespace
+
+namespace opossum {
+
+TpchTableGenerator::TpchTableGenerator(const float scale_factor, const ChunkOffset chunk_size, const bool compress)
+    : _scale_factor(scale_factor), _chunk_size(chunk_size), _compress(compress) {
+  Assert(scale_factor > 0.0f, "Scale factor must be positive.");
+}
+
+std::map<std::string, std::shared_ptr<Table>> TpchTableGenerator::generate() const {
+  auto tables = std::map<std::string, std::shared_ptr<Table>>{};
+  tables["region"] = _generate_region();
+  tables["nation"] = _generate_nation();
+  tables["supplier"] = _generate_supplier();
+  tables["customer"] = _generate_customer();
+  tables["part"] = _generate_part();
+  tables["partsupp"] = _generate_partsupp();
+  std::tie(tables["orders"], tables["lineitem"]) = _generate_orders_and_lineitem();
+  return tables;
+}
+
+void TpchTableGenerator::generate_and_store() const {
+  auto& storage_manager = StorageManager::get();
+  for (const auto& [name, table] : generate()) {
+    storage_manager.add_table(name, table);
+  }
+}
+
+size_t TpchTableGenerator::_scaled_row_count(const size_t base_row_count) const {
+  return std::max(size_t{1}, static_cast<size_t>(std::llround(static_cast<double>(base_row_count) * _scale_factor)));
+}
+
+std::shared_ptr<Table> TpchTableGenerator::_generate_region() const {
+  auto random = TpchRandom{1};
+  auto builder = TableBuilder<int32_t, std::string, std::string>{{"r_regionkey", "r_name", "r_comment"}, _chunk_size,
+                                                                 _compress};
+  for (auto region_key = int32_t{0}; region_key < static_cast<int32_t>(REGION_NAMES.size()); ++region_key) {
+    builder.append_row(region_key, REGION_NAMES[region_key], random.text(31, 115));
+  }
+  return builder.finish();
+}
+
+std::shared_ptr<Table> TpchTableGenerator::_generate_nation() const {
+  auto random = TpchRandom{2};
+  auto builder = TableBuilder<int32_t, std::string, int32_t, std::string>{
+      {"n_nationkey", "n_name", "n_regionkey", "n_comment"}, _chunk_size, _compress};
+  for (auto nation_key = int32_t{0}; nation_key < static_cast<int32_t>(NATIONS.size()); ++nation_key) {
+    const auto& [name, region_key] = NATIONS[nation_key];
+    builder.append_row(nation_key, name, region_key, random.text(31, 114));
+  }
+  return builder.finish();
+}
+
+std::shared_ptr<Table> TpchTableGenerator::_generate_supplier() const {
+  auto random = TpchRandom{3};
+  auto builder = TableBuilder<int32_t, std::string, std::string, int32_t, std::string, float, std::string>{
+      {"s_suppkey", "s_name", "s_address", "s_nationkey", "s_phone", "s_acctbal", "s_comment"}, _chunk_size,
+      _compress};
+  const auto supplier_count = static_cast<int32_t>(_scaled_row_count(10'000));
+  for (auto supplier_key = int32_t{1}; supplier_key <= supplier_count; ++supplier_key) {
+    const auto nation_key = static_cast<int32_t>(random.uniform(0, 24));
+    builder.append_row(supplier_key, "Supplier#" + pad(supplier_key, 9), random.text(10, 40), nation_key,
+                       random.phone(nation_key), random.money(-99'999, 999'999), random.text(25, 100));
+  }
+  return builder.finish();
+}
+
+std::shared_ptr<Table> TpchTableGenerator::_generate_customer() const {
+  auto random = TpchRandom{4};
+  auto builder =
+      TableBuilder<int32_t, std::string, std::string, int32_t, std::string, float, std::string, std::string>{
+          {"c_custkey", "c_name", "c_address", "c_nationkey", "c_phone", "c_acctbal", "c_mktsegment", "c_comment"},
+          _chunk_size, _compress};
+  const auto customer_count = static_cast<int32_t>(_scaled_row_count(150'000));
+  for (auto customer_key = int32_t{1}; customer_key <= customer_count; ++customer_key) {
+    const auto nation_key = static_cast<int32_t>(random.uniform(0, 24));
+    builder.append_row(customer_key, "Customer#" + pad(customer_key, 9), random.text(10, 40), nation_key,
+                       random.phone(nation_key), random.money(-99'999, 999'999), random.choice(MARKET_SEGMENTS),
+                       random.text(29, 116));
+  }
+  return builder.finish();
+}
+
+std::shared_ptr<Table> TpchTableGenerator::_generate_part() const {
+  auto random = TpchRandom{5};
+  auto builder = TableBuilder<int32_t, std::string, std::string, std::string, std::string, int32_t, std::string, float,
+                              std::string>{{"p_partkey", "p_name", "p_mfgr", "p_brand", "p_type", "p_size",
+                                            "p_container", "p_retailprice", "p_comment"},
+                                           _chunk_size, _compress};
+  const auto part_count = static_cast<int32_t>(_scaled_row_count(200'000));
+  for (auto part_key = int32_t{1}; part_key <= part_count; ++part_key) {
+    auto name = random.choice(COLORS);
+    for (auto word = 1; word < 5; ++word) {
+      name += " " + random.choice(COLORS);
+    }
+    const auto manufacturer = random.uniform(1, 5);
+    builder.append_row(part_key, name, "Manufacturer#" + std::to_string(manufacturer),
+                       "Brand#" + std::to_string(manufacturer) + std::to_string(random.uniform(1, 5)),
+                       random.choice(TYPE_SIZES) + " " + random.choice(TYPE_FINISHES) + " " +
+                           random.choice(TYPE_MATERIALS),
+                       static_cast<int32_t>(random.uniform(1, 50)),
+                       random.choice(CONTAINER_SIZES) + " " + random.choice(CONTAINER_TYPES), retail_price(part_key),
+                       random.text(5, 22));
+  }
+  return builder.finish();
+}
+
+std::shared_ptr<Table> TpchTableGenerator::_generate_partsupp() const {
+  auto random = TpchRandom{6};
+  auto builder = TableBuilder<int32_t, int32_t, int32_t, float, std::string>{
+      {"ps_partkey", "ps_suppkey", "ps_availqty", "ps_supplycost", "ps_comment"}, _chunk_size, _compress};
+  const auto part_count = static_cast<int32_t>(_scaled_row_count(200'000));
+  const auto supplier_count = static_cast<int32_t>(_scaled_row_count(10'000));
+  for (auto part_key = int32_t{1}; part_key <= part_count; ++part_key) {
+    for (auto supplier_index = int32_t{0}; supplier_index < 4; ++supplier_index) {
+      builder.append_row(part_key, part_supplier_key(part_key, supplier_index, supplier_count),
+                         static_cast<int32_t>(random.uniform(1, 9'999)), random.money(100, 100'000),
+                         random.text(49, 198));
+    }
+  }
+  return builder.finish();
+}
+
+std::pair<std::shared_ptr<Table>, std::shared_ptr<Table>> TpchTableGenerator::_generate_orders_and_lineitem() const {
+  auto random = TpchRandom{7};
+  auto orders_builder =
+      TableBuilder<int32_t, int32_t, std::string, float, std::string, std::string, std::string, int32_t, std::string>{
+          {"o_orderkey", "o_custkey", "o_orderstatus", "o_totalprice", "o_orderdate", "o_orderpriority", "o_clerk",
+           "o_shippriority", "o_comment"},
+          _chunk_size, _compress};
+  auto lineitem_builder =
+      TableBuilder<int32_t, int32_t, int32_t, int32_t, float, float, float, float, std::string, std::string,
+                   std::string, std::string, std::string, std::string, std::string, std::string>{
+          {"l_orderkey", "l_partkey", "l_suppkey", "l_linenumber", "l_quantity", "l_extendedprice", "l_discount",
+           "l_tax", "l_returnflag", "l_linestatus", "l_shipdate", "l_commitdate", "l_receiptdate", "l_shipinstruct",
+           "l_shipmode", "l_comment"},
+          _chunk_size, _compress};
+
+  const auto dates = date_strings();
+  const auto order_count = _scaled_row_count(1'500'000);
+  const auto customer_count = static_cast<int32_t>(_scaled_row_count(150'000));
+  const auto part_count = static_cast<int32_t>(_scaled_row_count(200'000));
+  const auto supplier_count = static_cast<int32_t>(_scaled_row_count(10'000));
+  const auto clerk_count = static_cast<int64_t>(_scaled_row_count(1'000));
+
+  for (auto order_index = size_t{0}; order_index < order_count; ++order_index) {
+    // Only the first eight of every 32 order keys are used (TPC-H 4.2.3).
+    const auto order_key = static_cast<int32_t>((order_index / 8) * 32 + order_index % 8 + 1);
+    // A third of the customers, those whose key is divisible by three, do not place orders.
+    auto customer_key = static_cast<int32_t>(random.uniform(1, customer_count));
+    while (customer_key % 3 == 0) {
+      customer_key = static_cast<int32_t>(random.uniform(1, customer_count));
+    }
+    const auto order_date = static_cast<int32_t>(random.uniform(0, END_DATE - 151));
+
+    auto total_price = 0.0f;
+    auto open_line_count = 0;
+    const auto line_count = static_cast<int32_t>(random.uniform(1, 7));
+    for (auto line_number = int32_t{1}; line_number <= line_count; ++line_number) {
+      const auto part_key = static_cast<int32_t>(random.uniform(1, part_count));
+      const auto supplier_key =
+          part_supplier_key(part_key, static_cast<int32_t>(random.uniform(0, 3)), supplier_count);
+      const auto quantity = static_cast<float>(random.uniform(1, 50));
+      const auto extended_price = quantity * retail_price(part_key);
+      const auto discount = static_cast<float>(random.uniform(0, 10)) / 100.0f;
+      const auto tax = static_cast<float>(random.uniform(0, 8)) / 100.0f;
+      const auto ship_date = order_date + static_cast<int32_t>(random.uniform(1, 121));
+      const auto commit_date = order_date + static_cast<int32_t>(random.uniform(30, 90));
+      const auto receipt_date = ship_date + static_cast<int32_t>(random.uniform(1, 30));
+      const auto return_flag = receipt_date <= CURRENT_DATE ? (random.uniform(0, 1) == 0 ? "R" : "A") : "N";
+      const auto is_open = ship_date > CURRENT_DATE;
+
+      total_price += extended_price * (1.0f + tax) * (1.0f - discount);
+      open_line_count += is_open;
+      lineitem_builder.append_row(order_key, part_key, supplier_key, line_number, quantity, extended_price, discount,
+                                  tax, return_flag, is_open ? "O" : "F", dates[ship_date], dates[commit_date],
+                                  dates[receipt_date], random.choice(SHIP_INSTRUCTIONS), random.choice(SHIP_MODES),
+                                  random.text(10, 43));
+    }
+
+    const auto order_status = open_line_count == line_count ? "O" : open_line_count == 0 ? "F" : "P";
+    orders_builder.append_row(order_key, customer_key, order_status, total_price, dates[order_date],
+                              random.choice(ORDER_PRIORITIES), "Clerk#" + pad(random.uniform(1, clerk_count), 9),
+                              0, random.text(19, 78));
+  }
+  return {orders_builder.finish(), lineitem_builder.finish()};
+}
+
+}  // namespace opossum
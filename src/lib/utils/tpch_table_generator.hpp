@@ -0,0 +1,53 @@
+#pragma once
+
+#include <map>
+#include <memory>
+#include <string>
+#include <utility>
+
+#include "types.hpp"
+
+namespace opossum {
+
+class Table;
+
+// Generates the eight tables of TPC-H (region, nation, supplier, customer, part, partsupp, orders, and lineitem) with
+// the schemas, key relationships, and value distributions of the specification, so that the queries select realistic
+// fractions of the rows. Decimals are stored as floats and dates as 'YYYY-MM-DD' strings, which compare like dates.
+// Free-text columns (names, addresses, and comments) are built from a small vocabulary instead of dbgen's grammar.
+//
+// The generator is deterministic: every table is drawn from its own mt19937_64 with a fixed seed, so that the same
+// scale factor always yields the same data. The row count of every table except region and nation scales linearly
+// with the scale factor, e.g., orders has 1.5M rows and lineitem about 6M rows at scale factor 1.
+class TpchTableGenerator {
+ public:
+  // Tables are split into chunks of chunk_size rows. If compress is set, each chunk is dictionary-encoded once it is
+  // complete.
+  explicit TpchTableGenerator(const float scale_factor, const ChunkOffset chunk_size = 65'535,
+                              const bool compress = false);
+
+  // Returns all tables by name.
+  std::map<std::string, std::shared_ptr<Table>> generate() const;
+
+  // Generates all tables and adds them to the StorageManager.
+  void generate_and_store() const;
+
+ protected:
+  std::shared_ptr<Table> _generate_region() const;
+  std::shared_ptr<Table> _generate_nation() const;
+  std::shared_ptr<Table> _generate_supplier() const;
+  std::shared_ptr<Table> _generate_customer() const;
+  std::shared_ptr<Table> _generate_part() const;
+  std::shared_ptr<Table> _generate_partsupp() const;
+  // Orders and their line items are generated together, since an order's status and total price depend on its items.
+  std::pair<std::shared_ptr<Table>, std::shared_ptr<Table>> _generate_orders_and_lineitem() const;
+
+  // Returns the number of rows of a table that has base_row_count rows at scale factor 1, but at least one row.
+  size_t _scaled_row_count(const size_t base_row_count) const;
+
+  const float _scale_factor;
+  const ChunkOffset _chunk_size;
+  const bool _compress;
+};
+
+}  // namespace opossum
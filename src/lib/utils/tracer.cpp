@@ -0,0 +1,183 @@
+#include "tracer.hpp"
+
+#include <unistd.h>
+
+#include <algorithm>
+#include <array>
+#include <cstdio>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "utils/assert.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT(build/namespaces)
+
+struct TraceEvent {
+  std::string name;
+  const char* category;
+  std::chrono::steady_clock::time_point begin;
+  std::chrono::steady_clock::time_point end;
+  const char* argument_name;
+  int64_t argument;
+};
+
+// The events of one thread. The buffers are shared with the registry, so that the events of a thread are kept when it
+// exits, e.g., the workers of run_in_parallel.
+struct ThreadBuffer {
+  explicit ThreadBuffer(const size_t init_thread_index) : thread_index(init_thread_index) {}
+
+  const size_t thread_index;
+  std::vector<TraceEvent> events;
+};
+
+struct Registry {
+  std::mutex mutex;
+  std::vector<std::shared_ptr<ThreadBuffer>> buffers;
+  size_t next_thread_index = 0;
+  // Timestamps in the trace are relative to the creation of the registry, which Tracer::enable ensures before any
+  // event begins.
+  const std::chrono::steady_clock::time_point epoch = std::chrono::steady_clock::now();
+};
+
+Registry& registry() {
+  static auto registry = Registry{};
+  return registry;
+}
+
+ThreadBuffer& thread_buffer() {
+  thread_local const auto buffer = []() {
+    auto& registry = ::registry();
+    const auto lock = std::lock_guard<std::mutex>{registry.mutex};
+    const auto buffer = std::make_shared<ThreadBuffer>(registry.next_thread_index++);
+    registry.buffers.push_back(buffer);
+    return buffer;
+  }();
+  return *buffer;
+}
+
+void write_json_string(std::ostream& out, const std::string_view string) {
+  out << '"';
+  for (const auto character : string) {
+    if (character == '"' || character == '\\') {
+      out << '\\' << character;
+    } else if (static_cast<unsigned char>(character) < 0x20) {
+      // JSON does not allow control characters in strings, e.g., line breaks in a traced query.
+      auto escaped = std::array<char, 7>{};
+      std::snprintf(escaped.data(), escaped.size(), "\\u%04x", static_cast<unsigned int>(character));
+      out << escaped.data();
+    } else {
+      out << character;
+    }
+  }
+  out << '"';
+}
+
+double microseconds(const std::chrono::steady_clock::duration duration) {
+  return std::chrono::duration<double, std::micro>(duration).count();
+}
+
+}  // namespace
+
+namespace opossum {
+
+void Tracer::enable() {
+  registry();
+  _enabled.store(true);
+}
+
+void Tracer::disable() {
+  _enabled.store(false);
+}
+
+void Tracer::clear() {
+  auto& registry = ::registry();
+  const auto lock = std::lock_guard<std::mutex>{registry.mutex};
+  // The buffers of threads that exited are only referenced by the registry and can be dropped.
+  std::erase_if(registry.buffers, [](const auto& buffer) { return buffer.use_count() == 1; });
+  for (const auto& buffer : registry.buffers) {
+    buffer->events.clear();
+  }
+}
+
+size_t Tracer::event_count() {
+  auto& registry = ::registry();
+  const auto lock = std::lock_guard<std::mutex>{registry.mutex};
+  auto event_count = size_t{0};
+  for (const auto& buffer : registry.buffers) {
+    event_count += buffer->events.size();
+  }
+  return event_count;
+}
+
+void Tracer::write_chrome_trace(std::ostream& out) {
+  auto& registry = ::registry();
+  const auto lock = std::lock_guard<std::mutex>{registry.mutex};
+  const auto process_id = getpid();
+
+  // Complete events ("ph": "X") have a begin timestamp and a duration in microseconds. Metadata events ("ph": "M")
+  // name the tracks of the threads.
+  out << "{\"traceEvents\": [";
+  auto separator = "\n";
+  for (const auto& buffer : registry.buffers) {
+    out << separator << "{\"name\": \"thread_name\", \"ph\": \"M\", \"pid\": " << process_id
+        << ", \"tid\": " << buffer->thread_index << ", \"args\": {\"name\": \"Thread " << buffer->thread_index
+        << "\"}}";
+    separator = ",\n";
+
+    auto events = buffer->events;
+    std::stable_sort(events.begin(), events.end(),
+                     [](const auto& left, const auto& right) { return left.begin < right.begin; });
+    for (const auto& event : events) {
+      out << separator << "{\"name\": ";
+      write_json_string(out, event.name);
+      out << ", \"cat\": ";
+      write_json_string(out, event.category);
+      out << ", \"ph\": \"X\", \"ts\": " << microseconds(event.begin - registry.epoch)
+          << ", \"dur\": " << microseconds(event.end - event.begin) << ", \"pid\": " << process_id
+          << ", \"tid\": " << buffer->thread_index;
+      if (event.argument_name) {
+        out << ", \"args\": {";
+        write_json_string(out, event.argument_name);
+        out << ": " << event.argument << "}";
+      }
+      out << "}";
+    }
+  }
+  out << "\n], \"displayTimeUnit\": \"ms\"}\n";
+}
+
+void Tracer::write_chrome_trace(const std::string& path) {
+  auto file = std::ofstream{path};
+  Assert(file.is_open(), "Cannot open " + path + ".");
+  write_chrome_trace(file);
+}
+
+void Tracer::_record(std::string&& name, const char* category, const Clock::time_point begin,
+                     const Clock::time_point end, const char* argument_name, const int64_t argument) {
+  thread_buffer().events.push_back(TraceEvent{std::move(name), category, begin, end, argument_name, argument});
+}
+
+TraceScope::TraceScope(const std::string_view name, const char* category, const char* argument_name,
+                       const int64_t argument)
+    : _enabled(Tracer::is_enabled()),
+      _name(_enabled ? name : std::string_view{}),
+      _category(category),
+      _argument_name(argument_name),
+      _argument(argument),
+      _begin(_enabled ? Tracer::Clock::now() : Tracer::Clock::time_point{}) {}
+
+TraceScope::~TraceScope() {
+  if (_enabled) {
+    Tracer::_record(std::move(_name), _category, _begin, Tracer::Clock::now(), _argument_name, _argument);
+  }
+}
+
+void TraceScope::set_argument(const int64_t argument) {
+  _argument = argument;
+}
+
+}  // namespace opossum
@@ -0,0 +1,76 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <string_view>
+
+namespace opossum {
+
+// Records when operators, calls of run_in_parallel, their worker threads, and the tasks (usually one per chunk) that
+// the workers run begin and end, so that a query can be inspected on a timeline, e.g., to find idle workers or
+// stragglers. The events can be written in the JSON format of Chrome's trace viewer, which chrome://tracing and
+// https://ui.perfetto.dev open. Each thread of the process is shown as one track.
+//
+// Recording is off by default. While it is off, a TraceScope costs a single relaxed atomic load. Each thread appends
+// its events to its own buffer, which is only locked once, when the thread records its first event. Hence, the events
+// must only be written or cleared when no traced work is running, e.g., after the traced query has finished.
+class Tracer {
+ public:
+  static void enable();
+  static void disable();
+
+  static bool is_enabled() {
+    return _enabled.load(std::memory_order_relaxed);
+  }
+
+  // Discards all recorded events.
+  static void clear();
+
+  // Returns the number of recorded events.
+  static size_t event_count();
+
+  // Writes the recorded events as a Chrome trace, ordered by thread and begin time.
+  static void write_chrome_trace(std::ostream& out);
+
+  // Writes the recorded events as a Chrome trace to the given file.
+  static void write_chrome_trace(const std::string& path);
+
+ protected:
+  friend class TraceScope;
+
+  using Clock = std::chrono::steady_clock;
+
+  static void _record(std::string&& name, const char* category, const Clock::time_point begin,
+                      const Clock::time_point end, const char* argument_name, const int64_t argument);
+
+  inline static std::atomic<bool> _enabled{false};
+};
+
+// Records the lifetime of the scope as an event of the current thread, if the Tracer is enabled on construction. The
+// category groups events in the trace viewer, e.g., "operator" or "task". An optional integer argument, e.g., the
+// number of output rows, is shown with the event.
+class TraceScope {
+ public:
+  TraceScope(const std::string_view name, const char* category, const char* argument_name = nullptr,
+             const int64_t argument = 0);
+
+  ~TraceScope();
+
+  TraceScope(const TraceScope&) = delete;
+  TraceScope& operator=(const TraceScope&) = delete;
+
+  void set_argument(const int64_t argument);
+
+ protected:
+  const bool _enabled;
+  std::string _name;
+  const char* const _category;
+  const char* const _argument_name;
+  int64_t _argument;
+  const Tracer::Clock::time_point _begin;
+};
+
+}  // namespace opossum
@@ -0,0 +1,169 @@
+#include "base_test.hpp"
+
+#include "expression/expression_evaluator.hpp"
+#include "expression/expression_functional.hpp"
+#include "storage/dictionary_segment.hpp"
+
+namespace opossum {
+
+class ExpressionEvaluatorTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    _table = std::make_shared<Table>();
+    _table->add_column("a", "int", false);
+    _table->add_column("b", "double", true);
+    _table->add_column("c", "string", false);
+    _table->append({1, 1.5, "x"});
+    _table->append({2, NULL_VALUE, "12"});
+    _table->append({3, 0.0, "y"});
+    _table->append({4, 2.5, "3"});
+
+    _a = column_(_table, ColumnID{0});
+    _b = column_(_table, ColumnID{1});
+    _c = column_(_table, ColumnID{2});
+  }
+
+  template <typename T>
+  std::shared_ptr<ExpressionResult<T>> _evaluate(const std::shared_ptr<AbstractExpression>& expression) {
+    auto evaluator = ExpressionEvaluator{_table->get_chunk(ChunkID{0})};
+    return evaluator.evaluate_expression_to_result<T>(*expression);
+  }
+
+  std::shared_ptr<Table> _table;
+  std::shared_ptr<ColumnExpression> _a;
+  std::shared_ptr<ColumnExpression> _b;
+  std::shared_ptr<ColumnExpression> _c;
+};
+
+TEST_F(ExpressionEvaluatorTest, DataTypes) {
+  EXPECT_EQ(add_(_a, value_(1))->data_type(), "int");
+  EXPECT_EQ(add_(_a, value_(int64_t{1}))->data_type(), "long");
+  EXPECT_EQ(mul_(_a, _b)->data_type(), "double");
+  EXPECT_EQ(add_(value_(int64_t{1}), value_(1.0f))->data_type(), "double");
+  EXPECT_EQ(compare_(_a, ScanType::OpLessThan, _b)->data_type(), "int");
+  EXPECT_EQ(case_(value_(1), _a, _b)->data_type(), "double");
+  EXPECT_EQ(cast_(_c, "long")->data_type(), "long");
+  EXPECT_THROW(add_(_a, _c), std::logic_error);
+}
+
+TEST_F(ExpressionEvaluatorTest, Nullability) {
+  EXPECT_FALSE(add_(_a, value_(1))->is_nullable());
+  EXPECT_TRUE(add_(_a, _b)->is_nullable());
+  EXPECT_TRUE(div_(_a, value_(2))->is_nullable());
+  EXPECT_TRUE(value_(NULL_VALUE)->is_nullable());
+  EXPECT_FALSE(case_(_b, _a, value_(0))->is_nullable());
+}
+
+TEST_F(ExpressionEvaluatorTest, Arithmetic) {
+  const auto sum = _evaluate<int32_t>(add_(_a, mul_(_a, value_(10))));
+  EXPECT_EQ(sum->values, (std::pmr::vector<int32_t>{11, 22, 33, 44}));
+  EXPECT_FALSE(sum->is_nullable());
+
+  const auto difference = _evaluate<double>(sub_(_b, _a));
+  EXPECT_EQ(difference->values[0], 0.5);
+  EXPECT_TRUE(difference->is_null(1));
+  EXPECT_EQ(difference->values[3], -1.5);
+}
+
+TEST_F(ExpressionEvaluatorTest, DivisionByZeroIsNull) {
+  const auto quotient = _evaluate<int32_t>(div_(value_(12), sub_(_a, value_(2))));
+  EXPECT_EQ(quotient->values[0], -12);
+  EXPECT_TRUE(quotient->is_null(1));
+  EXPECT_EQ(quotient->values[2], 12);
+  EXPECT_EQ(quotient->values[3], 6);
+
+  const auto remainder = _evaluate<double>(mod_(value_(5.0), _b));
+  EXPECT_EQ(remainder->values[0], 0.5);
+  EXPECT_TRUE(remainder->is_null(1));
+  EXPECT_TRUE(remainder->is_null(2));
+  EXPECT_EQ(remainder->values[3], 0.0);
+}
+
+TEST_F(ExpressionEvaluatorTest, DivisionOverflowIsNull) {
+  // For a = 1, the smallest int is divided by -1, whose quotient does not fit into an int.
+  const auto min_int = value_(std::numeric_limits<int32_t>::min());
+  const auto quotient = _evaluate<int32_t>(div_(min_int, sub_(_a, value_(2))));
+  EXPECT_TRUE(quotient->is_null(0));
+  EXPECT_TRUE(quotient->is_null(1));
+  EXPECT_EQ(quotient->values[2], std::numeric_limits<int32_t>::min());
+
+  const auto remainder = _evaluate<int32_t>(mod_(min_int, sub_(_a, value_(2))));
+  EXPECT_FALSE(remainder->is_null(0));
+  EXPECT_EQ(remainder->values[0], 0);
+  EXPECT_TRUE(remainder->is_null(1));
+
+  const auto long_quotient =
+      _evaluate<int64_t>(div_(value_(std::numeric_limits<int64_t>::min()), value_(int64_t{-1})));
+  EXPECT_TRUE(long_quotient->is_null(0));
+}
+
+TEST_F(ExpressionEvaluatorTest, LiteralsAreNotExpanded) {
+  const auto result = _evaluate<int32_t>(add_(value_(1), value_(2)));
+  EXPECT_TRUE(result->is_literal());
+  EXPECT_EQ(result->values, (std::pmr::vector<int32_t>{3}));
+
+  const auto null_result = _evaluate<int32_t>(add_(_a, value_(NULL_VALUE)));
+  for (auto row = size_t{0}; row < 4; ++row) {
+    EXPECT_TRUE(null_result->is_null(row));
+  }
+}
+
+TEST_F(ExpressionEvaluatorTest, Comparison) {
+  const auto result = _evaluate<int32_t>(compare_(_b, ScanType::OpGreaterThan, _a));
+  EXPECT_EQ(result->values[0], 1);
+  EXPECT_TRUE(result->is_null(1));
+  EXPECT_EQ(result->values[2], 0);
+  EXPECT_EQ(result->values[3], 0);
+
+  const auto strings = _evaluate<int32_t>(compare_(_c, ScanType::OpEquals, value_("y")));
+  EXPECT_EQ(strings->values, (std::pmr::vector<int32_t>{0, 0, 1, 0}));
+}
+
+TEST_F(ExpressionEvaluatorTest, Case) {
+  const auto result = _evaluate<double>(case_(compare_(_a, ScanType::OpLessThanEquals, value_(2)), _b, value_(-1)));
+  EXPECT_EQ(result->values[0], 1.5);
+  EXPECT_TRUE(result->is_null(1));
+  EXPECT_EQ(result->values[2], -1.0);
+  EXPECT_EQ(result->values[3], -1.0);
+
+  // NULL conditions take the ELSE branch.
+  const auto null_condition = _evaluate<int32_t>(case_(compare_(_b, ScanType::OpEquals, _b), _a, value_(0)));
+  EXPECT_EQ(null_condition->values, (std::pmr::vector<int32_t>{1, 0, 3, 4}));
+}
+
+TEST_F(ExpressionEvaluatorTest, Cast) {
+  const auto to_string = _evaluate<std::string>(cast_(_a, "string"));
+  EXPECT_EQ(to_string->values, (std::pmr::vector<std::string>{"1", "2", "3", "4"}));
+
+  const auto numbers = _evaluate<int64_t>(cast_(case_(compare_(_a, ScanType::OpEquals, value_(2)), _c, value_("0")),
+                                                "long"));
+  EXPECT_EQ(numbers->values, (std::pmr::vector<int64_t>{0, 12, 0, 0}));
+
+  EXPECT_THROW(_evaluate<int32_t>(cast_(_c, "int")), std::logic_error);
+}
+
+TEST_F(ExpressionEvaluatorTest, DictionarySegments) {
+  _table->compress_chunk(ChunkID{0});
+
+  const auto result = _evaluate<double>(add_(_a, _b));
+  EXPECT_EQ(result->values[0], 2.5);
+  EXPECT_TRUE(result->is_null(1));
+  EXPECT_EQ(result->values[2], 3.0);
+}
+
+TEST_F(ExpressionEvaluatorTest, EvaluateToSegment) {
+  auto evaluator = ExpressionEvaluator{_table->get_chunk(ChunkID{0})};
+
+  const auto segment = evaluator.evaluate_expression_to_segment(*value_(7));
+  const auto value_segment = std::dynamic_pointer_cast<ValueSegment<int32_t>>(segment);
+  ASSERT_TRUE(value_segment);
+  EXPECT_EQ(value_segment->values(), (std::pmr::vector<int32_t>{7, 7, 7, 7}));
+  EXPECT_FALSE(value_segment->is_nullable());
+
+  const auto nullable_segment = evaluator.evaluate_expression_to_segment(*mul_(_b, value_(2)));
+  EXPECT_TRUE(std::dynamic_pointer_cast<ValueSegment<double>>(nullable_segment)->is_nullable());
+  EXPECT_EQ((*nullable_segment)[0], AllTypeVariant{3.0});
+  EXPECT_TRUE(variant_is_null((*nullable_segment)[1]));
+}
+
+}  // namespace opossum
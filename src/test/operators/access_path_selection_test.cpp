@@ -0,0 +1,81 @@
+#include "base_test.hpp"
+
+#include "operators/access_path_selection.hpp"
+#include "operators/scan_utils.hpp"
+#include "storage/index/composite_index.hpp"
+#include "storage/index/group_key_index.hpp"
+
+namespace opossum {
+
+class OperatorsAccessPathSelectionTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    _previous_threshold = index_selectivity_threshold();
+
+    _table = std::make_shared<Table>(100);
+    _table->add_column("a", "int", false);
+    _table->add_column("b", "int", true);
+    for (auto index = int32_t{0}; index < 200; ++index) {
+      _table->append({index % 50, index % 7 == 0 ? AllTypeVariant{NULL_VALUE} : AllTypeVariant{index}});
+    }
+    _table->compress_chunk(ChunkID{0});
+    _table->get_chunk(ChunkID{0})->create_index<GroupKeyIndex>({ColumnID{0}});
+    _table->get_chunk(ChunkID{1})->create_index<CompositeIndex>({ColumnID{0}, ColumnID{1}});
+  }
+
+  void TearDown() override {
+    set_index_selectivity_threshold(_previous_threshold);
+  }
+
+  float _previous_threshold{};
+  std::shared_ptr<Table> _table;
+};
+
+TEST_F(OperatorsAccessPathSelectionTest, Calibration) {
+  set_index_selectivity_threshold(DEFAULT_INDEX_SELECTIVITY_THRESHOLD);
+  const auto threshold = calibrate_index_selectivity_threshold();
+  EXPECT_GE(threshold, 0.0f);
+  EXPECT_LE(threshold, 0.5f);
+  // Calibrating does not change the threshold that scans use.
+  EXPECT_EQ(index_selectivity_threshold(), DEFAULT_INDEX_SELECTIVITY_THRESHOLD);
+}
+
+TEST_F(OperatorsAccessPathSelectionTest, PreferIndexLookup) {
+  set_index_selectivity_threshold(0.1f);
+  EXPECT_TRUE(prefer_index_lookup(0, 100));
+  EXPECT_TRUE(prefer_index_lookup(10, 100));
+  EXPECT_FALSE(prefer_index_lookup(11, 100));
+
+  set_index_selectivity_threshold(0.0f);
+  EXPECT_FALSE(prefer_index_lookup(0, 100));
+  EXPECT_FALSE(prefer_index_lookup(1, 100));
+  EXPECT_THROW(set_index_selectivity_threshold(1.5f), std::logic_error);
+}
+
+TEST_F(OperatorsAccessPathSelectionTest, SameResultsForBothAccessPaths) {
+  const auto predicate_lists = std::vector<std::vector<ScanPredicate>>{
+      {{ColumnID{0}, ScanType::OpEquals, 7}},
+      {{ColumnID{0}, ScanType::OpLessThan, 30}},
+      {{ColumnID{0}, ScanType::OpEquals, 7}, {ColumnID{1}, ScanType::OpGreaterThan, 10}},
+      {{ColumnID{1}, ScanType::OpLessThan, 150}, {ColumnID{0}, ScanType::OpBetween, 3, 9}},
+      // IN lists are looked up value by value. Duplicates and NULLs must not add rows.
+      {{.column_id = ColumnID{0}, .scan_type = ScanType::OpIn, .in_values = {7, 3, NULL_VALUE, 7, 60}}},
+      {{ColumnID{0}, ScanType::OpEquals, 7},
+       {.column_id = ColumnID{1}, .scan_type = ScanType::OpIn, .in_values = {157, 57, 8, 107, 57}}}};
+
+  // The CompositeIndex of chunk 1 does not contain the rows with a NULL in column b, so predicates on column a alone
+  // are always scanned there.
+  for (const auto& predicates : predicate_lists) {
+    for (auto chunk_id = ChunkID{0}; chunk_id < _table->chunk_count(); ++chunk_id) {
+      // A threshold of 0 only scans, a threshold of 1 always uses the index.
+      set_index_selectivity_threshold(0.0f);
+      const auto scanned = scan_chunk(*_table, chunk_id, predicates);
+      set_index_selectivity_threshold(1.0f);
+      const auto looked_up = scan_chunk(*_table, chunk_id, predicates);
+      EXPECT_EQ(scanned, looked_up);
+      EXPECT_FALSE(scanned.empty());
+    }
+  }
+}
+
+}  // namespace opossum
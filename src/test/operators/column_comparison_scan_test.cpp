@@ -0,0 +1,79 @@
+#include "base_test.hpp"
+
+#include "operators/column_comparison_scan.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+
+namespace opossum {
+
+class OperatorsColumnComparisonScanTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    _table = std::make_shared<Table>(3);
+    _table->add_column("a", "int", false);
+    _table->add_column("b", "double", true);
+    _table->add_column("c", "long", false);
+    _table->add_column("d", "string", false);
+    _table->add_column("e", "string", true);
+    _table->append({1, 2.0, int64_t{1}, "x", "y"});
+    _table->append({2, 1.5, int64_t{3}, "b", "a"});
+    _table->append({3, NULL_VALUE, int64_t{3}, "m", NULL_VALUE});
+    _table->append({4, 4.0, int64_t{0}, "q", "q"});
+    _table->append({5, 5.5, int64_t{5}, "a", "z"});
+
+    _table_wrapper = std::make_shared<TableWrapper>(_table);
+    _table_wrapper->execute();
+  }
+
+  std::vector<AllTypeVariant> _scan(const ColumnID left_column_id, const ScanType scan_type,
+                                    const ColumnID right_column_id) {
+    auto scan = std::make_shared<ColumnComparisonScan>(_table_wrapper, left_column_id, scan_type, right_column_id);
+    scan->execute();
+
+    const auto output = scan->get_output();
+    auto values = std::vector<AllTypeVariant>{};
+    for (auto chunk_id = ChunkID{0}; chunk_id < output->chunk_count(); ++chunk_id) {
+      const auto chunk = output->get_chunk(chunk_id);
+      for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk->size(); ++chunk_offset) {
+        values.push_back((*chunk->get_segment(ColumnID{0}))[chunk_offset]);
+      }
+    }
+    return values;
+  }
+
+  std::shared_ptr<Table> _table;
+  std::shared_ptr<TableWrapper> _table_wrapper;
+};
+
+TEST_F(OperatorsColumnComparisonScanTest, SameType) {
+  EXPECT_EQ(_scan(ColumnID{3}, ScanType::OpLessThan, ColumnID{4}), (std::vector<AllTypeVariant>{1, 5}));
+  EXPECT_EQ(_scan(ColumnID{3}, ScanType::OpEquals, ColumnID{4}), (std::vector<AllTypeVariant>{4}));
+  EXPECT_EQ(_scan(ColumnID{0}, ScanType::OpEquals, ColumnID{0}), (std::vector<AllTypeVariant>{1, 2, 3, 4, 5}));
+}
+
+TEST_F(OperatorsColumnComparisonScanTest, MixedNumericTypes) {
+  EXPECT_EQ(_scan(ColumnID{0}, ScanType::OpLessThan, ColumnID{1}), (std::vector<AllTypeVariant>{1, 5}));
+  EXPECT_EQ(_scan(ColumnID{0}, ScanType::OpNotEquals, ColumnID{1}), (std::vector<AllTypeVariant>{1, 2, 5}));
+  EXPECT_EQ(_scan(ColumnID{0}, ScanType::OpGreaterThanEquals, ColumnID{2}), (std::vector<AllTypeVariant>{1, 3, 4, 5}));
+  EXPECT_EQ(_scan(ColumnID{2}, ScanType::OpLessThanEquals, ColumnID{1}), (std::vector<AllTypeVariant>{1, 4, 5}));
+}
+
+TEST_F(OperatorsColumnComparisonScanTest, DictionaryAndReferenceSegments) {
+  _table->compress_chunk(ChunkID{0});
+  EXPECT_EQ(_scan(ColumnID{0}, ScanType::OpGreaterThan, ColumnID{1}), (std::vector<AllTypeVariant>{2}));
+
+  auto table_scan = std::make_shared<TableScan>(_table_wrapper, ColumnID{0}, ScanType::OpGreaterThan, 1);
+  table_scan->execute();
+  auto scan = std::make_shared<ColumnComparisonScan>(table_scan, ColumnID{3}, ScanType::OpGreaterThan, ColumnID{4});
+  scan->execute();
+  EXPECT_EQ(scan->get_output()->row_count(), 1);
+}
+
+TEST_F(OperatorsColumnComparisonScanTest, InvalidComparisons) {
+  auto string_scan =
+      std::make_shared<ColumnComparisonScan>(_table_wrapper, ColumnID{0}, ScanType::OpEquals, ColumnID{3});
+  EXPECT_THROW(string_scan->execute(), std::logic_error);
+  EXPECT_THROW(ColumnComparisonScan(_table_wrapper, ColumnID{0}, ScanType::OpLike, ColumnID{1}), std::logic_error);
+}
+
+}  // namespace opossum
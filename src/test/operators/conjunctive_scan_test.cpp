@@ -0,0 +1,263 @@
+#include "base_test.hpp"
+
+#include "operators/conjunctive_scan.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "storage/index/composite_index.hpp"
+#include "storage/pos_list_utils.hpp"
+#include "storage/reference_segment.hpp"
+
+namespace opossum {
+
+class OperatorsConjunctiveScanTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    _table = std::make_shared<Table>(4);
+    _table->add_column("a", "int", false);
+    _table->add_column("b", "float", true);
+    _table->add_column("c", "string", false);
+    for (auto index = int32_t{0}; index < 10; ++index) {
+      const auto b = index % 3 == 0 ? AllTypeVariant{NULL_VALUE} : AllTypeVariant{static_cast<float>(index) / 2};
+      _table->append({index, b, index % 2 == 0 ? "even" : "odd"});
+    }
+
+    _table_wrapper = std::make_shared<TableWrapper>(_table);
+    _table_wrapper->execute();
+  }
+
+  std::vector<AllTypeVariant> _column_values(const std::shared_ptr<const Table>& table, const ColumnID column_id) {
+    auto values = std::vector<AllTypeVariant>{};
+    for (auto chunk_id = ChunkID{0}; chunk_id < table->chunk_count(); ++chunk_id) {
+      const auto chunk = table->get_chunk(chunk_id);
+      for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk->size(); ++chunk_offset) {
+        values.push_back((*chunk->get_segment(column_id))[chunk_offset]);
+      }
+    }
+    return values;
+  }
+
+  std::shared_ptr<Table> _table;
+  std::shared_ptr<TableWrapper> _table_wrapper;
+};
+
+TEST_F(OperatorsConjunctiveScanTest, ConjunctionOfPredicates) {
+  for (const auto compress : {false, true}) {
+    if (compress) {
+      for (auto chunk_id = ChunkID{0}; chunk_id < _table->chunk_count(); ++chunk_id) {
+        _table->compress_chunk(chunk_id);
+      }
+    }
+
+    auto scan = std::make_shared<ConjunctiveScan>(
+        _table_wrapper, std::vector<ScanPredicate>{{ColumnID{0}, ScanType::OpGreaterThanEquals, 2},
+                                                   {ColumnID{2}, ScanType::OpEquals, "even"},
+                                                   {ColumnID{1}, ScanType::OpNotEquals, 4.0f}});
+    scan->execute();
+
+    // Row 6 has a NULL in column b and row 8 has b = 4.
+    EXPECT_EQ(_column_values(scan->get_output(), ColumnID{0}), (std::vector<AllTypeVariant>{2, 4}));
+  }
+}
+
+TEST_F(OperatorsConjunctiveScanTest, Between) {
+  auto scan = std::make_shared<ConjunctiveScan>(
+      _table_wrapper, std::vector<ScanPredicate>{{ColumnID{0}, ScanType::OpBetween, 3, 7}});
+  scan->execute();
+  EXPECT_EQ(_column_values(scan->get_output(), ColumnID{0}), (std::vector<AllTypeVariant>{3, 4, 5, 6, 7}));
+
+  _table->compress_chunk(ChunkID{0});
+  _table->compress_chunk(ChunkID{1});
+  auto dictionary_scan = std::make_shared<ConjunctiveScan>(
+      _table_wrapper, std::vector<ScanPredicate>{{ColumnID{0}, ScanType::OpBetween, 3, 7},
+                                                 {ColumnID{1}, ScanType::OpBetween, 0.5f, 3.0f}});
+  dictionary_scan->execute();
+  EXPECT_EQ(_column_values(dictionary_scan->get_output(), ColumnID{0}), (std::vector<AllTypeVariant>{4, 5}));
+
+  auto empty_scan = std::make_shared<ConjunctiveScan>(
+      _table_wrapper, std::vector<ScanPredicate>{{ColumnID{0}, ScanType::OpBetween, 7, 3}});
+  empty_scan->execute();
+  EXPECT_EQ(empty_scan->get_output()->row_count(), 0);
+}
+
+TEST_F(OperatorsConjunctiveScanTest, InList) {
+  const auto short_list = ScanPredicate{.column_id = ColumnID{0}, .scan_type = ScanType::OpIn, .in_values = {1, 8, 4}};
+  const auto long_list = ScanPredicate{.column_id = ColumnID{0},
+                                       .scan_type = ScanType::OpIn,
+                                       .in_values = {12, 1, 3, 5, 7, NULL_VALUE, 9, 11, 13, 15}};
+
+  for (const auto compress : {false, true}) {
+    if (compress) {
+      for (auto chunk_id = ChunkID{0}; chunk_id < _table->chunk_count(); ++chunk_id) {
+        _table->compress_chunk(chunk_id);
+      }
+    }
+
+    auto short_scan = std::make_shared<ConjunctiveScan>(_table_wrapper, std::vector<ScanPredicate>{short_list});
+    short_scan->execute();
+    EXPECT_EQ(_column_values(short_scan->get_output(), ColumnID{0}), (std::vector<AllTypeVariant>{1, 4, 8}));
+
+    auto long_scan = std::make_shared<ConjunctiveScan>(_table_wrapper, std::vector<ScanPredicate>{long_list});
+    long_scan->execute();
+    EXPECT_EQ(_column_values(long_scan->get_output(), ColumnID{0}), (std::vector<AllTypeVariant>{1, 3, 5, 7, 9}));
+  }
+
+  const auto null_list =
+      ScanPredicate{.column_id = ColumnID{0}, .scan_type = ScanType::OpIn, .in_values = {NULL_VALUE}};
+  auto null_scan = std::make_shared<ConjunctiveScan>(_table_wrapper, std::vector<ScanPredicate>{null_list});
+  null_scan->execute();
+  EXPECT_EQ(null_scan->get_output()->row_count(), 0);
+}
+
+TEST_F(OperatorsConjunctiveScanTest, Like) {
+  for (const auto compress : {false, true}) {
+    if (compress) {
+      for (auto chunk_id = ChunkID{0}; chunk_id < _table->chunk_count(); ++chunk_id) {
+        _table->compress_chunk(chunk_id);
+      }
+    }
+
+    auto prefix_scan = std::make_shared<ConjunctiveScan>(
+        _table_wrapper, std::vector<ScanPredicate>{{ColumnID{2}, ScanType::OpLike, "ev%"},
+                                                   {ColumnID{0}, ScanType::OpLessThan, 5}});
+    prefix_scan->execute();
+    EXPECT_EQ(_column_values(prefix_scan->get_output(), ColumnID{0}), (std::vector<AllTypeVariant>{0, 2, 4}));
+
+    auto general_scan = std::make_shared<ConjunctiveScan>(
+        _table_wrapper, std::vector<ScanPredicate>{{ColumnID{2}, ScanType::OpLike, "_d%"}});
+    general_scan->execute();
+    EXPECT_EQ(_column_values(general_scan->get_output(), ColumnID{0}), (std::vector<AllTypeVariant>{1, 3, 5, 7, 9}));
+
+    auto empty_scan = std::make_shared<ConjunctiveScan>(
+        _table_wrapper, std::vector<ScanPredicate>{{ColumnID{2}, ScanType::OpLike, "%x%"}});
+    empty_scan->execute();
+    EXPECT_EQ(empty_scan->get_output()->row_count(), 0);
+  }
+
+  auto table_scan = std::make_shared<TableScan>(_table_wrapper, ColumnID{2}, ScanType::OpLike, "%en");
+  table_scan->execute();
+  EXPECT_EQ(table_scan->get_output()->row_count(), 5);
+
+  auto int_scan = std::make_shared<TableScan>(_table_wrapper, ColumnID{0}, ScanType::OpLike, "1%");
+  EXPECT_THROW(int_scan->execute(), std::logic_error);
+}
+
+TEST_F(OperatorsConjunctiveScanTest, ReferencesOriginalTable) {
+  auto table_scan = std::make_shared<TableScan>(_table_wrapper, ColumnID{0}, ScanType::OpLessThan, 8);
+  table_scan->execute();
+
+  auto scan = std::make_shared<ConjunctiveScan>(
+      table_scan, std::vector<ScanPredicate>{{ColumnID{2}, ScanType::OpEquals, "odd"},
+                                             {ColumnID{0}, ScanType::OpGreaterThan, 1}});
+  scan->execute();
+
+  const auto output = scan->get_output();
+  EXPECT_EQ(_column_values(output, ColumnID{0}), (std::vector<AllTypeVariant>{3, 5, 7}));
+  const auto segment =
+      std::dynamic_pointer_cast<const ReferenceSegment>(output->get_chunk(ChunkID{0})->get_segment(ColumnID{1}));
+  ASSERT_TRUE(segment);
+  EXPECT_EQ(segment->referenced_table(), _table);
+  EXPECT_EQ(segment->pos_list(),
+            std::dynamic_pointer_cast<const ReferenceSegment>(output->get_chunk(ChunkID{0})->get_segment(ColumnID{0}))
+                ->pos_list());
+}
+
+TEST_F(OperatorsConjunctiveScanTest, CompactPositionLists) {
+  // Chunks of 4 rows: all rows of chunk 0 and 1 qualify, one of chunk 2.
+  auto scan = std::make_shared<ConjunctiveScan>(
+      _table_wrapper, std::vector<ScanPredicate>{{ColumnID{0}, ScanType::OpLessThan, 9}});
+  scan->execute();
+
+  const auto output = scan->get_output();
+  const auto pos_list_of_chunk = [&](const ChunkID chunk_id) {
+    return std::static_pointer_cast<const ReferenceSegment>(output->get_chunk(chunk_id)->get_segment(ColumnID{0}))
+        ->pos_list();
+  };
+  EXPECT_TRUE(std::dynamic_pointer_cast<const EntireChunkPosList>(pos_list_of_chunk(ChunkID{0})));
+  EXPECT_EQ(pos_list_of_chunk(ChunkID{2})->single_chunk_id(), ChunkID{2});
+
+  // Scanning the scan result resolves the compact lists and shares them if all rows qualify.
+  auto second_scan = std::make_shared<ConjunctiveScan>(
+      scan, std::vector<ScanPredicate>{{ColumnID{0}, ScanType::OpNotEquals, 5}});
+  second_scan->execute();
+
+  const auto second_output = second_scan->get_output();
+  EXPECT_EQ(_column_values(second_output, ColumnID{0}), (std::vector<AllTypeVariant>{0, 1, 2, 3, 4, 6, 7, 8}));
+  EXPECT_EQ(std::static_pointer_cast<const ReferenceSegment>(
+                second_output->get_chunk(ChunkID{0})->get_segment(ColumnID{1}))->pos_list(),
+            pos_list_of_chunk(ChunkID{0}));
+  EXPECT_EQ(std::static_pointer_cast<const ReferenceSegment>(
+                second_output->get_chunk(ChunkID{1})->get_segment(ColumnID{0}))->pos_list()->single_chunk_id(),
+            ChunkID{1});
+}
+
+TEST_F(OperatorsConjunctiveScanTest, CompositeIndex) {
+  const auto predicates = std::vector<ScanPredicate>{{ColumnID{1}, ScanType::OpNotEquals, 4.0f},
+                                                     {ColumnID{2}, ScanType::OpEquals, "even"},
+                                                     {ColumnID{0}, ScanType::OpBetween, 2, 7}};
+  for (auto chunk_id = ChunkID{0}; chunk_id < _table->chunk_count(); ++chunk_id) {
+    _table->get_chunk(chunk_id)->create_index<CompositeIndex>({ColumnID{2}, ColumnID{0}});
+  }
+
+  // c = "even" AND a BETWEEN 2 AND 7 are looked up in the index, b != 4 is scanned. Row 6 has a NULL in column b.
+  auto scan = std::make_shared<ConjunctiveScan>(_table_wrapper, predicates);
+  scan->execute();
+  EXPECT_EQ(_column_values(scan->get_output(), ColumnID{0}), (std::vector<AllTypeVariant>{2, 4}));
+
+  // An equality predicate on the leading column alone also uses the index.
+  auto prefix_scan = std::make_shared<ConjunctiveScan>(
+      _table_wrapper, std::vector<ScanPredicate>{{ColumnID{2}, ScanType::OpEquals, "odd"},
+                                                 {ColumnID{0}, ScanType::OpGreaterThan, 4}});
+  prefix_scan->execute();
+  EXPECT_EQ(_column_values(prefix_scan->get_output(), ColumnID{0}), (std::vector<AllTypeVariant>{5, 7, 9}));
+}
+
+TEST_F(OperatorsConjunctiveScanTest, NullsAcrossValidityWords) {
+  // The validity bitmap covers 64 rows per word, the last word is only partially used.
+  auto table = std::make_shared<Table>(150);
+  table->add_column("a", "int", true);
+  for (auto index = int32_t{0}; index < 150; ++index) {
+    table->append({index % 5 == 0 ? AllTypeVariant{NULL_VALUE} : AllTypeVariant{index}});
+  }
+  auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  auto scan = std::make_shared<ConjunctiveScan>(
+      table_wrapper, std::vector<ScanPredicate>{{ColumnID{0}, ScanType::OpGreaterThanEquals, 60}});
+  scan->execute();
+
+  auto expected_values = std::vector<AllTypeVariant>{};
+  for (auto index = int32_t{60}; index < 150; ++index) {
+    if (index % 5 != 0) {
+      expected_values.emplace_back(index);
+    }
+  }
+  EXPECT_EQ(_column_values(scan->get_output(), ColumnID{0}), expected_values);
+}
+
+TEST_F(OperatorsConjunctiveScanTest, NullSearchValue) {
+  auto scan = std::make_shared<ConjunctiveScan>(
+      _table_wrapper, std::vector<ScanPredicate>{{ColumnID{0}, ScanType::OpNotEquals, NULL_VALUE}});
+  scan->execute();
+
+  EXPECT_EQ(scan->get_output()->row_count(), 0);
+  EXPECT_EQ(scan->get_output()->get_chunk(ChunkID{0})->column_count(), 3);
+}
+
+TEST_F(OperatorsConjunctiveScanTest, SelectivityEstimation) {
+  _table->compress_chunk(ChunkID{0});
+  const auto segment = _table->get_chunk(ChunkID{0})->get_segment(ColumnID{0});
+
+  // The first chunk holds the values 0 to 3.
+  EXPECT_FLOAT_EQ(estimate_selectivity(*segment, "int", {ColumnID{0}, ScanType::OpEquals, 2}), 0.25f);
+  EXPECT_FLOAT_EQ(estimate_selectivity(*segment, "int", {ColumnID{0}, ScanType::OpLessThan, 3}), 0.75f);
+  EXPECT_FLOAT_EQ(estimate_selectivity(*segment, "int", {ColumnID{0}, ScanType::OpGreaterThan, 10}), 0.0f);
+
+  const auto in_list = ScanPredicate{.column_id = ColumnID{0}, .scan_type = ScanType::OpIn, .in_values = {1, 2, 9}};
+  EXPECT_FLOAT_EQ(estimate_selectivity(*segment, "int", in_list), 0.5f);
+
+  const auto value_segment = _table->get_chunk(ChunkID{1})->get_segment(ColumnID{0});
+  EXPECT_LT(estimate_selectivity(*value_segment, "int", {ColumnID{0}, ScanType::OpEquals, 5}),
+            estimate_selectivity(*value_segment, "int", {ColumnID{0}, ScanType::OpLessThan, 5}));
+}
+
+}  // namespace opossum
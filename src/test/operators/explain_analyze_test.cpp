@@ -0,0 +1,109 @@
+#include "base_test.hpp"
+
+#include "operators/explain_analyze.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "storage/query_memory_context.hpp"
+#include "utils/load_table.hpp"
+
+namespace opossum {
+
+// Consumes two inputs and passes the left one through, so that a plan can share an input like with a join.
+class BinaryPassThrough : public AbstractOperator {
+ public:
+  BinaryPassThrough(const std::shared_ptr<const AbstractOperator>& left,
+                    const std::shared_ptr<const AbstractOperator>& right)
+      : AbstractOperator(left, right) {}
+
+ protected:
+  std::shared_ptr<const Table> _on_execute() override {
+    return _left_input_table();
+  }
+};
+
+class OperatorsExplainAnalyzeTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    _table_wrapper = std::make_shared<TableWrapper>(load_table("src/test/tables/int_float.tbl", 2));
+    _table_wrapper->set_memory_context(std::make_shared<QueryMemoryContext>());
+    _table_scan = std::make_shared<TableScan>(_table_wrapper, ColumnID{0}, ScanType::OpGreaterThan, 1000);
+  }
+
+  std::shared_ptr<TableWrapper> _table_wrapper;
+  std::shared_ptr<TableScan> _table_scan;
+  std::ostringstream _output;
+};
+
+TEST_F(OperatorsExplainAnalyzeTest, Inputs) {
+  EXPECT_EQ(_table_scan->left_input(), _table_wrapper);
+  EXPECT_EQ(_table_scan->right_input(), nullptr);
+  EXPECT_EQ(_table_wrapper->left_input(), nullptr);
+  EXPECT_EQ(_table_scan->name(), "TableScan");
+}
+
+TEST_F(OperatorsExplainAnalyzeTest, PerformanceData) {
+  EXPECT_FALSE(_table_scan->performance_data().executed);
+
+  _table_wrapper->execute();
+  _table_scan->execute();
+
+  const auto& table_wrapper_data = _table_wrapper->performance_data();
+  EXPECT_TRUE(table_wrapper_data.executed);
+  EXPECT_EQ(table_wrapper_data.input_row_count, 0);
+  EXPECT_EQ(table_wrapper_data.output_row_count, 3);
+  EXPECT_EQ(table_wrapper_data.output_chunk_count, 2);
+
+  const auto& table_scan_data = _table_scan->performance_data();
+  EXPECT_TRUE(table_scan_data.executed);
+  EXPECT_EQ(table_scan_data.input_row_count, 3);
+  EXPECT_EQ(table_scan_data.input_chunk_count, 2);
+  EXPECT_EQ(table_scan_data.output_row_count, 2);
+  EXPECT_GT(table_scan_data.walltime.count(), 0);
+  // The output of the scan is allocated from the memory context that it takes over from the TableWrapper.
+  EXPECT_GT(table_scan_data.allocated_bytes, 0);
+}
+
+TEST_F(OperatorsExplainAnalyzeTest, PrintPlan) {
+  _table_wrapper->execute();
+  _table_scan->execute();
+  const auto explain_analyze = std::make_shared<ExplainAnalyze>(_table_scan, _output);
+  explain_analyze->execute();
+
+  // The output of the plan is passed through.
+  EXPECT_EQ(explain_analyze->get_output(), _table_scan->get_output());
+
+  const auto output = _output.str();
+  EXPECT_EQ(output.find("=== Plan\nTableScan | rows: 3 -> 2 | chunks: 2 -> 2 | walltime: "), 0);
+  EXPECT_NE(output.find("\n  TableWrapper | rows: 0 -> 3 | chunks: 0 -> 2 | walltime: "), std::string::npos);
+  EXPECT_NE(output.find("\n=== Total | walltime: "), std::string::npos);
+  const auto peak_allocated_bytes = _table_scan->memory_context()->peak_allocated_bytes();
+  EXPECT_GT(peak_allocated_bytes, 0);
+  EXPECT_NE(output.find(" | peak allocated: " + std::to_string(peak_allocated_bytes) + " bytes\n"),
+            std::string::npos);
+}
+
+TEST_F(OperatorsExplainAnalyzeTest, SharedInput) {
+  const auto other_table_scan = std::make_shared<TableScan>(_table_wrapper, ColumnID{0}, ScanType::OpLessThan, 1000);
+  const auto binary_pass_through = std::make_shared<BinaryPassThrough>(_table_scan, other_table_scan);
+  _table_wrapper->execute();
+  _table_scan->execute();
+  other_table_scan->execute();
+  binary_pass_through->execute();
+  ExplainAnalyze::explain(binary_pass_through, _output);
+
+  // The TableWrapper is printed and counted once.
+  const auto output = _output.str();
+  EXPECT_EQ(output.find("=== Plan\nBinaryPassThrough | rows: 3 -> 2 | "), 0);
+  const auto first_table_wrapper = output.find("\n    TableWrapper #1 | rows: 0 -> 3 | ");
+  EXPECT_NE(first_table_wrapper, std::string::npos);
+  EXPECT_NE(output.find("\n    -> TableWrapper #1\n"), std::string::npos);
+  EXPECT_EQ(output.find("TableWrapper #1 |"), first_table_wrapper + 5);
+  EXPECT_EQ(output.rfind("TableWrapper #1 |"), first_table_wrapper + 5);
+}
+
+TEST_F(OperatorsExplainAnalyzeTest, NotExecuted) {
+  ExplainAnalyze::explain(_table_scan, _output);
+  EXPECT_EQ(_output.str().find("=== Plan\nTableScan | not executed\n  TableWrapper | not executed\n"), 0);
+}
+
+}  // namespace opossum
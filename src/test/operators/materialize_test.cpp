@@ -0,0 +1,130 @@
+#include "base_test.hpp"
+
+#include <sstream>
+
+#include "operators/conjunctive_scan.hpp"
+#include "operators/materialize.hpp"
+#include "operators/table_wrapper.hpp"
+#include "storage/dictionary_segment.hpp"
+#include "storage/table.hpp"
+#include "storage/value_segment.hpp"
+
+namespace opossum {
+
+class OperatorsMaterializeTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    _table = std::make_shared<Table>(4);
+    _table->add_column("a", "int", false);
+    _table->add_column("b", "string", true);
+    for (auto index = int32_t{0}; index < 10; ++index) {
+      _table->append({index, index % 3 == 0 ? AllTypeVariant{NULL_VALUE} : AllTypeVariant{std::to_string(index)}});
+    }
+    _table->compress_chunk(ChunkID{1});
+
+    _table_wrapper = std::make_shared<TableWrapper>(_table);
+    _table_wrapper->execute();
+  }
+
+  std::vector<AllTypeVariant> _column_values(const std::shared_ptr<const Table>& table, const ColumnID column_id) {
+    auto values = std::vector<AllTypeVariant>{};
+    for (auto chunk_id = ChunkID{0}; chunk_id < table->chunk_count(); ++chunk_id) {
+      const auto chunk = table->get_chunk(chunk_id);
+      for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk->size(); ++chunk_offset) {
+        values.push_back((*chunk->get_segment(column_id))[chunk_offset]);
+      }
+    }
+    return values;
+  }
+
+  // NULL_VALUE does not compare equal to itself, so columns with NULLs are compared by their printed values.
+  std::vector<std::string> _printed_values(const std::shared_ptr<const Table>& table, const ColumnID column_id) {
+    auto printed_values = std::vector<std::string>{};
+    for (const auto& value : _column_values(table, column_id)) {
+      auto stream = std::stringstream{};
+      stream << value;
+      printed_values.push_back(stream.str());
+    }
+    return printed_values;
+  }
+
+  std::shared_ptr<Table> _table;
+  std::shared_ptr<TableWrapper> _table_wrapper;
+};
+
+TEST_F(OperatorsMaterializeTest, CompactsScanResult) {
+  // Selects 0, 1, 2, 4, 5, 7, 8, i.e., 3, 2, and 2 rows of the input chunks.
+  auto scan = std::make_shared<ConjunctiveScan>(
+      _table_wrapper, std::vector<ScanPredicate>{{ColumnID{0}, ScanType::OpIn, {}, {}, {0, 1, 2, 4, 5, 7, 8}}});
+  scan->execute();
+
+  auto materialize = std::make_shared<Materialize>(scan);
+  materialize->execute();
+
+  const auto output = materialize->get_output();
+  EXPECT_EQ(output->target_chunk_size(), 4);
+  ASSERT_EQ(output->chunk_count(), 2);
+  EXPECT_EQ(output->get_chunk(ChunkID{0})->size(), 4);
+  EXPECT_EQ(output->get_chunk(ChunkID{1})->size(), 3);
+  EXPECT_EQ(output->column_name(ColumnID{1}), "b");
+  EXPECT_TRUE(output->column_nullable(ColumnID{1}));
+
+  EXPECT_EQ(_column_values(output, ColumnID{0}), (std::vector<AllTypeVariant>{0, 1, 2, 4, 5, 7, 8}));
+  EXPECT_EQ(_printed_values(output, ColumnID{1}), (std::vector<std::string>{"NULL", "1", "2", "4", "5", "7", "8"}));
+
+  for (auto chunk_id = ChunkID{0}; chunk_id < output->chunk_count(); ++chunk_id) {
+    EXPECT_TRUE(std::dynamic_pointer_cast<const ValueSegment<int32_t>>(
+        output->get_chunk(chunk_id)->get_segment(ColumnID{0})));
+    EXPECT_TRUE(std::dynamic_pointer_cast<const ValueSegment<std::string>>(
+        output->get_chunk(chunk_id)->get_segment(ColumnID{1})));
+  }
+}
+
+TEST_F(OperatorsMaterializeTest, DictionaryEncoding) {
+  auto scan = std::make_shared<ConjunctiveScan>(
+      _table_wrapper, std::vector<ScanPredicate>{{ColumnID{0}, ScanType::OpGreaterThan, 2}});
+  scan->execute();
+
+  auto materialize = std::make_shared<Materialize>(scan, true);
+  materialize->execute();
+
+  const auto output = materialize->get_output();
+  ASSERT_EQ(output->chunk_count(), 2);
+  EXPECT_EQ(_printed_values(output, ColumnID{1}),
+            (std::vector<std::string>{"NULL", "4", "5", "NULL", "7", "8", "NULL"}));
+  EXPECT_TRUE(std::dynamic_pointer_cast<const DictionarySegment<std::string>>(
+      output->get_chunk(ChunkID{1})->get_segment(ColumnID{1})));
+}
+
+TEST_F(OperatorsMaterializeTest, PassesThroughMatchingDataSegments) {
+  auto materialize = std::make_shared<Materialize>(_table_wrapper);
+  materialize->execute();
+
+  const auto output = materialize->get_output();
+  ASSERT_EQ(output->chunk_count(), 3);
+  for (auto chunk_id = ChunkID{0}; chunk_id < output->chunk_count(); ++chunk_id) {
+    EXPECT_EQ(output->get_chunk(chunk_id)->get_segment(ColumnID{0}),
+              _table->get_chunk(chunk_id)->get_segment(ColumnID{0}));
+  }
+
+  auto encoding_materialize = std::make_shared<Materialize>(_table_wrapper, true);
+  encoding_materialize->execute();
+  EXPECT_TRUE(std::dynamic_pointer_cast<const DictionarySegment<int32_t>>(
+      encoding_materialize->get_output()->get_chunk(ChunkID{0})->get_segment(ColumnID{0})));
+  EXPECT_EQ(encoding_materialize->get_output()->get_chunk(ChunkID{1})->get_segment(ColumnID{0}),
+            _table->get_chunk(ChunkID{1})->get_segment(ColumnID{0}));
+}
+
+TEST_F(OperatorsMaterializeTest, EmptyInput) {
+  auto scan = std::make_shared<ConjunctiveScan>(
+      _table_wrapper, std::vector<ScanPredicate>{{ColumnID{0}, ScanType::OpGreaterThan, 100}});
+  scan->execute();
+
+  auto materialize = std::make_shared<Materialize>(scan);
+  materialize->execute();
+
+  EXPECT_EQ(materialize->get_output()->row_count(), 0);
+  EXPECT_EQ(materialize->get_output()->column_count(), 2);
+}
+
+}  // namespace opossum
@@ -0,0 +1,132 @@
+#include "base_test.hpp"
+
+#include "expression/expression_functional.hpp"
+#include "operators/pipeline.hpp"
+#include "operators/projection.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "operators/top_n.hpp"
+#include "storage/query_memory_context.hpp"
+
+namespace opossum {
+
+class OperatorsPipelineTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    _table = std::make_shared<Table>(2);
+    _table->add_column("a", "int", false);
+    _table->add_column("b", "int", false);
+    for (auto value = int32_t{0}; value < 9; ++value) {
+      _table->append({value, 10 * value});
+    }
+  }
+
+  // Returns TableWrapper -> TableScan (a >= 2) -> Projection (a, a + b) -> TableScan (a + b < 60) -> TopN.
+  std::vector<std::shared_ptr<AbstractOperator>> _create_plan() const {
+    const auto table_wrapper = std::make_shared<TableWrapper>(_table);
+    table_wrapper->set_memory_context(std::make_shared<QueryMemoryContext>());
+    const auto table_scan = std::make_shared<TableScan>(table_wrapper, ColumnID{0}, ScanType::OpGreaterThanEquals, 2);
+    const auto a = column_(_table, ColumnID{0});
+    const auto b = column_(_table, ColumnID{1});
+    const auto projection =
+        std::make_shared<Projection>(table_scan, std::vector<std::shared_ptr<AbstractExpression>>{a, add_(a, b)});
+    const auto second_table_scan = std::make_shared<TableScan>(projection, ColumnID{1}, ScanType::OpLessThan, 60);
+    const auto top_n = std::make_shared<TopN>(second_table_scan, ColumnID{1}, OrderByMode::Descending, 2);
+    return {table_wrapper, table_scan, projection, second_table_scan, top_n};
+  }
+
+  std::shared_ptr<Table> _table;
+};
+
+TEST_F(OperatorsPipelineTest, CreatePipelines) {
+  const auto plan = _create_plan();
+  const auto pipelines = create_pipelines(plan);
+
+  // TableWrapper and TopN are not pipelineable, so they break the chain of scans and the projection.
+  ASSERT_EQ(pipelines.size(), 3);
+  EXPECT_EQ(pipelines[0].operators(), std::vector<std::shared_ptr<AbstractOperator>>{plan[0]});
+  EXPECT_EQ(pipelines[1].operators(), (std::vector<std::shared_ptr<AbstractOperator>>{plan[1], plan[2], plan[3]}));
+  EXPECT_EQ(pipelines[2].operators(), std::vector<std::shared_ptr<AbstractOperator>>{plan[4]});
+}
+
+TEST_F(OperatorsPipelineTest, SharedInputIsNotFused) {
+  const auto table_wrapper = std::make_shared<TableWrapper>(_table);
+  const auto table_scan = std::make_shared<TableScan>(table_wrapper, ColumnID{0}, ScanType::OpGreaterThan, 2);
+  const auto left_scan = std::make_shared<TableScan>(table_scan, ColumnID{1}, ScanType::OpLessThan, 50);
+  const auto right_scan = std::make_shared<TableScan>(table_scan, ColumnID{1}, ScanType::OpGreaterThan, 60);
+  const auto plan = std::vector<std::shared_ptr<AbstractOperator>>{table_wrapper, table_scan, left_scan, right_scan};
+
+  EXPECT_EQ(create_pipelines(plan).size(), 4);
+
+  execute_pipelined(plan);
+  EXPECT_EQ(table_scan->get_output()->row_count(), 6);
+  EXPECT_EQ(left_scan->get_output()->row_count(), 2);
+  EXPECT_EQ(right_scan->get_output()->row_count(), 2);
+}
+
+TEST_F(OperatorsPipelineTest, SameResultAsOperatorByOperator) {
+  const auto plan = _create_plan();
+  for (const auto& op : plan) {
+    op->execute();
+  }
+
+  const auto pipelined_plan = _create_plan();
+  execute_pipelined(pipelined_plan);
+
+  for (const auto index : {size_t{3}, size_t{4}}) {
+    ASSERT_TRUE(pipelined_plan[index]->get_output());
+    EXPECT_TABLE_EQ(pipelined_plan[index]->get_output(), plan[index]->get_output());
+  }
+  EXPECT_EQ(pipelined_plan[4]->get_output()->row_count(), 2);
+
+  // The scan and the projection only pass their chunks on.
+  EXPECT_FALSE(pipelined_plan[1]->get_output());
+  EXPECT_FALSE(pipelined_plan[2]->get_output());
+}
+
+TEST_F(OperatorsPipelineTest, PerformanceData) {
+  const auto plan = _create_plan();
+  execute_pipelined(plan);
+
+  const auto& table_scan_data = plan[1]->performance_data();
+  EXPECT_TRUE(table_scan_data.executed);
+  EXPECT_EQ(table_scan_data.input_row_count, 9);
+  EXPECT_EQ(table_scan_data.input_chunk_count, 5);
+  EXPECT_EQ(table_scan_data.output_row_count, 7);
+  // The first chunk holds the rows 0 and 1, of which none qualifies.
+  EXPECT_EQ(table_scan_data.output_chunk_count, 4);
+  EXPECT_GT(table_scan_data.allocated_bytes, 0);
+
+  const auto& projection_data = plan[2]->performance_data();
+  EXPECT_EQ(projection_data.input_row_count, 7);
+  EXPECT_EQ(projection_data.output_row_count, 7);
+
+  // a + b = 11 * a, so a < 6 qualifies.
+  const auto& second_table_scan_data = plan[3]->performance_data();
+  EXPECT_EQ(second_table_scan_data.input_row_count, 7);
+  EXPECT_EQ(second_table_scan_data.output_row_count, 4);
+  EXPECT_EQ(second_table_scan_data.output_row_count, plan[3]->get_output()->row_count());
+  EXPECT_EQ(second_table_scan_data.output_chunk_count, plan[3]->get_output()->chunk_count());
+}
+
+TEST_F(OperatorsPipelineTest, NoQualifyingRows) {
+  const auto table_wrapper = std::make_shared<TableWrapper>(_table);
+  const auto table_scan = std::make_shared<TableScan>(table_wrapper, ColumnID{0}, ScanType::OpGreaterThan, 100);
+  const auto projection = std::make_shared<Projection>(
+      table_scan, std::vector<std::shared_ptr<AbstractExpression>>{column_(_table, ColumnID{1})});
+  execute_pipelined({table_wrapper, table_scan, projection});
+
+  const auto output = projection->get_output();
+  EXPECT_EQ(output->row_count(), 0);
+  EXPECT_EQ(output->column_count(), 1);
+  EXPECT_EQ(output->column_name(ColumnID{0}), "b");
+  EXPECT_EQ(projection->performance_data().input_row_count, 0);
+}
+
+TEST_F(OperatorsPipelineTest, InvalidPipeline) {
+  const auto plan = _create_plan();
+  EXPECT_THROW(Pipeline({plan[0], plan[1]}), std::logic_error);
+  EXPECT_THROW(Pipeline({plan[1], plan[3]}), std::logic_error);
+}
+
+}  // namespace opossum
@@ -0,0 +1,82 @@
+#include "base_test.hpp"
+
+#include "expression/expression_functional.hpp"
+#include "operators/projection.hpp"
+#include "operators/table_wrapper.hpp"
+
+namespace opossum {
+
+class OperatorsProjectionTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    _table = std::make_shared<Table>(2);
+    _table->add_column("price", "double", false);
+    _table->add_column("discount", "double", true);
+    _table->add_column("quantity", "int", false);
+    _table->append({10.0, 0.1, 1});
+    _table->append({20.0, NULL_VALUE, 2});
+    _table->append({40.0, 0.5, 3});
+
+    _table_wrapper = std::make_shared<TableWrapper>(_table);
+    _table_wrapper->execute();
+  }
+
+  std::shared_ptr<Table> _table;
+  std::shared_ptr<TableWrapper> _table_wrapper;
+};
+
+TEST_F(OperatorsProjectionTest, ComputesExpressions) {
+  const auto price = column_(_table, ColumnID{0});
+  const auto discount = column_(_table, ColumnID{1});
+  const auto quantity = column_(_table, ColumnID{2});
+
+  auto projection = std::make_shared<Projection>(
+      _table_wrapper, std::vector<std::shared_ptr<AbstractExpression>>{
+                          quantity, mul_(price, sub_(value_(1), discount)), add_(quantity, value_(1))});
+  projection->execute();
+
+  const auto output = projection->get_output();
+  ASSERT_EQ(output->column_count(), 3);
+  EXPECT_EQ(output->column_name(ColumnID{0}), "quantity");
+  EXPECT_EQ(output->column_type(ColumnID{1}), "double");
+  EXPECT_TRUE(output->column_nullable(ColumnID{1}));
+  EXPECT_EQ(output->column_name(ColumnID{2}), "(quantity + 1)");
+  EXPECT_FALSE(output->column_nullable(ColumnID{2}));
+  EXPECT_EQ(output->chunk_count(), 2);
+
+  const auto first_chunk = output->get_chunk(ChunkID{0});
+  EXPECT_EQ((*first_chunk->get_segment(ColumnID{1}))[0], AllTypeVariant{9.0});
+  EXPECT_TRUE(variant_is_null((*first_chunk->get_segment(ColumnID{1}))[1]));
+  EXPECT_EQ((*first_chunk->get_segment(ColumnID{2}))[1], AllTypeVariant{3});
+  EXPECT_EQ((*output->get_chunk(ChunkID{1})->get_segment(ColumnID{1}))[0], AllTypeVariant{20.0});
+}
+
+TEST_F(OperatorsProjectionTest, ForwardsColumnSegments) {
+  auto projection = std::make_shared<Projection>(
+      _table_wrapper, std::vector<std::shared_ptr<AbstractExpression>>{column_(_table, ColumnID{1})});
+  projection->execute();
+
+  const auto output = projection->get_output();
+  for (auto chunk_id = ChunkID{0}; chunk_id < _table->chunk_count(); ++chunk_id) {
+    EXPECT_EQ(output->get_chunk(chunk_id)->get_segment(ColumnID{0}),
+              _table->get_chunk(chunk_id)->get_segment(ColumnID{1}));
+  }
+}
+
+TEST_F(OperatorsProjectionTest, EmptyInput) {
+  auto table = std::make_shared<Table>();
+  table->add_column("a", "int", false);
+  auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  auto projection = std::make_shared<Projection>(
+      table_wrapper, std::vector<std::shared_ptr<AbstractExpression>>{add_(column_(table, ColumnID{0}), value_(1))});
+  projection->execute();
+
+  const auto output = projection->get_output();
+  EXPECT_EQ(output->row_count(), 0);
+  EXPECT_EQ(output->column_count(), 1);
+  EXPECT_EQ(output->get_chunk(ChunkID{0})->column_count(), 1);
+}
+
+}  // namespace opossum
@@ -3,6 +3,8 @@
 #include "operators/print.hpp"
 #include "operators/table_scan.hpp"
 #include "operators/table_wrapper.hpp"
+#include "storage/index/group_key_index.hpp"
+#include "storage/index/sorted_index.hpp"
 #include "storage/reference_segment.hpp"
 #include "utils/load_table.hpp"
 
@@ -283,4 +285,45 @@ TEST_F(OperatorsTableScanTest, ScanOnReferenceSegmentWithNullValue) {
   }
 }
 
+TEST_F(OperatorsTableScanTest, ScanWithIndex) {
+  // Same data as _table_wrapper_even_dict, with a GroupKeyIndex on column a of the dictionary-encoded first chunk and a
+  // SortedIndex on the second chunk.
+  auto table = std::make_shared<Table>(5);
+  table->add_column("a", "int", false);
+  table->add_column("b", "int", true);
+  for (auto index = int32_t{0}; index <= 24; index += 2) {
+    table->append({index, 100 + index});
+  }
+  table->append({25, NULL_VALUE});
+  table->compress_chunk(ChunkID{0});
+  table->get_chunk(ChunkID{0})->create_index<GroupKeyIndex>({ColumnID{0}});
+  table->get_chunk(ChunkID{1})->create_index<SortedIndex>({ColumnID{0}});
+
+  auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  auto tests = std::map<ScanType, std::vector<AllTypeVariant>>{};
+  tests[ScanType::OpEquals] = {112};
+  tests[ScanType::OpNotEquals] = {100, 102, 104, 106, 108, 110, 114, 116, 118, 120, 122, 124, NULL_VALUE};
+  tests[ScanType::OpLessThan] = {100, 102, 104, 106, 108, 110};
+  tests[ScanType::OpLessThanEquals] = {100, 102, 104, 106, 108, 110, 112};
+  tests[ScanType::OpGreaterThan] = {114, 116, 118, 120, 122, 124, NULL_VALUE};
+  tests[ScanType::OpGreaterThanEquals] = {112, 114, 116, 118, 120, 122, 124, NULL_VALUE};
+
+  for (const auto& test : tests) {
+    auto scan = std::make_shared<TableScan>(table_wrapper, ColumnID{0}, test.first, 12);
+    scan->execute();
+
+    ASSERT_COLUMN_EQ(scan->get_output(), ColumnID{1}, test.second);
+  }
+
+  // Selections from the index are ordered by chunk offset.
+  auto scan = std::make_shared<TableScan>(table_wrapper, ColumnID{0}, ScanType::OpNotEquals, 4);
+  scan->execute();
+  const auto segment = scan->get_output()->get_chunk(ChunkID{0})->get_segment(ColumnID{0});
+  const auto& pos_list = *std::static_pointer_cast<const ReferenceSegment>(segment)->pos_list();
+  ASSERT_EQ(pos_list.size(), 4);
+  EXPECT_EQ(pos_list[2], (RowID{ChunkID{0}, 3}));
+}
+
 }  // namespace opossum
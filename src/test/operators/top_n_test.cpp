@@ -0,0 +1,141 @@
+#include "base_test.hpp"
+
+#include "operators/table_wrapper.hpp"
+#include "operators/top_n.hpp"
+#include "storage/dictionary_segment.hpp"
+
+namespace opossum {
+
+class OperatorsTopNTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    _table = std::make_shared<Table>(4);
+    _table->add_column("a", "int", true);
+    _table->add_column("b", "string", false);
+    _table->append({7, "seven"});
+    _table->append({3, "three"});
+    _table->append({NULL_VALUE, "null"});
+    _table->append({9, "nine"});
+    _table->append({1, "one"});
+    _table->append({7, "seven again"});
+    _table->append({5, "five"});
+    _table->append({2, "two"});
+    _table->append({8, "eight"});
+
+    _table_wrapper = std::make_shared<TableWrapper>(_table);
+    _table_wrapper->execute();
+  }
+
+  std::vector<AllTypeVariant> _column_values(const std::shared_ptr<const Table>& table, const ColumnID column_id) {
+    auto values = std::vector<AllTypeVariant>{};
+    for (auto chunk_id = ChunkID{0}; chunk_id < table->chunk_count(); ++chunk_id) {
+      const auto chunk = table->get_chunk(chunk_id);
+      for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk->size(); ++chunk_offset) {
+        values.push_back((*chunk->get_segment(column_id))[chunk_offset]);
+      }
+    }
+    return values;
+  }
+
+  std::shared_ptr<Table> _table;
+  std::shared_ptr<TableWrapper> _table_wrapper;
+};
+
+TEST_F(OperatorsTopNTest, Ascending) {
+  auto top_n = std::make_shared<TopN>(_table_wrapper, ColumnID{0}, OrderByMode::Ascending, 3);
+  top_n->execute();
+
+  const auto output = top_n->get_output();
+  EXPECT_EQ(output->column_count(), 2);
+  EXPECT_EQ(_column_values(output, ColumnID{0}), (std::vector<AllTypeVariant>{1, 2, 3}));
+  EXPECT_EQ(_column_values(output, ColumnID{1}), (std::vector<AllTypeVariant>{"one", "two", "three"}));
+}
+
+TEST_F(OperatorsTopNTest, DescendingBreaksTiesByPosition) {
+  auto top_n = std::make_shared<TopN>(_table_wrapper, ColumnID{0}, OrderByMode::Descending, 4);
+  top_n->execute();
+
+  const auto output = top_n->get_output();
+  EXPECT_EQ(_column_values(output, ColumnID{0}), (std::vector<AllTypeVariant>{9, 8, 7, 7}));
+  EXPECT_EQ(_column_values(output, ColumnID{1}),
+            (std::vector<AllTypeVariant>{"nine", "eight", "seven", "seven again"}));
+}
+
+TEST_F(OperatorsTopNTest, NullsAreSortedLast) {
+  auto top_n = std::make_shared<TopN>(_table_wrapper, ColumnID{0}, OrderByMode::Descending, 20);
+  top_n->execute();
+
+  const auto values = _column_values(top_n->get_output(), ColumnID{0});
+  ASSERT_EQ(values.size(), 9);
+  EXPECT_EQ(values[0], AllTypeVariant{9});
+  EXPECT_EQ(values[7], AllTypeVariant{1});
+  EXPECT_TRUE(variant_is_null(values[8]));
+}
+
+TEST_F(OperatorsTopNTest, StringColumn) {
+  auto top_n = std::make_shared<TopN>(_table_wrapper, ColumnID{1}, OrderByMode::Ascending, 2);
+  top_n->execute();
+
+  EXPECT_EQ(_column_values(top_n->get_output(), ColumnID{1}), (std::vector<AllTypeVariant>{"eight", "five"}));
+}
+
+TEST_F(OperatorsTopNTest, ZeroLimit) {
+  auto top_n = std::make_shared<TopN>(_table_wrapper, ColumnID{0}, OrderByMode::Ascending, 0);
+  top_n->execute();
+
+  EXPECT_EQ(top_n->get_output()->row_count(), 0);
+  EXPECT_EQ(top_n->get_output()->get_chunk(ChunkID{0})->column_count(), 2);
+}
+
+TEST_F(OperatorsTopNTest, DictionaryEncodedChunks) {
+  for (auto chunk_id = ChunkID{0}; chunk_id < _table->chunk_count(); ++chunk_id) {
+    _table->compress_chunk(chunk_id);
+  }
+
+  for (const auto order_by_mode : {OrderByMode::Ascending, OrderByMode::Descending}) {
+    auto top_n = std::make_shared<TopN>(_table_wrapper, ColumnID{0}, order_by_mode, 2);
+    top_n->execute();
+
+    const auto expected = order_by_mode == OrderByMode::Ascending ? std::vector<AllTypeVariant>{1, 2}
+                                                                  : std::vector<AllTypeVariant>{9, 8};
+    EXPECT_EQ(_column_values(top_n->get_output(), ColumnID{0}), expected);
+  }
+}
+
+TEST_F(OperatorsTopNTest, PrunesDictionaryChunks) {
+  // The values of the second chunk are all larger than the two smallest values of the first chunk, so the chunk is
+  // skipped once the heap is full.
+  auto table = std::make_shared<Table>(3);
+  table->add_column("a", "int", false);
+  for (const auto value : {2, 1, 5, 10, 11, 12}) {
+    table->append({value});
+  }
+  table->compress_chunk(ChunkID{0});
+  table->compress_chunk(ChunkID{1});
+
+  auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  auto top_n = std::make_shared<TopN>(table_wrapper, ColumnID{0}, OrderByMode::Ascending, 2);
+  top_n->execute();
+  EXPECT_EQ(_column_values(top_n->get_output(), ColumnID{0}), (std::vector<AllTypeVariant>{1, 2}));
+  EXPECT_EQ(top_n->pruned_chunk_count(), 1);
+
+  // In descending order, the second chunk holds the best values, so no chunk can be skipped.
+  auto descending_top_n = std::make_shared<TopN>(table_wrapper, ColumnID{0}, OrderByMode::Descending, 2);
+  descending_top_n->execute();
+  EXPECT_EQ(_column_values(descending_top_n->get_output(), ColumnID{0}), (std::vector<AllTypeVariant>{12, 11}));
+  EXPECT_EQ(descending_top_n->pruned_chunk_count(), 0);
+}
+
+TEST_F(OperatorsTopNTest, OutputRespectsTargetChunkSize) {
+  auto top_n = std::make_shared<TopN>(_table_wrapper, ColumnID{0}, OrderByMode::Ascending, 6);
+  top_n->execute();
+
+  const auto output = top_n->get_output();
+  EXPECT_EQ(output->row_count(), 6);
+  EXPECT_EQ(output->chunk_count(), 2);
+  EXPECT_EQ(output->get_chunk(ChunkID{0})->size(), 4);
+}
+
+}  // namespace opossum
@@ -0,0 +1,110 @@
+#include "base_test.hpp"
+
+#include <unistd.h>
+
+#include <filesystem>
+
+#include "storage/abstract_attribute_vector.hpp"
+#include "storage/chunk.hpp"
+#include "storage/chunk_file.hpp"
+#include "storage/dictionary_segment.hpp"
+#include "storage/fixed_width_integer_vector.hpp"
+#include "storage/index/sorted_index.hpp"
+#include "storage/query_memory_context.hpp"
+#include "storage/value_segment.hpp"
+
+namespace opossum {
+
+class StorageChunkFileTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    const auto int_segment = std::make_shared<ValueSegment<int32_t>>(true);
+    const auto string_segment = std::make_shared<ValueSegment<std::string>>();
+    const auto double_segment = std::make_shared<ValueSegment<double>>();
+    for (auto index = int32_t{0}; index < 600; ++index) {
+      int_segment->append(index % 5 == 0 ? AllTypeVariant{NULL_VALUE} : AllTypeVariant{index});
+      string_segment->append(index % 2 == 0 ? std::string(40, 'a' + index % 26) : std::to_string(index % 10));
+      double_segment->append(index * 0.5);
+    }
+
+    // The int segment has more than 256 distinct values and needs a 16-bit attribute vector.
+    chunk.add_segment(std::make_shared<DictionarySegment<int32_t>>(int_segment));
+    chunk.add_segment(std::make_shared<DictionarySegment<std::string>>(string_segment));
+    chunk.add_segment(std::make_shared<DictionarySegment<double>>(double_segment));
+
+    path = std::filesystem::temp_directory_path() / ("opossum_chunk_file_test_" + std::to_string(getpid()));
+  }
+
+  void TearDown() override {
+    std::filesystem::remove(path);
+  }
+
+  Chunk chunk;
+  std::vector<std::string> column_types{"int", "string", "double"};
+  std::filesystem::path path;
+};
+
+TEST_F(StorageChunkFileTest, RoundTrip) {
+  write_chunk_file(chunk, path);
+  const auto read_chunk = read_chunk_file(path, column_types);
+
+  ASSERT_EQ(read_chunk->column_count(), 3);
+  ASSERT_EQ(read_chunk->size(), 600);
+  for (auto column_id = ColumnID{0}; column_id < 3; ++column_id) {
+    const auto& segment = *chunk.get_segment(column_id);
+    const auto& read_segment = *read_chunk->get_segment(column_id);
+    EXPECT_EQ(read_segment.estimate_memory_usage(), segment.estimate_memory_usage());
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < 600; ++chunk_offset) {
+      if (variant_is_null(segment[chunk_offset])) {
+        EXPECT_TRUE(variant_is_null(read_segment[chunk_offset]));
+      } else {
+        EXPECT_EQ(read_segment[chunk_offset], segment[chunk_offset]);
+      }
+    }
+  }
+
+  const auto& read_int_segment = static_cast<const DictionarySegment<int32_t>&>(*read_chunk->get_segment(ColumnID{0}));
+  EXPECT_TRUE(read_int_segment.is_nullable());
+  EXPECT_EQ(read_int_segment.attribute_vector()->width(), 2);
+}
+
+TEST_F(StorageChunkFileTest, ReadIntoMemoryContext) {
+  write_chunk_file(chunk, path);
+  const auto memory_context = std::make_shared<QueryMemoryContext>();
+  const auto read_chunk = read_chunk_file(path, column_types, memory_context);
+
+  const auto& string_segment =
+      static_cast<const DictionarySegment<std::string>&>(*read_chunk->get_segment(ColumnID{1}));
+  EXPECT_EQ(string_segment.dictionary().get_allocator().resource(), memory_context->memory_resource());
+  for (const auto& value : string_segment.dictionary()) {
+    EXPECT_EQ(value.get_allocator().resource(), memory_context->memory_resource());
+  }
+  const auto& attribute_vector =
+      static_cast<const FixedWidthIntegerVector<uint8_t>&>(*string_segment.attribute_vector());
+  EXPECT_EQ(attribute_vector.values().get_allocator().resource(), memory_context->memory_resource());
+  EXPECT_GT(memory_context->allocated_bytes(), 600);
+}
+
+TEST_F(StorageChunkFileTest, OnlyImmutableChunks) {
+  EXPECT_TRUE(can_write_chunk_file(chunk));
+
+  auto value_chunk = Chunk{};
+  value_chunk.add_segment(std::make_shared<ValueSegment<int32_t>>());
+  EXPECT_FALSE(can_write_chunk_file(value_chunk));
+  EXPECT_THROW(write_chunk_file(value_chunk, path), std::logic_error);
+
+  chunk.create_index<SortedIndex>({ColumnID{0}});
+  EXPECT_FALSE(can_write_chunk_file(chunk));
+}
+
+TEST_F(StorageChunkFileTest, InvalidFile) {
+  EXPECT_THROW(read_chunk_file(path, column_types), std::logic_error);
+
+  write_chunk_file(chunk, path);
+  EXPECT_THROW(read_chunk_file(path, {"int", "string"}), std::logic_error);
+
+  std::filesystem::resize_file(path, std::filesystem::file_size(path) - 1);
+  EXPECT_THROW(read_chunk_file(path, column_types), std::logic_error);
+}
+
+}  // namespace opossum
@@ -3,6 +3,9 @@
 #include "resolve_type.hpp"
 #include "storage/abstract_segment.hpp"
 #include "storage/chunk.hpp"
+#include "storage/index/sorted_index.hpp"
+#include "storage/reference_segment.hpp"
+#include "storage/table.hpp"
 
 namespace opossum {
 
@@ -54,4 +57,51 @@ TEST_F(StorageChunkTest, RetrieveSegment) {
   EXPECT_EQ(segment->size(), 4);
 }
 
+TEST_F(StorageChunkTest, Indexes) {
+  chunk.add_segment(int_value_segment);
+  chunk.add_segment(string_value_segment);
+
+  const auto index = chunk.create_index<SortedIndex>({ColumnID{0}});
+  EXPECT_EQ(chunk.get_indexes().size(), 1);
+  EXPECT_EQ(chunk.get_indexes({ColumnID{0}}), (std::vector<std::shared_ptr<BaseIndex>>{index}));
+  EXPECT_TRUE(chunk.get_indexes({ColumnID{1}}).empty());
+  EXPECT_EQ(std::vector<ChunkOffset>(index->cbegin(), index->cend()), (std::vector<ChunkOffset>{2, 0, 1}));
+
+  // Indexes are not maintained on appends.
+  EXPECT_THROW(chunk.append({5, "again"}), std::logic_error);
+
+  chunk.remove_index(index);
+  EXPECT_TRUE(chunk.get_indexes().empty());
+  EXPECT_THROW(chunk.remove_index(index), std::logic_error);
+}
+
+TEST_F(StorageChunkTest, MemoryUsage) {
+  chunk.add_segment(int_value_segment);
+  chunk.add_segment(string_value_segment);
+  EXPECT_EQ(chunk.estimate_memory_usage(),
+            int_value_segment->estimate_memory_usage() + string_value_segment->estimate_memory_usage());
+
+  const auto index = chunk.create_index<SortedIndex>({ColumnID{0}});
+  EXPECT_EQ(chunk.estimate_memory_usage(), int_value_segment->estimate_memory_usage() +
+                                               string_value_segment->estimate_memory_usage() +
+                                               index->memory_consumption());
+}
+
+TEST_F(StorageChunkTest, MemoryUsageSharedPosList) {
+  const auto table = std::make_shared<Table>();
+  table->add_column("a", "int", false);
+  table->add_column("b", "int", false);
+  table->append({1, 2});
+
+  // The pos list is shared by both ReferenceSegments and is only counted once.
+  const auto pos_list = std::make_shared<PosList>(PosList{RowID{ChunkID{0}, ChunkOffset{0}}});
+  chunk.add_segment(std::make_shared<ReferenceSegment>(table, ColumnID{0}, pos_list));
+  chunk.add_segment(std::make_shared<ReferenceSegment>(table, ColumnID{1}, pos_list));
+  EXPECT_EQ(chunk.estimate_memory_usage(), pos_list->memory_usage());
+
+  const auto other_pos_list = std::make_shared<PosList>(PosList{RowID{ChunkID{0}, ChunkOffset{0}}});
+  chunk.add_segment(std::make_shared<ReferenceSegment>(table, ColumnID{0}, other_pos_list));
+  EXPECT_EQ(chunk.estimate_memory_usage(), pos_list->memory_usage() + other_pos_list->memory_usage());
+}
+
 }  // namespace opossum
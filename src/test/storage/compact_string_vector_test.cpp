@@ -0,0 +1,56 @@
+#include "base_test.hpp"
+
+#include "storage/compact_string_vector.hpp"
+
+namespace opossum {
+
+class StorageCompactStringVectorTest : public BaseTest {
+ protected:
+  // Short and long strings, strings that share their four-character prefix, and strings with zero characters.
+  const std::vector<std::string> _strings{"",
+                                          "a",
+                                          std::string("a\0", 2),
+                                          "ab",
+                                          "abcd",
+                                          "abcde",
+                                          "abcdefghijkl",
+                                          "abcdefghijklm",
+                                          "abcdefghijklmnopqrstuvwxyz",
+                                          "abce",
+                                          "b",
+                                          "\xff\xfe",
+                                          std::string("abcd\0\0\0\0\0\0\0\0\0", 13)};
+};
+
+TEST_F(StorageCompactStringVectorTest, AppendAndAccess) {
+  auto strings = CompactStringVector{};
+  EXPECT_TRUE(strings.empty());
+  for (const auto& string : _strings) {
+    strings.push_back(string);
+  }
+
+  ASSERT_EQ(strings.size(), _strings.size());
+  for (auto index = size_t{0}; index < _strings.size(); ++index) {
+    EXPECT_EQ(strings[index], _strings[index]);
+  }
+
+  // Strings with more than 12 characters are additionally stored in the arena.
+  EXPECT_EQ(strings.memory_usage(), _strings.size() * 16 + 13 + 26 + 13);
+  EXPECT_EQ(CompactStringVector{_strings}[8], _strings[8]);
+}
+
+TEST_F(StorageCompactStringVectorTest, Comparisons) {
+  const auto strings = CompactStringVector{_strings};
+  const auto sign = [](const int value) { return (value > 0) - (value < 0); };
+
+  for (const auto& value : _strings) {
+    const auto comparison_value = CompactStringVector::ComparisonValue{value};
+    for (auto index = size_t{0}; index < _strings.size(); ++index) {
+      EXPECT_EQ(sign(strings.compare(index, comparison_value)), sign(_strings[index].compare(value)))
+          << index << " vs " << value;
+      EXPECT_EQ(strings.equals(index, comparison_value), _strings[index] == value);
+    }
+  }
+}
+
+}  // namespace opossum
@@ -1,9 +1,12 @@
 #include "base_test.hpp"
 
+#include <memory_resource>
+
 #include "resolve_type.hpp"
 #include "storage/abstract_attribute_vector.hpp"
 #include "storage/abstract_segment.hpp"
 #include "storage/dictionary_segment.hpp"
+#include "storage/fixed_width_integer_vector.hpp"
 
 namespace opossum {
 
@@ -43,6 +46,36 @@ TEST_F(StorageDictionarySegmentTest, CompressSegmentString) {
   EXPECT_THROW(dict_segment->get(6), std::logic_error);
 }
 
+TEST_F(StorageDictionarySegmentTest, ValueIDsFollowDictionaryOrder) {
+  value_segment_str->append("Steve");
+  value_segment_str->append(NULL_VALUE);
+  value_segment_str->append("Bill");
+  value_segment_str->append("Steve");
+
+  const auto dict_segment = std::make_shared<DictionarySegment<std::string>>(value_segment_str);
+  const auto& attribute_vector = *dict_segment->attribute_vector();
+
+  EXPECT_EQ(attribute_vector.get(0), ValueID{2});
+  EXPECT_EQ(attribute_vector.get(1), dict_segment->null_value_id());
+  EXPECT_EQ(attribute_vector.get(2), ValueID{1});
+  EXPECT_EQ(attribute_vector.get(3), ValueID{2});
+  EXPECT_EQ(dict_segment->get(0), "Steve");
+  EXPECT_EQ(dict_segment->get(2), "Bill");
+
+  // Bounds are returned as ValueIDs, i.e., they are shifted by the NULL ValueID as well.
+  EXPECT_EQ(dict_segment->lower_bound(std::string{"Bob"}), ValueID{2});
+  EXPECT_EQ(dict_segment->upper_bound(std::string{"Bill"}), ValueID{2});
+}
+
+TEST_F(StorageDictionarySegmentTest, NonNullableSegmentHasNoNullValueID) {
+  value_segment_int->append(0);
+  value_segment_int->append(1);
+
+  const auto dict_segment = std::make_shared<DictionarySegment<int32_t>>(value_segment_int);
+  EXPECT_EQ(dict_segment->get_typed_value(0), 0);
+  EXPECT_EQ(dict_segment->get_typed_value(1), 1);
+}
+
 TEST_F(StorageDictionarySegmentTest, LowerUpperBound) {
   for (auto value = int16_t{0}; value <= 10; value += 2) {
     value_segment_int->append(value);
@@ -104,7 +137,19 @@ TEST_F(StorageDictionarySegmentTest, MemoryUsageString) {
   const auto column_str = std::make_shared<DictionarySegment<std::string>>(value_segment_str);
   const auto dict_col_str = std::dynamic_pointer_cast<opossum::DictionarySegment<std::string>>(column_str);
 
-  EXPECT_EQ(dict_col_str->estimate_memory_usage(), 1 * sizeof(std::string) + 1 * sizeof(uint8_t));
+  EXPECT_EQ(dict_col_str->estimate_memory_usage(), 1 * sizeof(std::pmr::string) + 1 * sizeof(uint8_t));
+}
+
+TEST_F(StorageDictionarySegmentTest, MemoryUsageLongString) {
+  const auto long_string = std::string(100, 'x');
+  value_segment_str->append(long_string);
+  value_segment_str->append("Hello");
+  const auto dict_segment = DictionarySegment<std::string>{value_segment_str};
+
+  // Only the long string keeps its characters on the heap.
+  const auto heap_bytes = dict_segment.dictionary()[1].capacity() + 1;
+  EXPECT_GE(heap_bytes, long_string.size() + 1);
+  EXPECT_EQ(dict_segment.estimate_memory_usage(), 2 * sizeof(std::pmr::string) + heap_bytes + 2 * sizeof(uint8_t));
 }
 
 TEST_F(StorageDictionarySegmentTest, MemoryUsageUInt8) {
@@ -139,4 +184,40 @@ TEST_F(StorageDictionarySegmentTest, MemoryUsageUInt32) {
             ((UINT16_MAX + 2)) * sizeof(int32_t) + ((UINT16_MAX + 2)) * sizeof(uint32_t));
 }
 
+TEST_F(StorageDictionarySegmentTest, MemoryResource) {
+  auto memory_resource = std::pmr::monotonic_buffer_resource{};
+  const auto value_segment = std::make_shared<ValueSegment<int32_t>>(false, &memory_resource);
+  value_segment->append(4);
+  value_segment->append(2);
+
+  // By default, the dictionary segment allocates from the memory resource of the encoded segment.
+  const auto dict_segment = DictionarySegment<int32_t>{value_segment};
+  EXPECT_EQ(dict_segment.dictionary().get_allocator().resource(), &memory_resource);
+  const auto attribute_vector =
+      std::dynamic_pointer_cast<const FixedWidthIntegerVector<uint8_t>>(dict_segment.attribute_vector());
+  ASSERT_TRUE(attribute_vector);
+  EXPECT_EQ(attribute_vector->values().get_allocator().resource(), &memory_resource);
+
+  auto other_memory_resource = std::pmr::unsynchronized_pool_resource{};
+  const auto other_dict_segment = DictionarySegment<int32_t>{value_segment, &other_memory_resource};
+  EXPECT_EQ(other_dict_segment.dictionary().get_allocator().resource(), &other_memory_resource);
+  EXPECT_EQ(other_dict_segment.get(1), 2);
+}
+
+TEST_F(StorageDictionarySegmentTest, StringMemoryResource) {
+  auto memory_resource = std::pmr::unsynchronized_pool_resource{};
+  value_segment_str->append(std::string(100, 'x'));
+  value_segment_str->append("Hello");
+
+  // The characters of long strings are allocated from the memory resource of the dictionary as well.
+  const auto dict_segment = DictionarySegment<std::string>{value_segment_str, &memory_resource};
+  for (const auto& value : dict_segment.dictionary()) {
+    EXPECT_EQ(value.get_allocator().resource(), &memory_resource);
+  }
+  EXPECT_EQ(dict_segment.get(0), std::string(100, 'x'));
+  // The segment is nullable, so ValueID 0 stands for NULL.
+  EXPECT_EQ(dict_segment.lower_bound(std::string{"Hello"}), ValueID{1});
+  EXPECT_EQ(dict_segment.upper_bound(std::string{"Hello"}), ValueID{2});
+}
+
 }  // namespace opossum
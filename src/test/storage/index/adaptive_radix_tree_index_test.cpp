@@ -0,0 +1,162 @@
+#include "base_test.hpp"
+
+#include "storage/dictionary_segment.hpp"
+#include "storage/index/adaptive_radix_tree_index.hpp"
+#include "storage/index/adaptive_radix_tree_nodes.hpp"
+#include "storage/index/sorted_index.hpp"
+
+namespace opossum {
+
+class AdaptiveRadixTreeIndexTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    _value_segment = std::make_shared<ValueSegment<std::string>>(true);
+    for (const auto& value : {"hotel", "delta", "frank", "delta", "apple", "inbox"}) {
+      _value_segment->append(value);
+    }
+    _value_segment->append(NULL_VALUE);
+    _value_segment->append("frank");
+
+    _index =
+        std::make_shared<AdaptiveRadixTreeIndex>(std::vector<std::shared_ptr<const AbstractSegment>>{_value_segment});
+  }
+
+  std::vector<ChunkOffset> _chunk_offsets(const BaseIndex::Iterator begin, const BaseIndex::Iterator end) {
+    return std::vector<ChunkOffset>(begin, end);
+  }
+
+  // Compares all lookups of an AdaptiveRadixTreeIndex with those of a SortedIndex over the same segment.
+  void _expect_same_lookups(const std::shared_ptr<const AbstractSegment>& segment,
+                            const std::vector<AllTypeVariant>& search_values) {
+    const auto art_index = AdaptiveRadixTreeIndex{{segment}};
+    const auto sorted_index = SortedIndex{{segment}};
+    EXPECT_EQ(_chunk_offsets(art_index.cbegin(), art_index.cend()),
+              _chunk_offsets(sorted_index.cbegin(), sorted_index.cend()));
+
+    for (const auto& search_value : search_values) {
+      EXPECT_EQ(art_index.lower_bound({search_value}) - art_index.cbegin(),
+                sorted_index.lower_bound({search_value}) - sorted_index.cbegin())
+          << search_value;
+      EXPECT_EQ(art_index.upper_bound({search_value}) - art_index.cbegin(),
+                sorted_index.upper_bound({search_value}) - sorted_index.cbegin())
+          << search_value;
+    }
+  }
+
+  std::shared_ptr<ValueSegment<std::string>> _value_segment;
+  std::shared_ptr<AdaptiveRadixTreeIndex> _index;
+};
+
+TEST_F(AdaptiveRadixTreeIndexTest, BinaryComparableKeys) {
+  const auto key = [](const auto value) {
+    auto binary_comparable_key = BinaryComparableKey{};
+    append_binary_comparable(value, binary_comparable_key);
+    return binary_comparable_key;
+  };
+
+  EXPECT_LT(key(int32_t{-5}), key(int32_t{-1}));
+  EXPECT_LT(key(int32_t{-1}), key(int32_t{0}));
+  EXPECT_LT(key(int32_t{255}), key(int32_t{256}));
+  EXPECT_LT(key(int64_t{-1}), key(int64_t{1}));
+  EXPECT_LT(key(-2.5f), key(-1.5f));
+  EXPECT_LT(key(-0.5), key(0.25));
+  EXPECT_EQ(key(-0.0), key(0.0));
+  EXPECT_LT(key(std::string{"a"}), key(std::string("a\0", 2)));
+  EXPECT_LT(key(std::string("a\0", 2)), key(std::string{"a\x01"}));
+  EXPECT_LT(key(std::string{"ab"}), key(std::string{"b"}));
+  EXPECT_EQ(key(int32_t{1}).size(), 4);
+  EXPECT_EQ(key(2.0).size(), 8);
+}
+
+TEST_F(AdaptiveRadixTreeIndexTest, IteratesInValueOrder) {
+  // NULLs are not indexed, equal values keep the order of their chunk offsets.
+  EXPECT_EQ(_chunk_offsets(_index->cbegin(), _index->cend()), (std::vector<ChunkOffset>{4, 1, 3, 2, 7, 0, 5}));
+  EXPECT_EQ(_index->type(), SegmentIndexType::AdaptiveRadixTree);
+  EXPECT_TRUE(_index->is_index_for({_value_segment}));
+}
+
+TEST_F(AdaptiveRadixTreeIndexTest, Lookups) {
+  const auto delta = std::vector<AllTypeVariant>{std::string{"delta"}};
+  EXPECT_EQ(_chunk_offsets(_index->lower_bound(delta), _index->upper_bound(delta)),
+            (std::vector<ChunkOffset>{1, 3}));
+
+  const auto missing = std::vector<AllTypeVariant>{std::string{"golf"}};
+  EXPECT_EQ(_index->lower_bound(missing), _index->upper_bound(missing));
+  EXPECT_EQ(_chunk_offsets(_index->lower_bound(missing), _index->cend()), (std::vector<ChunkOffset>{0, 5}));
+
+  // Search keys that end within the key of a node or leaf.
+  EXPECT_EQ(_chunk_offsets(_index->lower_bound({std::string{"d"}}), _index->upper_bound({std::string{"delt"}})),
+            (std::vector<ChunkOffset>{}));
+  EXPECT_EQ(_chunk_offsets(_index->lower_bound({std::string{"d"}}), _index->upper_bound({std::string{"deltaa"}})),
+            (std::vector<ChunkOffset>{1, 3}));
+
+  EXPECT_EQ(_index->lower_bound({std::string{"zulu"}}), _index->cend());
+  EXPECT_EQ(_index->upper_bound({std::string{"aardvark"}}), _index->cbegin());
+  EXPECT_THROW(_index->lower_bound({NULL_VALUE}), std::logic_error);
+}
+
+TEST_F(AdaptiveRadixTreeIndexTest, AllNodeSizes) {
+  // 1000 distinct integers share their two leading bytes, so that the third byte has 4 different values and the
+  // fourth one up to 256. Fewer values per node are created by using only every n-th value.
+  for (const auto step : {1, 7, 29, 101}) {
+    auto value_segment = std::make_shared<ValueSegment<int32_t>>(false);
+    auto search_values = std::vector<AllTypeVariant>{};
+    for (auto value = int32_t{-500}; value < 500; value += step) {
+      value_segment->append((value * 37) % 500);
+      search_values.emplace_back(value);
+    }
+    search_values.emplace_back(std::numeric_limits<int32_t>::min());
+    search_values.emplace_back(std::numeric_limits<int32_t>::max());
+
+    _expect_same_lookups(value_segment, search_values);
+  }
+}
+
+TEST_F(AdaptiveRadixTreeIndexTest, DataTypes) {
+  auto int64_segment = std::make_shared<ValueSegment<int64_t>>(true);
+  auto double_segment = std::make_shared<ValueSegment<double>>(true);
+  auto float_segment = std::make_shared<ValueSegment<float>>(false);
+  auto search_values = std::vector<AllTypeVariant>{};
+  for (auto value = int64_t{-300}; value < 300; ++value) {
+    int64_segment->append(value % 3 == 0 ? AllTypeVariant{NULL_VALUE} : AllTypeVariant{value * value * value});
+    double_segment->append(value % 5 == 0 ? AllTypeVariant{NULL_VALUE}
+                                          : AllTypeVariant{static_cast<double>(value) / 7});
+    float_segment->append(static_cast<float>(value % 50) * 1.5f);
+    search_values.emplace_back(value * 11);
+  }
+
+  _expect_same_lookups(int64_segment, search_values);
+  _expect_same_lookups(double_segment, search_values);
+  _expect_same_lookups(float_segment, search_values);
+}
+
+TEST_F(AdaptiveRadixTreeIndexTest, LongStrings) {
+  // Long shared prefixes are compressed into the nodes.
+  auto value_segment = std::make_shared<ValueSegment<std::string>>(false);
+  auto search_values = std::vector<AllTypeVariant>{};
+  for (auto value = 0; value < 200; ++value) {
+    const auto prefix = std::string(value % 2 == 0 ? 40 : 20, 'x');
+    value_segment->append(prefix + std::to_string(value * 7 % 200));
+    search_values.emplace_back(prefix + std::to_string(value));
+    search_values.emplace_back(prefix);
+  }
+  search_values.emplace_back(std::string{});
+
+  _expect_same_lookups(value_segment, search_values);
+  _expect_same_lookups(std::make_shared<DictionarySegment<std::string>>(value_segment), search_values);
+}
+
+TEST_F(AdaptiveRadixTreeIndexTest, EmptySegment) {
+  const auto index = AdaptiveRadixTreeIndex{{std::make_shared<ValueSegment<int32_t>>(true)}};
+  EXPECT_EQ(index.cbegin(), index.cend());
+  EXPECT_EQ(index.lower_bound({1}), index.cend());
+  EXPECT_EQ(index.upper_bound({1}), index.cend());
+  EXPECT_EQ(index.memory_consumption(), 0);
+}
+
+TEST_F(AdaptiveRadixTreeIndexTest, MemoryConsumption) {
+  // Seven chunk offsets, plus the nodes of five distinct keys.
+  EXPECT_GT(_index->memory_consumption(), 7 * sizeof(ChunkOffset) + 5 * sizeof(ARTLeaf));
+}
+
+}  // namespace opossum
@@ -0,0 +1,90 @@
+#include "base_test.hpp"
+
+#include "storage/dictionary_segment.hpp"
+#include "storage/index/composite_index.hpp"
+
+namespace opossum {
+
+class CompositeIndexTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    // (tenant_id, entity_id) pairs, row 6 has a NULL entity_id.
+    _tenant_ids = std::make_shared<ValueSegment<int32_t>>(false);
+    _entity_ids = std::make_shared<ValueSegment<std::string>>(true);
+    const auto rows = std::vector<std::pair<int32_t, AllTypeVariant>>{
+        {2, "b"}, {1, "c"}, {2, "a"}, {-1, "z"}, {1, "a"}, {2, "b"}, {1, NULL_VALUE}, {1, "ab"}};
+    for (const auto& [tenant_id, entity_id] : rows) {
+      _tenant_ids->append(tenant_id);
+      _entity_ids->append(entity_id);
+    }
+
+    _index = std::make_shared<CompositeIndex>(
+        std::vector<std::shared_ptr<const AbstractSegment>>{_tenant_ids, _entity_ids});
+  }
+
+  std::vector<ChunkOffset> _chunk_offsets(const BaseIndex::Iterator begin, const BaseIndex::Iterator end) {
+    return std::vector<ChunkOffset>(begin, end);
+  }
+
+  std::shared_ptr<ValueSegment<int32_t>> _tenant_ids;
+  std::shared_ptr<ValueSegment<std::string>> _entity_ids;
+  std::shared_ptr<CompositeIndex> _index;
+};
+
+TEST_F(CompositeIndexTest, IteratesInKeyOrder) {
+  // Ordered by tenant_id, then by entity_id. Rows with a NULL in any column are not indexed.
+  EXPECT_EQ(_chunk_offsets(_index->cbegin(), _index->cend()), (std::vector<ChunkOffset>{3, 4, 7, 1, 2, 0, 5}));
+  EXPECT_EQ(_index->type(), SegmentIndexType::Composite);
+  EXPECT_TRUE(_index->is_index_for({_tenant_ids, _entity_ids}));
+  EXPECT_FALSE(_index->is_index_for({_tenant_ids}));
+}
+
+TEST_F(CompositeIndexTest, FullKeyLookups) {
+  const auto key = std::vector<AllTypeVariant>{2, "b"};
+  EXPECT_EQ(_chunk_offsets(_index->lower_bound(key), _index->upper_bound(key)), (std::vector<ChunkOffset>{0, 5}));
+
+  const auto missing = std::vector<AllTypeVariant>{1, "b"};
+  EXPECT_EQ(_index->lower_bound(missing), _index->upper_bound(missing));
+  EXPECT_EQ(*_index->lower_bound(missing), 1);
+}
+
+TEST_F(CompositeIndexTest, PrefixLookups) {
+  const auto tenant = std::vector<AllTypeVariant>{1};
+  EXPECT_EQ(_chunk_offsets(_index->lower_bound(tenant), _index->upper_bound(tenant)),
+            (std::vector<ChunkOffset>{4, 7, 1}));
+
+  EXPECT_EQ(_index->lower_bound({3}), _index->cend());
+  EXPECT_EQ(_index->upper_bound({-2}), _index->cbegin());
+  EXPECT_EQ(_index->lower_bound({}), _index->cbegin());
+  EXPECT_EQ(_index->upper_bound({}), _index->cend());
+}
+
+TEST_F(CompositeIndexTest, EqualityAndRange) {
+  // tenant_id = 1 AND entity_id BETWEEN "a" AND "b": "ab" is included, "c" is not.
+  EXPECT_EQ(_chunk_offsets(_index->lower_bound({1, "a"}), _index->upper_bound({1, "b"})),
+            (std::vector<ChunkOffset>{4, 7}));
+
+  // tenant_id = 1 AND entity_id > "a".
+  EXPECT_EQ(_chunk_offsets(_index->upper_bound({1, "a"}), _index->upper_bound({1})), (std::vector<ChunkOffset>{7, 1}));
+}
+
+TEST_F(CompositeIndexTest, FixedWidthKeys) {
+  auto entity_ids = std::make_shared<ValueSegment<int64_t>>(false);
+  for (const auto entity_id : std::vector<int64_t>{7, -3, 5, 5, int64_t{1} << 40, 0, 9, 2}) {
+    entity_ids->append(entity_id);
+  }
+  const auto dictionary_segment = std::make_shared<DictionarySegment<int32_t>>(_tenant_ids);
+  const auto index = CompositeIndex{{dictionary_segment, entity_ids}};
+
+  EXPECT_EQ(_chunk_offsets(index.cbegin(), index.cend()), (std::vector<ChunkOffset>{3, 1, 7, 6, 4, 5, 2, 0}));
+  EXPECT_EQ(_chunk_offsets(index.lower_bound({1, 0}), index.upper_bound({1, 9})), (std::vector<ChunkOffset>{7, 6}));
+  EXPECT_EQ(index.memory_consumption(), 8 * (sizeof(ChunkOffset) + sizeof(int32_t) + sizeof(int64_t)));
+}
+
+TEST_F(CompositeIndexTest, InvalidSegments) {
+  EXPECT_THROW(CompositeIndex{{}}, std::logic_error);
+  EXPECT_THROW((CompositeIndex{{_tenant_ids, std::make_shared<ValueSegment<int32_t>>(false)}}), std::logic_error);
+  EXPECT_THROW(_index->lower_bound({1, NULL_VALUE}), std::logic_error);
+}
+
+}  // namespace opossum
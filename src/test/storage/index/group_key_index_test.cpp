@@ -0,0 +1,69 @@
+#include "base_test.hpp"
+
+#include "storage/dictionary_segment.hpp"
+#include "storage/index/group_key_index.hpp"
+
+namespace opossum {
+
+class GroupKeyIndexTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    auto value_segment = std::make_shared<ValueSegment<std::string>>(true);
+    for (const auto& value : {"hotel", "delta", "frank", "delta", "apple", "inbox"}) {
+      value_segment->append(value);
+    }
+    value_segment->append(NULL_VALUE);
+    value_segment->append("frank");
+
+    // Dictionary: apple, delta, frank, hotel, inbox.
+    _dictionary_segment = std::make_shared<DictionarySegment<std::string>>(value_segment);
+    _index = std::make_shared<GroupKeyIndex>(std::vector<std::shared_ptr<const AbstractSegment>>{_dictionary_segment});
+  }
+
+  std::vector<ChunkOffset> _chunk_offsets(const BaseIndex::Iterator begin, const BaseIndex::Iterator end) {
+    return std::vector<ChunkOffset>(begin, end);
+  }
+
+  std::shared_ptr<DictionarySegment<std::string>> _dictionary_segment;
+  std::shared_ptr<GroupKeyIndex> _index;
+};
+
+TEST_F(GroupKeyIndexTest, GroupsChunkOffsetsByValue) {
+  EXPECT_EQ(_chunk_offsets(_index->cbegin(), _index->cend()), (std::vector<ChunkOffset>{4, 1, 3, 2, 7, 0, 5}));
+  EXPECT_EQ(_index->type(), SegmentIndexType::GroupKey);
+  EXPECT_TRUE(_index->is_index_for({_dictionary_segment}));
+}
+
+TEST_F(GroupKeyIndexTest, Lookups) {
+  const auto frank = std::vector<AllTypeVariant>{std::string{"frank"}};
+  EXPECT_EQ(_chunk_offsets(_index->lower_bound(frank), _index->upper_bound(frank)), (std::vector<ChunkOffset>{2, 7}));
+
+  const auto golf = std::vector<AllTypeVariant>{std::string{"golf"}};
+  EXPECT_EQ(_index->lower_bound(golf), _index->upper_bound(golf));
+  EXPECT_EQ(_chunk_offsets(_index->cbegin(), _index->lower_bound(golf)), (std::vector<ChunkOffset>{4, 1, 3, 2, 7}));
+
+  EXPECT_EQ(_index->lower_bound({std::string{"zulu"}}), _index->cend());
+  EXPECT_EQ(_index->upper_bound({std::string{"inbox"}}), _index->cend());
+  EXPECT_EQ(_index->upper_bound({std::string{"aardvark"}}), _index->cbegin());
+}
+
+TEST_F(GroupKeyIndexTest, NonNullableSegment) {
+  auto value_segment = std::make_shared<ValueSegment<int32_t>>();
+  for (const auto value : {3, 1, 3, 2, 1}) {
+    value_segment->append(value);
+  }
+  const auto dictionary_segment = std::make_shared<DictionarySegment<int32_t>>(value_segment);
+  const auto index = GroupKeyIndex{{dictionary_segment}};
+
+  EXPECT_EQ(_chunk_offsets(index.cbegin(), index.cend()), (std::vector<ChunkOffset>{1, 4, 3, 0, 2}));
+  EXPECT_EQ(_chunk_offsets(index.lower_bound({2}), index.cend()), (std::vector<ChunkOffset>{3, 0, 2}));
+  // Three dictionary entries plus the end offset, and one offset per row.
+  EXPECT_EQ(index.memory_consumption(), (4 + 5) * sizeof(ChunkOffset));
+}
+
+TEST_F(GroupKeyIndexTest, RequiresDictionarySegment) {
+  const auto value_segment = std::make_shared<ValueSegment<int32_t>>();
+  EXPECT_THROW(GroupKeyIndex{{value_segment}}, std::logic_error);
+}
+
+}  // namespace opossum
@@ -0,0 +1,63 @@
+#include "base_test.hpp"
+
+#include "storage/dictionary_segment.hpp"
+#include "storage/index/sorted_index.hpp"
+
+namespace opossum {
+
+class SortedIndexTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    _value_segment = std::make_shared<ValueSegment<std::string>>(true);
+    for (const auto& value : {"hotel", "delta", "frank", "delta", "apple", "inbox"}) {
+      _value_segment->append(value);
+    }
+    _value_segment->append(NULL_VALUE);
+    _value_segment->append("frank");
+
+    _index = std::make_shared<SortedIndex>(std::vector<std::shared_ptr<const AbstractSegment>>{_value_segment});
+  }
+
+  std::vector<ChunkOffset> _chunk_offsets(const BaseIndex::Iterator begin, const BaseIndex::Iterator end) {
+    return std::vector<ChunkOffset>(begin, end);
+  }
+
+  std::shared_ptr<ValueSegment<std::string>> _value_segment;
+  std::shared_ptr<SortedIndex> _index;
+};
+
+TEST_F(SortedIndexTest, IteratesInValueOrder) {
+  // NULLs are not indexed, equal values keep the order of their chunk offsets.
+  EXPECT_EQ(_chunk_offsets(_index->cbegin(), _index->cend()), (std::vector<ChunkOffset>{4, 1, 3, 2, 7, 0, 5}));
+  EXPECT_EQ(_index->type(), SegmentIndexType::Sorted);
+}
+
+TEST_F(SortedIndexTest, Lookups) {
+  const auto delta = std::vector<AllTypeVariant>{std::string{"delta"}};
+  EXPECT_EQ(_chunk_offsets(_index->lower_bound(delta), _index->upper_bound(delta)),
+            (std::vector<ChunkOffset>{1, 3}));
+
+  const auto missing = std::vector<AllTypeVariant>{std::string{"golf"}};
+  EXPECT_EQ(_index->lower_bound(missing), _index->upper_bound(missing));
+  EXPECT_EQ(_chunk_offsets(_index->lower_bound(missing), _index->cend()), (std::vector<ChunkOffset>{0, 5}));
+
+  EXPECT_EQ(_index->lower_bound({std::string{"zulu"}}), _index->cend());
+  EXPECT_EQ(_index->upper_bound({std::string{"aardvark"}}), _index->cbegin());
+  EXPECT_THROW(_index->lower_bound({NULL_VALUE}), std::logic_error);
+}
+
+TEST_F(SortedIndexTest, DictionarySegment) {
+  const auto dictionary_segment = std::make_shared<DictionarySegment<std::string>>(_value_segment);
+  const auto index = SortedIndex{{dictionary_segment}};
+
+  const auto frank = std::vector<AllTypeVariant>{std::string{"frank"}};
+  EXPECT_EQ(_chunk_offsets(index.lower_bound(frank), index.upper_bound(frank)), (std::vector<ChunkOffset>{2, 7}));
+  EXPECT_TRUE(index.is_index_for({dictionary_segment}));
+  EXPECT_FALSE(index.is_index_for({_value_segment}));
+}
+
+TEST_F(SortedIndexTest, MemoryConsumption) {
+  EXPECT_EQ(_index->memory_consumption(), 7 * (sizeof(ChunkOffset) + sizeof(std::string)));
+}
+
+}  // namespace opossum
@@ -0,0 +1,165 @@
+#include "base_test.hpp"
+
+#include <memory_resource>
+
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "storage/materialize.hpp"
+#include "storage/pos_list_utils.hpp"
+#include "storage/query_memory_context.hpp"
+#include "storage/reference_segment.hpp"
+#include "storage/table.hpp"
+
+namespace opossum {
+
+class PosListTest : public BaseTest {};
+
+TEST_F(PosListTest, EntireChunkPosList) {
+  const auto pos_list = EntireChunkPosList{ChunkID{3}, 5};
+  EXPECT_EQ(pos_list.size(), 5);
+  EXPECT_EQ(pos_list[4], (RowID{ChunkID{3}, 4}));
+  EXPECT_EQ(pos_list.single_chunk_id(), ChunkID{3});
+  EXPECT_EQ(pos_list.memory_usage(), 0);
+}
+
+TEST_F(PosListTest, SingleChunkPosList) {
+  const auto pos_list = SingleChunkPosList{ChunkID{1}, {7, 2, 9}};
+  EXPECT_EQ(pos_list.size(), 3);
+  EXPECT_EQ(pos_list[1], (RowID{ChunkID{1}, 2}));
+  EXPECT_EQ(pos_list.single_chunk_id(), ChunkID{1});
+  EXPECT_EQ(pos_list.memory_usage(), 3 * sizeof(ChunkOffset));
+}
+
+TEST_F(PosListTest, RowIDPosList) {
+  const auto pos_list = PosList{RowID{ChunkID{0}, 1}, NULL_ROW_ID};
+  EXPECT_EQ(pos_list.size(), 2);
+  EXPECT_TRUE(pos_list[1].is_null());
+  EXPECT_FALSE(pos_list.single_chunk_id());
+  EXPECT_EQ(pos_list.memory_usage(), 2 * sizeof(RowID));
+}
+
+TEST_F(PosListTest, RowIDPosListMemoryResource) {
+  auto memory_resource = std::pmr::monotonic_buffer_resource{};
+  auto pos_list = PosList{&memory_resource};
+  pos_list.emplace_back(RowID{ChunkID{2}, 3});
+  EXPECT_EQ(pos_list.get_allocator().resource(), &memory_resource);
+  EXPECT_EQ(pos_list[0], (RowID{ChunkID{2}, 3}));
+}
+
+TEST_F(PosListTest, BitmapPosListWithArraysAndBitmaps) {
+  // The first block is dense and stored as a bitmap, the second one is sparse and stored as an array, the third block
+  // is empty.
+  auto chunk_offsets = std::vector<ChunkOffset>{};
+  for (auto chunk_offset = ChunkOffset{0}; chunk_offset < BitmapPosList::BLOCK_SIZE; chunk_offset += 3) {
+    chunk_offsets.push_back(chunk_offset);
+  }
+  const auto dense_count = chunk_offsets.size();
+  chunk_offsets.push_back(BitmapPosList::BLOCK_SIZE + 5);
+  chunk_offsets.push_back(BitmapPosList::BLOCK_SIZE + 100);
+  chunk_offsets.push_back(3 * BitmapPosList::BLOCK_SIZE + 1);
+
+  const auto pos_list = BitmapPosList{ChunkID{2}, chunk_offsets};
+  EXPECT_EQ(pos_list.size(), chunk_offsets.size());
+  EXPECT_EQ(pos_list.single_chunk_id(), ChunkID{2});
+  EXPECT_EQ(pos_list.chunk_offsets(), chunk_offsets);
+  for (auto index = size_t{0}; index < chunk_offsets.size(); ++index) {
+    EXPECT_EQ(pos_list[index], (RowID{ChunkID{2}, chunk_offsets[index]}));
+  }
+
+  // One bit per row for the dense block, two bytes per position for the others.
+  EXPECT_LT(pos_list.memory_usage(), BitmapPosList::BLOCK_SIZE / 8 + 3 * sizeof(uint16_t) + 512);
+  EXPECT_LT(pos_list.memory_usage(), dense_count * sizeof(ChunkOffset));
+}
+
+TEST_F(PosListTest, MakeSingleChunkPosList) {
+  const auto entire_chunk = make_single_chunk_pos_list(ChunkID{0}, 4, {0, 1, 2, 3});
+  EXPECT_TRUE(std::dynamic_pointer_cast<const EntireChunkPosList>(entire_chunk));
+  EXPECT_EQ(entire_chunk->size(), 4);
+
+  const auto dense = make_single_chunk_pos_list(ChunkID{0}, 64, {1, 5, 9});
+  EXPECT_TRUE(std::dynamic_pointer_cast<const BitmapPosList>(dense));
+  EXPECT_EQ((*dense)[2], (RowID{ChunkID{0}, 9}));
+
+  const auto sparse = make_single_chunk_pos_list(ChunkID{0}, 1000, {1, 5, 9});
+  EXPECT_TRUE(std::dynamic_pointer_cast<const SingleChunkPosList>(sparse));
+  EXPECT_EQ((*sparse)[1], (RowID{ChunkID{0}, 5}));
+}
+
+TEST_F(PosListTest, BuffersAreAllocatedFromMemoryContext) {
+  const auto memory_context = std::make_shared<QueryMemoryContext>();
+  const auto memory_resource = memory_context->memory_resource();
+
+  const auto sparse = std::dynamic_pointer_cast<const SingleChunkPosList>(
+      make_single_chunk_pos_list(ChunkID{0}, 1000, {1, 5, 9}, memory_context));
+  ASSERT_TRUE(sparse);
+  EXPECT_EQ(sparse->chunk_offsets().get_allocator().resource(), memory_resource);
+
+  const auto dense = std::dynamic_pointer_cast<const BitmapPosList>(
+      make_single_chunk_pos_list(ChunkID{0}, 64, {1, 5, 9}, memory_context));
+  ASSERT_TRUE(dense);
+  EXPECT_EQ(dense->memory_resource(), memory_resource);
+
+  // Scanning a ReferenceSegment with a PosList resolves its positions into a new PosList.
+  auto data_table = std::make_shared<Table>();
+  data_table->add_column("a", "int", false);
+  for (auto value = int32_t{0}; value < 4; ++value) {
+    data_table->append({value});
+  }
+  const auto input_pos_list = std::make_shared<PosList>(
+      PosList{RowID{ChunkID{0}, 3}, RowID{ChunkID{0}, 0}, RowID{ChunkID{0}, 2}});
+  const auto chunk = std::make_shared<Chunk>();
+  chunk->add_segment(std::make_shared<ReferenceSegment>(data_table, ColumnID{0}, input_pos_list));
+  auto reference_table = std::make_shared<Table>();
+  reference_table->add_column_definition("a", "int", false);
+  reference_table->emplace_chunk(chunk);
+
+  const auto table_wrapper = std::make_shared<TableWrapper>(reference_table);
+  table_wrapper->set_memory_context(memory_context);
+  table_wrapper->execute();
+  const auto table_scan = std::make_shared<TableScan>(table_wrapper, ColumnID{0}, ScanType::OpGreaterThan, 0);
+  table_scan->execute();
+
+  const auto output_segment = std::dynamic_pointer_cast<const ReferenceSegment>(
+      table_scan->get_output()->get_chunk(ChunkID{0})->get_segment(ColumnID{0}));
+  ASSERT_TRUE(output_segment);
+  const auto output_pos_list = std::dynamic_pointer_cast<const PosList>(output_segment->pos_list());
+  ASSERT_TRUE(output_pos_list);
+  EXPECT_EQ(output_pos_list->size(), 2);
+  EXPECT_EQ(output_pos_list->get_allocator().resource(), memory_resource);
+}
+
+TEST_F(PosListTest, ReferenceSegmentsMaterializeAllRepresentations) {
+  auto table = std::make_shared<Table>(4);
+  table->add_column("a", "int", true);
+  for (auto value = int32_t{0}; value < 8; ++value) {
+    table->append({value == 6 ? AllTypeVariant{NULL_VALUE} : AllTypeVariant{value}});
+  }
+  table->compress_chunk(ChunkID{1});
+
+  const auto materialize = [&](const std::shared_ptr<const AbstractPosList>& pos_list) {
+    const auto segment = ReferenceSegment{table, ColumnID{0}, pos_list};
+    auto values = std::vector<int32_t>{};
+    auto nulls = std::vector<bool>{};
+    materialize_values_and_nulls(segment, values, nulls);
+    EXPECT_EQ(segment.size(), values.size());
+    for (auto index = ChunkOffset{0}; index < segment.size(); ++index) {
+      EXPECT_EQ(nulls[index], variant_is_null(segment[index]));
+      if (!nulls[index]) {
+        EXPECT_EQ(values[index], type_cast<int32_t>(segment[index]));
+      }
+    }
+    return std::pair{values, nulls};
+  };
+
+  EXPECT_EQ(materialize(std::make_shared<EntireChunkPosList>(ChunkID{0}, 4)).first,
+            (std::vector<int32_t>{0, 1, 2, 3}));
+  EXPECT_EQ(materialize(std::make_shared<SingleChunkPosList>(ChunkID{1}, std::pmr::vector<ChunkOffset>{3, 0})).first,
+            (std::vector<int32_t>{7, 4}));
+
+  const auto [bitmap_values, bitmap_nulls] =
+      materialize(std::make_shared<BitmapPosList>(ChunkID{1}, std::vector<ChunkOffset>{1, 2}));
+  EXPECT_EQ(bitmap_values[0], 5);
+  EXPECT_TRUE(bitmap_nulls[1]);
+}
+
+}  // namespace opossum
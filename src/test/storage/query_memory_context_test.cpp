@@ -0,0 +1,117 @@
+#include "base_test.hpp"
+
+#include <sstream>
+
+#include "expression/expression_functional.hpp"
+#include "operators/materialize.hpp"
+#include "operators/projection.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "storage/query_memory_context.hpp"
+
+namespace opossum {
+
+class StorageQueryMemoryContextTest : public BaseTest {
+ protected:
+  void TearDown() override {
+    QueryMemoryContext::set_memory_budget(QueryMemoryContext::UNLIMITED_MEMORY_BUDGET);
+  }
+
+  void SetUp() override {
+    _table = std::make_shared<Table>(100);
+    _table->add_column("a", "int", false);
+    _table->add_column("b", "string", true);
+    for (auto index = int32_t{0}; index < 1000; ++index) {
+      _table->append({index, index % 7 == 0 ? AllTypeVariant{NULL_VALUE} : AllTypeVariant{std::to_string(index)}});
+    }
+  }
+
+  // Scans, projects, and materializes the table. The operators of the plan are released when it returns.
+  std::shared_ptr<const Table> _execute_plan(const std::shared_ptr<QueryMemoryContext>& memory_context) {
+    const auto table_wrapper = std::make_shared<TableWrapper>(_table);
+    table_wrapper->set_memory_context(memory_context);
+    const auto scan = std::make_shared<TableScan>(table_wrapper, ColumnID{0}, ScanType::OpGreaterThanEquals, 500);
+    const auto projection = std::make_shared<Projection>(
+        scan, std::vector<std::shared_ptr<AbstractExpression>>{column_(_table, ColumnID{1}),
+                                                               mul_(column_(_table, ColumnID{0}), value_(2))});
+    const auto materialize = std::make_shared<Materialize>(projection);
+    const auto operators = std::vector<std::shared_ptr<AbstractOperator>>{table_wrapper, scan, projection, materialize};
+    for (const auto& op : operators) {
+      op->execute();
+      EXPECT_EQ(op->memory_context(), memory_context);
+    }
+    return materialize->get_output();
+  }
+
+  // NULL_VALUE does not compare equal to itself, so tables are compared by their printed values.
+  std::vector<std::string> _printed_values(const std::shared_ptr<const Table>& table) {
+    auto printed_values = std::vector<std::string>{};
+    for (auto chunk_id = ChunkID{0}; chunk_id < table->chunk_count(); ++chunk_id) {
+      const auto chunk = table->get_chunk(chunk_id);
+      for (auto column_id = ColumnID{0}; column_id < chunk->column_count(); ++column_id) {
+        for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk->size(); ++chunk_offset) {
+          auto stream = std::stringstream{};
+          stream << (*chunk->get_segment(column_id))[chunk_offset];
+          printed_values.push_back(stream.str());
+        }
+      }
+    }
+    return printed_values;
+  }
+
+  std::shared_ptr<Table> _table;
+};
+
+TEST_F(StorageQueryMemoryContextTest, ProducesSameResultAsHeap) {
+  const auto memory_context = std::make_shared<QueryMemoryContext>();
+  const auto output = _execute_plan(memory_context);
+  EXPECT_EQ(output->memory_context(), memory_context);
+  EXPECT_EQ(output->memory_resource(), memory_context->memory_resource());
+  EXPECT_EQ(output->row_count(), 500);
+  EXPECT_EQ(_printed_values(output), _printed_values(_execute_plan(nullptr)));
+
+  EXPECT_GT(memory_context->allocated_bytes(), 0);
+  EXPECT_GE(memory_context->peak_allocated_bytes(), memory_context->allocated_bytes());
+
+  const auto& segment = static_cast<const ValueSegment<int32_t>&>(*output->get_chunk(ChunkID{0})->get_segment(
+      ColumnID{1}));
+  EXPECT_EQ(segment.memory_resource(), memory_context->memory_resource());
+}
+
+TEST_F(StorageQueryMemoryContextTest, ReleasedWithLastResult) {
+  auto memory_context = std::make_shared<QueryMemoryContext>();
+  const auto weak_memory_context = std::weak_ptr<QueryMemoryContext>{memory_context};
+  auto output = _execute_plan(memory_context);
+  memory_context = nullptr;
+
+  // A segment keeps the memory context alive even after its table is gone.
+  auto segment = output->get_chunk(ChunkID{0})->get_segment(ColumnID{0});
+  output = nullptr;
+  EXPECT_FALSE(weak_memory_context.expired());
+  EXPECT_EQ(type_cast<std::string>((*segment)[0]), "500");
+
+  segment = nullptr;
+  EXPECT_TRUE(weak_memory_context.expired());
+}
+
+TEST_F(StorageQueryMemoryContextTest, MemoryBudget) {
+  EXPECT_EQ(QueryMemoryContext::memory_budget(), QueryMemoryContext::UNLIMITED_MEMORY_BUDGET);
+  EXPECT_EQ(QueryMemoryContext::total_allocated_bytes(), 0);
+
+  auto output = _execute_plan(std::make_shared<QueryMemoryContext>());
+  const auto held_bytes = output->memory_context()->allocated_bytes();
+  const auto peak_bytes = output->memory_context()->peak_allocated_bytes();
+  EXPECT_EQ(QueryMemoryContext::total_allocated_bytes(), held_bytes);
+
+  // While the first result is alive, a second query does not fit into the budget.
+  QueryMemoryContext::set_memory_budget(peak_bytes);
+  EXPECT_THROW(_execute_plan(std::make_shared<QueryMemoryContext>()), std::logic_error);
+  EXPECT_EQ(QueryMemoryContext::total_allocated_bytes(), held_bytes);
+
+  // Once it is released, the budget suffices for the second query.
+  output = nullptr;
+  EXPECT_EQ(QueryMemoryContext::total_allocated_bytes(), 0);
+  EXPECT_EQ(_execute_plan(std::make_shared<QueryMemoryContext>())->row_count(), 500);
+}
+
+}  // namespace opossum
@@ -4,6 +4,7 @@
 #include "operators/get_table.hpp"
 #include "operators/print.hpp"
 #include "operators/table_scan.hpp"
+#include "storage/materialize.hpp"
 #include "storage/reference_segment.hpp"
 #include "storage/storage_manager.hpp"
 
@@ -92,4 +93,49 @@ TEST_F(ReferenceSegmentTest, RetrieveNullValueFromNullRowID) {
   EXPECT_EQ(ref_segment[ChunkOffset{3}], segment[ChunkOffset{2}]);
 }
 
+TEST_F(ReferenceSegmentTest, GathersGroupedPositions) {
+  // The second chunk of _test_table_dict is dictionary-encoded and holds the values 10 to 18.
+  auto pos_list = std::make_shared<PosList>(std::initializer_list<RowID>(
+      {RowID{ChunkID{0}, 4}, RowID{ChunkID{0}, 1}, NULL_ROW_ID, RowID{ChunkID{1}, 3}, RowID{ChunkID{2}, 0}}));
+  auto reference_segment = ReferenceSegment(_test_table_dict, ColumnID{0}, pos_list);
+
+  auto values = std::vector<int32_t>{-1};
+  auto nulls = std::vector<bool>{false};
+  materialize_values_and_nulls(reference_segment, values, nulls);
+
+  EXPECT_EQ(values.size(), 6);
+  EXPECT_EQ(values[1], 8);
+  EXPECT_EQ(values[2], 2);
+  EXPECT_EQ(values[4], 16);
+  EXPECT_EQ(values[5], 20);
+  EXPECT_EQ(nulls, (std::vector<bool>{false, false, false, true, false, false}));
+}
+
+TEST_F(ReferenceSegmentTest, GathersUnorderedPositions) {
+  _test_table->append({1, NULL_VALUE});
+  _test_table->compress_chunk(ChunkID{0});
+
+  auto pos_list = std::make_shared<PosList>(std::initializer_list<RowID>(
+      {RowID{ChunkID{1}, 1}, RowID{ChunkID{0}, 2}, RowID{ChunkID{1}, 2}, RowID{ChunkID{0}, 0}, NULL_ROW_ID}));
+  auto reference_segment = ReferenceSegment(_test_table, ColumnID{1}, pos_list);
+
+  auto values = std::vector<float>{};
+  auto nulls = std::vector<bool>{};
+  materialize_values_and_nulls(reference_segment, values, nulls);
+
+  EXPECT_EQ(values.size(), 5);
+  EXPECT_FLOAT_EQ(values[0], 458.7f);
+  EXPECT_FLOAT_EQ(values[1], 458.7f);
+  EXPECT_FLOAT_EQ(values[3], 456.7f);
+  EXPECT_EQ(nulls, (std::vector<bool>{false, false, true, false, true}));
+
+  for (auto chunk_offset = ChunkOffset{0}; chunk_offset < reference_segment.size(); ++chunk_offset) {
+    const auto value = reference_segment[chunk_offset];
+    EXPECT_EQ(variant_is_null(value), nulls[chunk_offset]);
+    if (!nulls[chunk_offset]) {
+      EXPECT_FLOAT_EQ(type_cast<float>(value), values[chunk_offset]);
+    }
+  }
+}
+
 }  // namespace opossum
@@ -1,6 +1,7 @@
 #include "base_test.hpp"
 
 #include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
 
 namespace opossum {
 
@@ -46,4 +47,34 @@ TEST_F(StorageStorageManagerTest, HasTable) {
   EXPECT_EQ(storage_manager.has_table("first_table"), true);
 }
 
+TEST_F(StorageStorageManagerTest, MemoryUsage) {
+  auto& storage_manager = StorageManager::get();
+  EXPECT_EQ(storage_manager.estimate_memory_usage(), 0);
+
+  const auto table = storage_manager.get_table("second_table");
+  table->add_column("a", "int", false);
+  table->append({1});
+  EXPECT_EQ(storage_manager.estimate_memory_usage(), table->estimate_memory_usage());
+  EXPECT_EQ(storage_manager.estimate_memory_usage(), sizeof(int32_t));
+}
+
+TEST_F(StorageStorageManagerTest, EvictColdChunks) {
+  auto& storage_manager = StorageManager::get();
+  const auto table_a = storage_manager.get_table("first_table");
+  const auto table_b = storage_manager.get_table("second_table");
+  for (const auto& table : {table_a, table_b}) {
+    table->add_column("a", "int", false);
+    table->append({1});
+    table->compress_chunk(ChunkID{0});
+  }
+
+  // The chunk of the second table is accessed last and stays in memory.
+  table_a->get_chunk(ChunkID{0});
+  table_b->get_chunk(ChunkID{0});
+  EXPECT_EQ(storage_manager.evict_cold_chunks(table_b->estimate_memory_usage()), 1);
+  EXPECT_TRUE(table_a->is_chunk_evicted(ChunkID{0}));
+  EXPECT_FALSE(table_b->is_chunk_evicted(ChunkID{0}));
+  EXPECT_EQ(storage_manager.estimate_memory_usage(), table_b->estimate_memory_usage());
+}
+
 }  // namespace opossum
@@ -1,5 +1,8 @@
 #include "base_test.hpp"
 
+#include <thread>
+
+#include "storage/index/sorted_index.hpp"
 #include "storage/table.hpp"
 
 namespace opossum {
@@ -33,6 +36,21 @@ TEST_F(StorageTableTest, GetChunk) {
   EXPECT_THROW(table.get_chunk(ChunkID{7}), std::logic_error);
 }
 
+TEST_F(StorageTableTest, ReplaceChunk) {
+  table.append({4, "Hello,"});
+  auto other_table = Table{2};
+  other_table.add_column("col_1", "int", false);
+  other_table.add_column("col_2", "string", true);
+  other_table.append({6, "world"});
+  other_table.append({3, "!"});
+
+  const auto chunk = other_table.get_chunk(ChunkID{0});
+  table.replace_chunk(ChunkID{0}, chunk);
+  EXPECT_EQ(table.get_chunk(ChunkID{0}), chunk);
+  EXPECT_EQ(table.row_count(), 2);
+  EXPECT_THROW(table.replace_chunk(ChunkID{1}, chunk), std::logic_error);
+}
+
 TEST_F(StorageTableTest, ColumnCount) {
   EXPECT_EQ(table.column_count(), 2);
 }
@@ -107,4 +125,149 @@ TEST_F(StorageTableTest, AppendWithEncodedSegments) {
   EXPECT_EQ(table.chunk_count(), 2);
 }
 
+TEST_F(StorageTableTest, AppendWithIndexedChunk) {
+  table.append({1, "foo"});
+  table.get_chunk(ChunkID{0})->create_index<SortedIndex>({ColumnID{0}});
+
+  // The index would be outdated by an append, so a new chunk is started although the indexed one is not full.
+  table.append({2, "bar"});
+  EXPECT_EQ(table.row_count(), 2);
+  EXPECT_EQ(table.chunk_count(), 2);
+  EXPECT_EQ(table.get_chunk(ChunkID{0})->size(), 1);
+}
+
+TEST_F(StorageTableTest, MemoryUsage) {
+  EXPECT_EQ(table.estimate_memory_usage(), 0);
+  table.append({4, "Hello,"});
+  table.append({6, NULL_VALUE});
+  table.append({3, "!"});
+  table.compress_chunk(ChunkID{0});
+
+  const auto expected_memory_usage =
+      table.get_chunk(ChunkID{0})->estimate_memory_usage() + table.get_chunk(ChunkID{1})->estimate_memory_usage();
+  EXPECT_GT(table.get_chunk(ChunkID{1})->estimate_memory_usage(), 0);
+  EXPECT_EQ(table.estimate_memory_usage(), expected_memory_usage);
+}
+
+TEST_F(StorageTableTest, EvictChunk) {
+  table.append({4, "Hello,"});
+  table.append({6, NULL_VALUE});
+  table.append({3, "!"});
+  const auto row_count = table.row_count();
+
+  // Only immutable, i.e., dictionary-encoded, chunks can be evicted.
+  EXPECT_EQ(table.evict_chunk(ChunkID{0}), 0);
+  table.compress_chunk(ChunkID{0});
+  const auto chunk_memory_usage = table.get_chunk(ChunkID{0})->estimate_memory_usage();
+  const auto value = (*table.get_chunk(ChunkID{0})->get_segment(ColumnID{1}))[1];
+
+  EXPECT_EQ(table.evict_chunk(ChunkID{0}), chunk_memory_usage);
+  EXPECT_TRUE(table.is_chunk_evicted(ChunkID{0}));
+  EXPECT_FALSE(table.is_chunk_evicted(ChunkID{1}));
+  EXPECT_EQ(table.evict_chunk(ChunkID{0}), 0);
+  EXPECT_EQ(table.row_count(), row_count);
+  EXPECT_EQ(table.estimate_memory_usage(), table.get_chunk(ChunkID{1})->estimate_memory_usage());
+
+  // The chunk is loaded back on access.
+  const auto chunk = table.get_chunk(ChunkID{0});
+  EXPECT_FALSE(table.is_chunk_evicted(ChunkID{0}));
+  EXPECT_EQ(chunk->estimate_memory_usage(), chunk_memory_usage);
+  EXPECT_EQ((*chunk->get_segment(ColumnID{0}))[1], AllTypeVariant{6});
+  EXPECT_TRUE(variant_is_null((*chunk->get_segment(ColumnID{1}))[1]));
+  EXPECT_TRUE(variant_is_null(value));
+  EXPECT_EQ((*chunk->get_segment(ColumnID{1}))[0], AllTypeVariant{"Hello,"});
+
+  // While the chunk is still referenced, evicting it frees no memory and does not create a second copy.
+  EXPECT_EQ(table.evict_chunk(ChunkID{0}), 0);
+  EXPECT_TRUE(table.is_chunk_evicted(ChunkID{0}));
+  EXPECT_EQ(table.get_chunk(ChunkID{0}), chunk);
+}
+
+TEST_F(StorageTableTest, EvictColdChunks) {
+  for (auto index = int32_t{0}; index < 8; ++index) {
+    table.append({index, std::to_string(index)});
+  }
+  for (auto chunk_id = ChunkID{0}; chunk_id < 4; ++chunk_id) {
+    table.compress_chunk(chunk_id);
+  }
+  const auto chunk_memory_usage = table.get_chunk(ChunkID{0})->estimate_memory_usage();
+
+  // Chunks 2 and 0 are accessed last and stay in memory.
+  table.get_chunk(ChunkID{1});
+  table.get_chunk(ChunkID{3});
+  table.get_chunk(ChunkID{2});
+  table.get_chunk(ChunkID{0});
+  EXPECT_LT(table.chunk_last_access(ChunkID{1}), table.chunk_last_access(ChunkID{3}));
+
+  EXPECT_EQ(table.evict_cold_chunks(2 * chunk_memory_usage), 2);
+  EXPECT_TRUE(table.is_chunk_evicted(ChunkID{1}));
+  EXPECT_TRUE(table.is_chunk_evicted(ChunkID{3}));
+  EXPECT_FALSE(table.is_chunk_evicted(ChunkID{0}));
+  EXPECT_FALSE(table.is_chunk_evicted(ChunkID{2}));
+
+  EXPECT_EQ(table.evict_cold_chunks(0), 2);
+  EXPECT_EQ(table.estimate_memory_usage(), 0);
+  EXPECT_EQ(table.row_count(), 8);
+}
+
+TEST_F(StorageTableTest, EvictColdChunksSkipsReferencedChunks) {
+  for (auto index = int32_t{0}; index < 8; ++index) {
+    table.append({index, std::to_string(index)});
+  }
+  for (auto chunk_id = ChunkID{0}; chunk_id < 4; ++chunk_id) {
+    table.compress_chunk(chunk_id);
+  }
+  const auto chunk_memory_usage = table.get_chunk(ChunkID{0})->estimate_memory_usage();
+  const auto held_chunk = table.get_chunk(ChunkID{1});
+  for (const auto chunk_id : {ChunkID{3}, ChunkID{2}, ChunkID{0}}) {
+    table.get_chunk(chunk_id);
+  }
+
+  // Evicting the coldest chunk frees nothing while it is held, so the next colder ones are evicted as well.
+  EXPECT_EQ(table.evict_cold_chunks(2 * chunk_memory_usage), 3);
+  EXPECT_TRUE(table.is_chunk_evicted(ChunkID{1}));
+  EXPECT_TRUE(table.is_chunk_evicted(ChunkID{3}));
+  EXPECT_TRUE(table.is_chunk_evicted(ChunkID{2}));
+  EXPECT_FALSE(table.is_chunk_evicted(ChunkID{0}));
+}
+
+TEST_F(StorageTableTest, GetChunkWhileEvictingAndAppending) {
+  for (auto index = int32_t{0}; index < 8; ++index) {
+    table.append({index, std::to_string(index)});
+  }
+  for (auto chunk_id = ChunkID{0}; chunk_id < 4; ++chunk_id) {
+    table.compress_chunk(chunk_id);
+  }
+  auto other_table = Table{2};
+  other_table.add_column("col_1", "int", false);
+  other_table.add_column("col_2", "string", true);
+  for (auto index = int32_t{8}; index < 200; ++index) {
+    other_table.append({index, std::to_string(index)});
+  }
+
+  // Resident chunks are accessed without a lock, so reading has to stay correct while other threads evict chunks and
+  // append new ones, which allocate further blocks of chunk slots.
+  auto reader = std::thread{[&]() {
+    for (auto iteration = int32_t{0}; iteration < 1000; ++iteration) {
+      const auto chunk_id = ChunkID{static_cast<ChunkID::base_type>(iteration % 4)};
+      const auto expected_value = static_cast<int32_t>(2 * chunk_id + 1);
+      EXPECT_EQ((*table.get_chunk(chunk_id)->get_segment(ColumnID{0}))[1], AllTypeVariant{expected_value});
+    }
+  }};
+  auto evictor = std::thread{[&]() {
+    for (auto iteration = 0; iteration < 100; ++iteration) {
+      table.evict_cold_chunks(0);
+    }
+  }};
+  for (auto chunk_id = ChunkID{0}; chunk_id < other_table.chunk_count(); ++chunk_id) {
+    table.emplace_chunk(other_table.get_chunk(chunk_id));
+  }
+  reader.join();
+  evictor.join();
+
+  EXPECT_EQ(table.chunk_count(), 100);
+  EXPECT_EQ(table.row_count(), 200);
+  EXPECT_EQ((*table.get_chunk(ChunkID{99})->get_segment(ColumnID{0}))[1], AllTypeVariant{199});
+}
+
 }  // namespace opossum
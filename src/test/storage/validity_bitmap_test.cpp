@@ -0,0 +1,38 @@
+#include "base_test.hpp"
+
+#include "storage/validity_bitmap.hpp"
+
+namespace opossum {
+
+class StorageValidityBitmapTest : public BaseTest {};
+
+TEST_F(StorageValidityBitmapTest, AppendAndAccess) {
+  auto validity = ValidityBitmap{};
+  EXPECT_EQ(validity.size(), 0);
+  EXPECT_TRUE(validity.words().empty());
+
+  for (auto row = ChunkOffset{0}; row < 130; ++row) {
+    validity.append(row % 3 == 0);
+  }
+
+  EXPECT_EQ(validity.size(), 130);
+  EXPECT_EQ(validity.null_count(), 44);
+  EXPECT_TRUE(validity.is_null(0));
+  EXPECT_FALSE(validity.is_null(1));
+  EXPECT_TRUE(validity.is_null(129));
+  EXPECT_EQ(validity.memory_usage(), 3 * sizeof(uint64_t));
+
+  // Set bits are valid rows, the unused bits of the last word are 0.
+  ASSERT_EQ(validity.words().size(), 3);
+  EXPECT_EQ(validity.words()[0] & 0b1111, 0b0110);
+  EXPECT_EQ(validity.words()[2], 0b01);
+}
+
+TEST_F(StorageValidityBitmapTest, FromNullFlags) {
+  const auto validity = ValidityBitmap{std::vector<bool>{false, true, true, false}};
+  EXPECT_EQ(validity.size(), 4);
+  EXPECT_EQ(validity.null_count(), 2);
+  EXPECT_EQ(validity.words(), (std::pmr::vector<uint64_t>{0b1001}));
+}
+
+}  // namespace opossum
@@ -1,5 +1,8 @@
 #include "base_test.hpp"
 
+#include <array>
+#include <memory_resource>
+
 #include "storage/value_segment.hpp"
 
 namespace opossum {
@@ -51,10 +54,14 @@ TEST_F(StorageValueSegmentTest, AppendNullValue) {
 }
 
 TEST_F(StorageValueSegmentTest, MemoryUsage) {
+  // The segment is nullable and also holds a validity bitmap with one word per 64 values.
   int_value_segment.append(1);
-  EXPECT_EQ(int_value_segment.estimate_memory_usage(), size_t{4});
-  int_value_segment.append(2);
-  EXPECT_EQ(int_value_segment.estimate_memory_usage(), size_t{8});
+  EXPECT_EQ(int_value_segment.estimate_memory_usage(), size_t{4} + sizeof(uint64_t));
+  int_value_segment.append(NULL_VALUE);
+  EXPECT_EQ(int_value_segment.estimate_memory_usage(), size_t{8} + sizeof(uint64_t));
+
+  double_value_segment.append(1.0);
+  EXPECT_EQ(double_value_segment.estimate_memory_usage(), sizeof(double));
 }
 
 TEST_F(StorageValueSegmentTest, NullValueHandling) {
@@ -73,13 +80,38 @@ TEST_F(StorageValueSegmentTest, NullValueHandling) {
   EXPECT_EQ(int_value_segment.get_typed_value(0), 1);
   EXPECT_EQ(int_value_segment.get_typed_value(1), std::nullopt);
 
-  EXPECT_EQ(int_value_segment.values().size(), int_value_segment.null_values().size());
+  EXPECT_EQ(int_value_segment.values().size(), int_value_segment.validity().size());
   EXPECT_EQ(int_value_segment.values().size(), 2);
 
   EXPECT_TRUE(int_value_segment.is_nullable());
 
   EXPECT_FALSE(string_value_segment.is_nullable());
-  EXPECT_THROW(string_value_segment.null_values(), std::logic_error);
+  EXPECT_THROW(string_value_segment.validity(), std::logic_error);
+}
+
+TEST_F(StorageValueSegmentTest, MemoryResource) {
+  // Without an upstream resource, every allocation has to be served from the buffer.
+  auto buffer = std::array<std::byte, 4096>{};
+  auto memory_resource = std::pmr::monotonic_buffer_resource{buffer.data(), buffer.size(),
+                                                             std::pmr::null_memory_resource()};
+
+  auto segment = ValueSegment<std::string>{true, &memory_resource};
+  segment.append("short");
+  segment.append("a string that does not fit into its header");
+  segment.append(NULL_VALUE);
+  EXPECT_EQ(segment.memory_resource(), &memory_resource);
+  EXPECT_EQ(segment.get(1), "a string that does not fit into its header");
+  EXPECT_TRUE(segment.is_null(2));
+
+  // Materialized values are taken over together with their memory resource.
+  auto values = std::pmr::vector<int32_t>{{1, 2, 3}, &memory_resource};
+  const auto* const data = values.data();
+  const auto int_segment = ValueSegment<int32_t>{std::move(values), std::vector<bool>{false, true, false}};
+  EXPECT_EQ(int_segment.memory_resource(), &memory_resource);
+  EXPECT_EQ(int_segment.values().data(), data);
+  EXPECT_TRUE(int_segment.is_null(1));
+
+  EXPECT_EQ(int_value_segment.memory_resource(), std::pmr::get_default_resource());
 }
 
 }  // namespace opossum
@@ -0,0 +1,51 @@
+#include "base_test.hpp"
+
+#include "utils/like_matcher.hpp"
+
+namespace opossum {
+
+class LikeMatcherTest : public BaseTest {};
+
+TEST_F(LikeMatcherTest, SimplePatterns) {
+  EXPECT_TRUE(LikeMatcher{"abc"}.matches("abc"));
+  EXPECT_FALSE(LikeMatcher{"abc"}.matches("abcd"));
+
+  EXPECT_TRUE(LikeMatcher{"ab%"}.matches("ab"));
+  EXPECT_TRUE(LikeMatcher{"ab%"}.matches("abc"));
+  EXPECT_FALSE(LikeMatcher{"ab%"}.matches("a"));
+
+  EXPECT_TRUE(LikeMatcher{"%bc"}.matches("abc"));
+  EXPECT_FALSE(LikeMatcher{"%bc"}.matches("bcd"));
+
+  EXPECT_TRUE(LikeMatcher{"%b%"}.matches("abc"));
+  EXPECT_FALSE(LikeMatcher{"%b%"}.matches("ac"));
+
+  EXPECT_TRUE(LikeMatcher{"%"}.matches(""));
+  EXPECT_TRUE(LikeMatcher{""}.matches(""));
+  EXPECT_FALSE(LikeMatcher{""}.matches("a"));
+}
+
+TEST_F(LikeMatcherTest, GeneralPatterns) {
+  EXPECT_TRUE(LikeMatcher{"a_c"}.matches("abc"));
+  EXPECT_FALSE(LikeMatcher{"a_c"}.matches("ac"));
+  EXPECT_TRUE(LikeMatcher{"a%c%e"}.matches("abcde"));
+  EXPECT_TRUE(LikeMatcher{"a%c%e"}.matches("ace"));
+  EXPECT_FALSE(LikeMatcher{"a%c%e"}.matches("abcd"));
+  EXPECT_TRUE(LikeMatcher{"%a%a%"}.matches("banana"));
+  EXPECT_TRUE(LikeMatcher{"_%_"}.matches("ab"));
+  EXPECT_FALSE(LikeMatcher{"_%_"}.matches("a"));
+  EXPECT_TRUE(LikeMatcher{"100%%"}.matches("100%"));
+}
+
+TEST_F(LikeMatcherTest, Prefix) {
+  EXPECT_EQ(LikeMatcher{"abc%"}.prefix(), "abc");
+  EXPECT_EQ(LikeMatcher{"%"}.prefix(), "");
+  EXPECT_EQ(LikeMatcher{"abc"}.prefix(), std::nullopt);
+  EXPECT_EQ(LikeMatcher{"a_c%"}.prefix(), std::nullopt);
+
+  EXPECT_EQ(prefix_upper_bound("abc"), "abd");
+  EXPECT_EQ(prefix_upper_bound("ab\xff"), "ac");
+  EXPECT_EQ(prefix_upper_bound(""), std::nullopt);
+}
+
+}  // namespace opossum
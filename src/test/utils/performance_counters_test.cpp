@@ -0,0 +1,72 @@
+#include "base_test.hpp"
+
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "utils/load_table.hpp"
+#include "utils/performance_counters.hpp"
+
+namespace opossum {
+
+class PerformanceCountersTest : public BaseTest {
+ protected:
+  void TearDown() override {
+    AbstractOperator::set_performance_counters_enabled(false);
+  }
+};
+
+TEST_F(PerformanceCountersTest, DerivedMetrics) {
+  const auto values = PerformanceCounterValues{1'000, 2'000, 10, 4};
+  EXPECT_DOUBLE_EQ(values.instructions_per_cycle(), 2.0);
+  EXPECT_DOUBLE_EQ(values.cache_misses_per_kilo_instruction(), 5.0);
+  EXPECT_DOUBLE_EQ(values.branch_misses_per_kilo_instruction(), 2.0);
+
+  const auto empty_values = PerformanceCounterValues{};
+  EXPECT_DOUBLE_EQ(empty_values.instructions_per_cycle(), 0.0);
+  EXPECT_DOUBLE_EQ(empty_values.cache_misses_per_kilo_instruction(), 0.0);
+}
+
+TEST_F(PerformanceCountersTest, Arithmetic) {
+  auto values = PerformanceCounterValues{1'000, 2'000, 10, 4};
+  const auto difference = values - PerformanceCounterValues{400, 500, 20, 1};
+  EXPECT_EQ(difference.cycles, 600);
+  EXPECT_EQ(difference.instructions, 1'500);
+  // Differences are clamped at zero.
+  EXPECT_EQ(difference.cache_misses, 0);
+  EXPECT_EQ(difference.branch_misses, 3);
+
+  values += difference;
+  EXPECT_EQ(values.cycles, 1'600);
+  EXPECT_EQ(values.instructions, 3'500);
+}
+
+TEST_F(PerformanceCountersTest, Read) {
+  // Counting is not available everywhere, e.g., in VMs without a virtual PMU. Then, read consistently fails.
+  const auto start_values = PerformanceCounters::read();
+  EXPECT_EQ(start_values.has_value(), PerformanceCounters::available());
+  if (!start_values) {
+    return;
+  }
+
+  auto sum = uint64_t{0};
+  for (auto index = uint64_t{0}; index < 100'000; ++index) {
+    sum += index * index;
+  }
+  EXPECT_GT(sum, 0);
+
+  const auto end_values = PerformanceCounters::read();
+  ASSERT_TRUE(end_values);
+  EXPECT_GT(end_values->instructions, start_values->instructions);
+}
+
+TEST_F(PerformanceCountersTest, Operators) {
+  const auto table_wrapper = std::make_shared<TableWrapper>(load_table("src/test/tables/int_float.tbl", 2));
+  table_wrapper->execute();
+  EXPECT_FALSE(table_wrapper->performance_data().performance_counters);
+
+  AbstractOperator::set_performance_counters_enabled(true);
+  const auto table_scan = std::make_shared<TableScan>(table_wrapper, ColumnID{0}, ScanType::OpGreaterThan, 1000);
+  table_scan->execute();
+  EXPECT_EQ(table_scan->performance_data().performance_counters.has_value(), PerformanceCounters::available());
+}
+
+}  // namespace opossum
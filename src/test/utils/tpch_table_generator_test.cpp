@@ -0,0 +1,109 @@
+#include "base_test.hpp"
+
+#include "storage/dictionary_segment.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+#include "storage/value_segment.hpp"
+#include "utils/tpch_table_generator.hpp"
+
+namespace opossum {
+
+class TpchTableGeneratorTest : public BaseTest {
+ protected:
+  void TearDown() override {
+    StorageManager::get().reset();
+  }
+};
+
+TEST_F(TpchTableGeneratorTest, RowCounts) {
+  const auto tables = TpchTableGenerator{0.01f}.generate();
+  EXPECT_EQ(tables.size(), 8);
+  EXPECT_EQ(tables.at("region")->row_count(), 5);
+  EXPECT_EQ(tables.at("nation")->row_count(), 25);
+  EXPECT_EQ(tables.at("supplier")->row_count(), 100);
+  EXPECT_EQ(tables.at("customer")->row_count(), 1'500);
+  EXPECT_EQ(tables.at("part")->row_count(), 2'000);
+  EXPECT_EQ(tables.at("partsupp")->row_count(), 8'000);
+  EXPECT_EQ(tables.at("orders")->row_count(), 15'000);
+  // Every order has between one and seven line items.
+  EXPECT_GE(tables.at("lineitem")->row_count(), 15'000);
+  EXPECT_LE(tables.at("lineitem")->row_count(), 7 * 15'000);
+
+  EXPECT_EQ(tables.at("lineitem")->column_count(), 16);
+  EXPECT_EQ(tables.at("lineitem")->column_type(ColumnID{4}), "float");
+  EXPECT_EQ(tables.at("lineitem")->column_type(ColumnID{10}), "string");
+}
+
+TEST_F(TpchTableGeneratorTest, Deterministic) {
+  const auto first_tables = TpchTableGenerator{0.001f}.generate();
+  const auto second_tables = TpchTableGenerator{0.001f}.generate();
+  for (const auto& [name, table] : first_tables) {
+    const auto& other_table = second_tables.at(name);
+    ASSERT_EQ(table->row_count(), other_table->row_count());
+    for (auto chunk_id = ChunkID{0}; chunk_id < table->chunk_count(); ++chunk_id) {
+      const auto chunk = table->get_chunk(chunk_id);
+      const auto other_chunk = other_table->get_chunk(chunk_id);
+      for (auto column_id = ColumnID{0}; column_id < table->column_count(); ++column_id) {
+        for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk->size(); ++chunk_offset) {
+          ASSERT_EQ((*chunk->get_segment(column_id))[chunk_offset],
+                    (*other_chunk->get_segment(column_id))[chunk_offset]);
+        }
+      }
+    }
+  }
+}
+
+TEST_F(TpchTableGeneratorTest, ChunkingAndCompression) {
+  const auto uncompressed_tables = TpchTableGenerator{0.001f, ChunkOffset{100}}.generate();
+  const auto& customer = uncompressed_tables.at("customer");
+  EXPECT_EQ(customer->row_count(), 150);
+  EXPECT_EQ(customer->chunk_count(), 2);
+  EXPECT_EQ(customer->get_chunk(ChunkID{1})->size(), 50);
+  EXPECT_TRUE(
+      std::dynamic_pointer_cast<ValueSegment<int32_t>>(customer->get_chunk(ChunkID{0})->get_segment(ColumnID{0})));
+
+  const auto compressed_tables = TpchTableGenerator{0.001f, ChunkOffset{100}, true}.generate();
+  for (const auto& [name, table] : compressed_tables) {
+    for (auto chunk_id = ChunkID{0}; chunk_id < table->chunk_count(); ++chunk_id) {
+      EXPECT_TRUE(std::dynamic_pointer_cast<DictionarySegment<int32_t>>(
+          table->get_chunk(chunk_id)->get_segment(ColumnID{0})));
+    }
+  }
+  EXPECT_EQ((*compressed_tables.at("customer")->get_chunk(ChunkID{1})->get_segment(ColumnID{0}))[ChunkOffset{49}],
+            AllTypeVariant{150});
+}
+
+TEST_F(TpchTableGeneratorTest, Values) {
+  const auto tables = TpchTableGenerator{0.001f}.generate();
+
+  // Order keys are sparse: only the first eight of every 32 keys are used.
+  const auto orders_chunk = tables.at("orders")->get_chunk(ChunkID{0});
+  EXPECT_EQ((*orders_chunk->get_segment(ColumnID{0}))[ChunkOffset{7}], AllTypeVariant{8});
+  EXPECT_EQ((*orders_chunk->get_segment(ColumnID{0}))[ChunkOffset{8}], AllTypeVariant{33});
+
+  const auto lineitem_chunk = tables.at("lineitem")->get_chunk(ChunkID{0});
+  const auto& discounts = std::static_pointer_cast<ValueSegment<float>>(lineitem_chunk->get_segment(ColumnID{6}));
+  const auto& ship_dates =
+      std::static_pointer_cast<ValueSegment<std::string>>(lineitem_chunk->get_segment(ColumnID{10}));
+  const auto& receipt_dates =
+      std::static_pointer_cast<ValueSegment<std::string>>(lineitem_chunk->get_segment(ColumnID{12}));
+  for (auto chunk_offset = ChunkOffset{0}; chunk_offset < lineitem_chunk->size(); ++chunk_offset) {
+    const auto discount = discounts->get(chunk_offset);
+    EXPECT_GE(discount, 0.0f);
+    EXPECT_LE(discount, 0.1f);
+
+    const auto ship_date = ship_dates->get(chunk_offset);
+    EXPECT_EQ(ship_date.size(), 10);
+    EXPECT_GE(ship_date, "1992-01-02");
+    EXPECT_LT(ship_date, receipt_dates->get(chunk_offset));
+    EXPECT_LE(receipt_dates->get(chunk_offset), "1998-12-31");
+  }
+}
+
+TEST_F(TpchTableGeneratorTest, GenerateAndStore) {
+  TpchTableGenerator{0.001f}.generate_and_store();
+  EXPECT_TRUE(StorageManager::get().has_table("lineitem"));
+  EXPECT_EQ(StorageManager::get().get_table("region")->row_count(), 5);
+}
+
+}  // namespace opossum
@@ -0,0 +1,98 @@
+#include "base_test.hpp"
+
+#include "operators/materialize.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "utils/load_table.hpp"
+#include "utils/run_in_parallel.hpp"
+#include "utils/tracer.hpp"
+
+namespace opossum {
+
+class TracerTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    Tracer::clear();
+    _table_wrapper = std::make_shared<TableWrapper>(load_table("src/test/tables/int_float.tbl", 2));
+  }
+
+  void TearDown() override {
+    Tracer::disable();
+    Tracer::clear();
+  }
+
+  std::string _chrome_trace() {
+    auto stream = std::ostringstream{};
+    Tracer::write_chrome_trace(stream);
+    return stream.str();
+  }
+
+  std::shared_ptr<TableWrapper> _table_wrapper;
+};
+
+TEST_F(TracerTest, Disabled) {
+  _table_wrapper->execute();
+  run_in_parallel(4, [](const size_t /*task_id*/) {});
+  EXPECT_EQ(Tracer::event_count(), 0);
+  EXPECT_EQ(_chrome_trace().find("\"ph\": \"X\""), std::string::npos);
+}
+
+TEST_F(TracerTest, Operators) {
+  Tracer::enable();
+  _table_wrapper->execute();
+  const auto table_scan = std::make_shared<TableScan>(_table_wrapper, ColumnID{0}, ScanType::OpGreaterThan, 1000);
+  table_scan->execute();
+  Tracer::disable();
+
+  EXPECT_EQ(Tracer::event_count(), 2);
+  const auto trace = _chrome_trace();
+  EXPECT_EQ(trace.find("{\"traceEvents\": ["), 0);
+  EXPECT_NE(trace.find("{\"name\": \"TableWrapper\", \"cat\": \"operator\", \"ph\": \"X\", \"ts\": "),
+            std::string::npos);
+  EXPECT_NE(trace.find("{\"name\": \"TableScan\", \"cat\": \"operator\", \"ph\": \"X\", \"ts\": "), std::string::npos);
+  EXPECT_NE(trace.find("\"args\": {\"output_rows\": 2}"), std::string::npos);
+  EXPECT_NE(trace.find("\"ph\": \"M\""), std::string::npos);
+
+  Tracer::clear();
+  EXPECT_EQ(Tracer::event_count(), 0);
+}
+
+TEST_F(TracerTest, Tasks) {
+  Tracer::enable();
+  run_in_parallel(8, [](const size_t /*task_id*/) {}, "Test");
+  Tracer::disable();
+
+  // The call itself, at least one worker, and the eight tasks. The events of the workers are kept after they exited.
+  EXPECT_GE(Tracer::event_count(), 10);
+  const auto trace = _chrome_trace();
+  EXPECT_NE(trace.find("{\"name\": \"run_in_parallel\", \"cat\": \"scheduler\""), std::string::npos);
+  EXPECT_NE(trace.find("\"args\": {\"tasks\": 8}"), std::string::npos);
+  EXPECT_NE(trace.find("{\"name\": \"Worker\", \"cat\": \"scheduler\""), std::string::npos);
+  EXPECT_NE(trace.find("{\"name\": \"Test\", \"cat\": \"task\""), std::string::npos);
+  EXPECT_NE(trace.find("\"args\": {\"task_id\": 7}"), std::string::npos);
+}
+
+TEST_F(TracerTest, EscapesNames) {
+  Tracer::enable();
+  {
+    const auto trace_scope = TraceScope{"\"a\"\n\\b\t", "test"};
+  }
+  Tracer::disable();
+
+  EXPECT_NE(_chrome_trace().find(R"({"name": "\"a\"\u000a\\b\u0009", "cat": "test")"), std::string::npos);
+}
+
+TEST_F(TracerTest, Materialize) {
+  _table_wrapper->execute();
+  Tracer::enable();
+  const auto materialize = std::make_shared<Materialize>(_table_wrapper);
+  materialize->execute();
+  Tracer::disable();
+
+  const auto trace = _chrome_trace();
+  EXPECT_NE(trace.find("{\"name\": \"Materialize\", \"cat\": \"operator\""), std::string::npos);
+  EXPECT_NE(trace.find("{\"name\": \"Gather\", \"cat\": \"task\""), std::string::npos);
+  EXPECT_NE(trace.find("{\"name\": \"Assemble\", \"cat\": \"task\""), std::string::npos);
+}
+
+}  // namespace opossum